@@ -53,6 +53,7 @@
 #endif
 #include <sx/utils/psort.h>
 #include <sai.h>
+#include "mlnx_sai_ext.h"
 
 #ifdef _WIN32
 #define PACKED(__decl, __inst) __pragma(pack(push, 1)) __decl __inst __pragma(pack(pop))
@@ -144,6 +145,7 @@ int msync(void *addr, size_t length, int flags);
 #define MAP_SHARED  1
 #define MAP_FAILED  (void*)-1
 #define MS_SYNC     4
+#define MS_ASYNC    1
 #endif
 
 extern sx_api_handle_t        gh_sdk;
@@ -162,7 +164,7 @@ extern const sai_fdb_api_t              mlnx_fdb_api;
 extern const sai_neighbor_api_t         mlnx_neighbor_api;
 extern const sai_next_hop_api_t         mlnx_next_hop_api;
 extern const sai_next_hop_group_api_t   mlnx_next_hop_group_api;
-extern const sai_router_interface_api_t mlnx_router_interface_api;
+extern const mlnx_router_interface_ext_api_t mlnx_router_interface_api;
 extern const sai_vlan_api_t             mlnx_vlan_api;
 extern const sai_hostif_api_t           mlnx_host_interface_api;
 extern const sai_acl_api_t              mlnx_acl_api;
@@ -260,6 +262,7 @@ typedef uint64_t udf_group_mask_t;
 #endif
 
 typedef struct _mlnx_port_config_t mlnx_port_config_t;
+typedef struct _mlnx_qos_map_t mlnx_qos_map_t;
 
 #define EXTENDED_DATA_SIZE 2
 
@@ -341,6 +344,26 @@ typedef struct mlnx_bridge_rif_ {
     sx_router_id_t              vrf_id;
     uint32_t                    index;
 } mlnx_bridge_rif_t;
+
+/* SDK router counter bound to the RIF for its stats, indexed by the SDK rif id */
+typedef struct mlnx_rif_counter_ {
+    bool                   is_bound;
+    sx_router_counter_id_t counter_id;
+    /* The RIF was created without a counter (e.g. out of router counters), its stats are not available */
+    bool is_unavailable;
+} mlnx_rif_counter_t;
+
+/* SDK RIF configuration as set by SAI, indexed by the SDK rif id (bridge RIFs are in mlnx_bridge_rif_t) */
+typedef struct mlnx_rif_db_ {
+    bool                        is_used;
+    bool                        is_state_valid; /* intf_state is set by SAI (not for loopback RIF) */
+    sx_router_id_t              vrid;
+    sx_router_interface_param_t intf_params;
+    sx_interface_attributes_t   intf_attribs;
+    sx_router_interface_state_t intf_state;
+    sx_port_log_id_t            vport_base_port; /* base port and vlan of sub-port RIF vport */
+    sx_vlan_id_t                vport_base_vlan;
+} mlnx_rif_db_t;
 typedef struct mlnx_bridge_port_ {
     uint32_t               index;
     bool                   is_present;
@@ -353,6 +376,8 @@ typedef struct mlnx_bridge_port_ {
     uint16_t               rif_index;
     sx_vlan_id_t           vlan_id;
     uint16_t               vlans;
+    /* VLANs the port is a member of, the transpose of the VLAN DB ports_map */
+    uint32_t               vlans_map[(SXD_VID_MAX / 32) + 1];
     uint32_t               fdbs;
     uint16_t               stps;
 } mlnx_bridge_port_t;
@@ -397,14 +422,6 @@ typedef union {
     uint8_t                 pg[MLNX_QOS_MAP_CODES_MAX];
     uint8_t                 pfc[MLNX_QOS_MAP_CODES_MAX];
 } mlnx_qos_map_params_t;
-typedef struct _mlnx_qos_map_t {
-    sai_qos_map_type_t    type;
-    mlnx_qos_map_params_t from;
-    mlnx_qos_map_params_t to;
-    uint8_t               count;
-    bool                  is_used;
-    bool                  is_set;
-} mlnx_qos_map_t;
 typedef enum {
     /* TODO: IS_PHY_NONE_MEMBER */
     ATTR_PORT_IS_ENABLED = 1 << 0,
@@ -415,6 +432,7 @@ typedef enum {
 } attr_port_type_check_t;
 
 void mlnx_udf_acl_attrs_metadata_init();
+void mlnx_sai_validation_plans_init(void);
 bool mlnx_udf_acl_attribute_id_is_not_supported(_In_ sai_attr_id_t attr_id);
 sai_status_t check_port_type_attr(const sai_object_id_t *ports,
                                   uint32_t               count,
@@ -516,6 +534,8 @@ sai_status_t mlnx_qos_map_get_by_id(_In_ sai_object_id_t obj_id, _Out_ mlnx_qos_
 sai_status_t mlnx_port_qos_map_apply(_In_ const sai_object_id_t    port,
                                      _In_ const sai_object_id_t    qos_map_id,
                                      _In_ const sai_qos_map_type_t qos_map_type);
+sai_status_t mlnx_port_qos_map_delta_apply(_In_ const mlnx_port_config_t *port, _In_ mlnx_qos_map_t *delta);
+void mlnx_qos_map_port_ref_update(_In_ uint32_t old_id, _In_ uint32_t new_id, _In_ const mlnx_port_config_t *port);
 
 sai_status_t mlnx_register_trap(const sx_access_cmd_t                 cmd,
                                 uint32_t                              index,
@@ -535,6 +555,7 @@ sai_status_t mlnx_route_log_set(sx_verbosity_level_t level);
 sai_status_t mlnx_router_log_set(sx_verbosity_level_t level);
 sai_status_t mlnx_switch_log_set(sx_verbosity_level_t level);
 sai_status_t mlnx_utils_log_set(sx_verbosity_level_t level);
+sai_status_t mlnx_counter_log_set(sx_verbosity_level_t level);
 sai_status_t mlnx_vlan_log_set(sx_verbosity_level_t level);
 sai_status_t mlnx_acl_log_set(sx_verbosity_level_t level);
 sai_status_t mlnx_qos_map_log_set(sx_verbosity_level_t level);
@@ -610,6 +631,8 @@ static inline uint32_t array_bit_test(uint32_t *bit_array, uint32_t bit)
     return ((bit_array[bit / 32] & (1 << (bit % 32))) != 0);
 }
 
+uint32_t mlnx_bitmap_next_set(_In_ const uint32_t *bit_array, _In_ uint32_t bits_count, _In_ uint32_t bit);
+
 sai_status_t mlnx_fdb_route_action_save(_In_ sai_object_type_t   type,
                                         _In_ const void         *entry,
                                         _In_ sai_packet_action_t action);
@@ -668,7 +691,7 @@ sai_status_t mlnx_acl_bind_point_get(_In_ const sai_object_key_t   *key,
 sai_status_t mlnx_acl_stage_action_list_fetch(_In_ uint32_t                       stage,
                                               _Out_ const sai_acl_action_type_t **actions,
                                               _Out_ uint32_t                     *action_count);
-#define acl_global_lock()   cl_plock_excl_acquire(&g_sai_acl_db_ptr->acl_settings_tbl->lock)
+#define acl_global_lock()   mlnx_perf_plock_acquire(&g_sai_acl_db_ptr->acl_settings_tbl->lock, true)
 #define acl_global_unlock() cl_plock_release(&g_sai_acl_db_ptr->acl_settings_tbl->lock)
 
 typedef struct _mlnx_mstp_inst_t {
@@ -718,6 +741,9 @@ extern const mlnx_trap_info_t mlnx_traps_info[];
 #define MAX_PORTS        64
 #define MAX_BRIDGE_PORTS 512
 #define MAX_BRIDGE_RIFS  MAX_PORTS
+#define MAX_RIFS         4000
+
+#define MLNX_PORT_STATS_NUM (SAI_PORT_STAT_EEE_RX_DURATION + 1)
 #define MAX_LANES        4
 #define MAX_FDS          100
 #define MAX_POLICERS     100
@@ -760,6 +786,9 @@ typedef enum _mlnx_port_policer_type {
     MLNX_PORT_POLICER_TYPE_MULTICAST_INDEX = 3,
     MLNX_PORT_POLICER_TYPE_MAX             = 4
 } mlnx_port_policer_type;
+
+#define MLNX_POLICER_PORT_BINDINGS_MAX (MAX_PORTS * 2 * MLNX_PORT_POLICER_TYPE_MAX)
+
 typedef struct _mlnx_sai_buffer_pool_attr {
     uint32_t                         sx_pool_id;
     sai_buffer_pool_type_t           pool_type;
@@ -787,6 +816,9 @@ typedef struct _mlnx_policer_db_entry_t {
     sx_policer_id_t         sx_policer_id_acl;      /* For binding to ACL only. see SX_POLICER_ID_INVALID note above, applies to this field as well*/
     sx_policer_attributes_t sx_policer_attr;        /* Policer attribute values. The values will be applied to trap group, ACL and port storm policers.*/
     bool                    valid;    /*does given db entry have valid policer data*/
+    /* Port storm slots bound to this policer, bit == port_db index * MLNX_PORT_POLICER_TYPE_MAX + policer type */
+    uint32_t                port_bindings[MLNX_POLICER_PORT_BINDINGS_MAX / 32];
+    uint32_t                port_bindings_count;
 } mlnx_policer_db_entry_t;
 typedef enum mlnx_sched_obj_type {
     MLNX_SCHED_OBJ_UNDEF,
@@ -805,10 +837,19 @@ typedef struct mlnx_sched_obj {
     uint8_t                max_child_count;
     sx_cos_ets_hierarchy_t ets_type;
 } mlnx_sched_obj_t;
+/* Scheduler object reference in the child index: groups first (level * MAX_SCHED_CHILD_GROUPS + index),
+ * then queues (MLNX_SCHED_GROUP_REFS + queue index) */
+#define MLNX_SCHED_GROUP_REFS (MAX_SCHED_LEVELS * MAX_SCHED_CHILD_GROUPS)
+#define MLNX_SCHED_OBJ_REFS   128
 typedef struct _mlnx_sched_hierarchy_t {
     bool             is_default;
     uint8_t          groups_count[MAX_SCHED_LEVELS];
     mlnx_sched_obj_t groups[MAX_SCHED_LEVELS][MAX_SCHED_CHILD_GROUPS];
+    /* Child index, children of group [lvl][idx] are child_refs[child_first[lvl][idx]] ..
+     * [child_first[lvl][idx] + child_count[lvl][idx] - 1] */
+    uint8_t          child_first[MAX_SCHED_LEVELS][MAX_SCHED_CHILD_GROUPS];
+    uint8_t          child_count[MAX_SCHED_LEVELS][MAX_SCHED_CHILD_GROUPS];
+    uint8_t          child_refs[MLNX_SCHED_OBJ_REFS];
 } mlnx_sched_hierarchy_t;
 typedef struct _mlnx_port_config_t {
     uint8_t                         index;
@@ -842,14 +883,27 @@ typedef struct _mlnx_port_config_t {
     uint32_t               start_queues_index;
     mlnx_sched_hierarchy_t sched_hierarchy;
     uint16_t               rifs;
+    /* version of g_sai_db_ptr->ecmp_hash_cfg last pushed to the port, 0 if never */
+    uint32_t               ecmp_hash_version;
 } mlnx_port_config_t;
 typedef struct _mlnx_vlan_db_t {
     /* We keep here phy ports + LAGs */
     uint32_t          ports_map[((MAX_BRIDGE_PORTS * 2) / 32) + 1];
     sx_mstp_inst_id_t stp_id;
     bool              is_created;
+    /* Bitmap of the flood control types (1 << sx_flood_control_type_t) which have ports set in SDK */
+    uint8_t              flood_ctrl_types;
+    /* Flow counter bound to the VLAN FID on the first stats request */
+    bool                 is_counter_bound;
+    sx_flow_counter_id_t counter_id;
 } mlnx_vlan_db_t;
 
+/*
+ * VLAN flow counters are allocated from the SDK flow counter pool shared with the ACL entry counters,
+ * the cap keeps VLAN stats from exhausting the pool for ACLs
+ */
+#define MLNX_VLAN_COUNTERS_MAX 1024
+
 /* MLNX Bridge API */
 sai_status_t mlnx_bridge_init(void);
 sx_bridge_id_t mlnx_bridge_default_1q(void);
@@ -872,6 +926,10 @@ sai_status_t mlnx_bridge_rif_del(mlnx_bridge_rif_t *rif);
 sai_status_t mlnx_bridge_rif_by_idx(uint32_t idx, mlnx_bridge_rif_t **rif);
 sai_status_t mlnx_bridge_rif_to_oid(mlnx_bridge_rif_t *rif, sai_object_id_t *oid);
 sai_status_t mlnx_rif_oid_to_sdk_rif_id(sai_object_id_t rif_oid, sx_router_interface_t *sdk_rif_id);
+sai_status_t mlnx_rif_sx_counter_attach(_In_ sx_router_interface_t sdk_rif_id);
+sai_status_t mlnx_rif_sx_counter_detach(_In_ sx_router_interface_t sdk_rif_id);
+void mlnx_rif_db_state_update(_In_ sx_router_interface_t              sdk_rif_id,
+                             _In_ const sx_router_interface_state_t *state);
 sai_status_t mlnx_bridge_sx_vport_create(_In_ sx_port_log_id_t   sx_port,
                                          _In_ sx_vlan_id_t       sx_vlan_id,
                                          _Out_ sx_port_log_id_t *sx_vport);
@@ -890,6 +948,8 @@ sx_mstp_inst_id_t mlnx_vlan_stp_id_get(sai_vlan_id_t vlan_id);
 
 void mlnx_vlan_port_set(uint16_t vid, mlnx_bridge_port_t *port, bool is_set);
 bool mlnx_vlan_port_is_set(uint16_t vid, mlnx_bridge_port_t *port);
+uint32_t mlnx_vlan_port_next(_In_ uint16_t vid, _In_ uint32_t idx);
+uint16_t mlnx_bridge_port_vlan_next(_In_ const mlnx_bridge_port_t *port, _In_ uint32_t vid);
 sai_status_t mlnx_vlan_sai_tagging_to_sx(_In_ sai_vlan_tagging_mode_t      mode,
                                          _Out_ sx_untagged_member_state_t *tagging,
                                          _Out_ sx_untagged_prio_state_t   *prio_tagging);
@@ -923,6 +983,9 @@ sai_status_t mlnx_fdb_flood_control_set(_In_ sx_vid_t                vlan_id,
                                         _In_ const sx_port_log_id_t *sx_ports,
                                         _In_ uint32_t                ports_count,
                                         _In_ bool                    add);
+/* DB write lock is needed */
+void mlnx_fdb_flood_ctrl_type_mark(_In_ sx_vid_t vlan_id, _In_ sx_flood_control_type_t type, _In_ bool is_set);
+bool mlnx_fdb_flood_ctrl_type_is_set(_In_ sx_vid_t vlan_id, _In_ sx_flood_control_type_t type);
 sai_status_t mlnx_buffer_port_profile_list_get(_In_ const sai_object_id_t     port_id,
                                                _Inout_ sai_attribute_value_t *value,
                                                _In_ bool                      is_ingress);
@@ -979,10 +1042,15 @@ sai_status_t mlnx_buffer_apply(_In_ sai_object_id_t sai_buffer, _In_ sai_object_
         if (port->is_present)
 
 #define mlnx_vlan_ports_foreach(vid, port, idx) \
-    for (idx = 0; \
+    for (idx = mlnx_vlan_port_next(vid, 0); \
          (idx < MAX_BRIDGE_PORTS) && \
-         (port = &g_sai_db_ptr->bridge_ports_db[idx]); idx++) \
-        if (port->is_present && mlnx_vlan_port_is_set(vid, port))
+         (port = &g_sai_db_ptr->bridge_ports_db[idx]); idx = mlnx_vlan_port_next(vid, idx + 1)) \
+        if (port->is_present)
+
+#define mlnx_bridge_port_vlans_foreach(port, vid) \
+    for (vid = mlnx_bridge_port_vlan_next(port, SXD_VID_MIN); \
+         vid <= SXD_VID_MAX; \
+         vid = mlnx_bridge_port_vlan_next(port, vid + 1))
 
 typedef struct _mlnx_trap_t {
     sai_packet_action_t action;
@@ -996,6 +1064,8 @@ typedef struct _mlnx_wred_profile_t {
     bool                    wred_enabled;
     bool                    ecn_enabled;
     bool                    in_use;
+    /* Ports/LAGs (by ports_db index) the profile was bound to on port or queue level */
+    uint32_t                ports_map[(MAX_PORTS * 2 + 31) / 32];
 } mlnx_wred_profile_t;
 
 /* UDF db */
@@ -1055,6 +1125,19 @@ typedef struct _mlnx_udf_db_t {
 #define MAX_PORT_PRIO          (g_resource_limits.cos_port_prio_max)
 #define MAX_PCP_PRIO           7
 
+#define MLNX_QOS_MAP_PORT_WORDS ((MAX_PORTS * 2 + 31) / 32)
+struct _mlnx_qos_map_t {
+    sai_qos_map_type_t    type;
+    mlnx_qos_map_params_t from;
+    mlnx_qos_map_params_t to;
+    uint8_t               count;
+    bool                  is_used;
+    bool                  is_set;
+    /* Reverse index of ports/LAGs bound to the map, by ports_db index */
+    uint32_t              port_refs;
+    uint32_t              ports_map[MLNX_QOS_MAP_PORT_WORDS];
+};
+
 #define MAX_ACL_COUNTER_NUM    1000
 #define DEFAULT_ACL_TABLE_SIZE 1000
 
@@ -1363,6 +1446,18 @@ typedef enum _mlnx_switch_hash_object_id {
     SAI_HASH_MAX_OBJ_ID
 } mlnx_switch_usage_hash_object_id_t;
 
+/* ECMP hash config in canonical form (sorted lists), compiled once per change.
+ * Ports keep the version they were last configured with, so only stale ports are updated. */
+typedef struct _mlnx_ecmp_hash_cfg_t {
+    bool                               is_valid;
+    uint32_t                           version;
+    sx_router_ecmp_port_hash_params_t  params;
+    sx_router_ecmp_hash_field_enable_t enables[FIELDS_ENABLES_NUM];
+    uint32_t                           enable_count;
+    sx_router_ecmp_hash_field_t        fields[FIELDS_NUM];
+    uint32_t                           field_count;
+} mlnx_ecmp_hash_cfg_t;
+
 sai_status_t mlnx_hash_ecmp_hash_params_apply(const sai_attr_id_t attr_id, const sai_attribute_value_t* value);
 
 sai_status_t mlnx_hash_object_apply(const sai_object_id_t                    hash_id,
@@ -1433,6 +1528,10 @@ sai_status_t mlnx_sai_unbind_policer_from_port(_In_ sai_object_id_t           sa
 sai_status_t mlnx_sai_bind_policer_to_port(_In_ sai_object_id_t           sai_port,
                                            _In_ sai_object_id_t           sai_policer,
                                            _In_ mlnx_policer_bind_params* bind_params);
+void mlnx_policer_port_binding_update(_In_ sai_object_id_t           sai_policer,
+                                      _In_ const mlnx_port_config_t *port_config,
+                                      _In_ mlnx_port_policer_type    port_policer_type,
+                                      _In_ bool                      is_bound);
 
 void log_sx_policer_attributes(_In_ sx_policer_id_t sx_policer, _In_ sx_policer_attributes_t* sx_attribs);
 
@@ -1442,6 +1541,9 @@ sai_status_t mlnx_port_samplepacket_params_check(_In_ const mlnx_port_config_t *
                                                  _In_ const mlnx_port_config_t *port_config);
 sai_status_t mlnx_port_samplepacket_params_clear(_In_ mlnx_port_config_t *port_config, _In_ bool is_soft);
 sai_status_t mlnx_port_samplepacket_params_clone(_In_ mlnx_port_config_t *to, _In_ const mlnx_port_config_t *from);
+void mlnx_samplepacket_port_ref_update(_In_ uint32_t                  old_idx,
+                                       _In_ uint32_t                  new_idx,
+                                       _In_ const mlnx_port_config_t *port);
 sai_status_t mlnx_port_mirror_params_check(_In_ const mlnx_port_config_t *port1, _In_ const mlnx_port_config_t *port2);
 sai_status_t mlnx_port_mirror_params_clear(_In_ mlnx_port_config_t *port_config);
 sai_status_t mlnx_port_mirror_sessions_clone(_In_ mlnx_port_config_t *to, _In_ const mlnx_port_config_t *from);
@@ -1475,6 +1577,8 @@ typedef struct _mlnx_samplepacket_t {
     uint32_t                sai_sample_rate;
     sai_samplepacket_type_t sai_type;
     sai_samplepacket_mode_t sai_mode;
+    /* Ports/LAGs (by ports_db index) the session is bound to on ingress */
+    uint32_t                ports_map[(MAX_PORTS * 2 + 31) / 32];
 } mlnx_samplepacket_t;
 
 #define MAX_TUNNEL_DB_SIZE            100
@@ -1549,6 +1653,36 @@ typedef struct _fdb_actions_db_t {
     uint32_t              count;
 } fdb_or_route_actions_db_t;
 
+/* Shadow of the next hops behind the one member ECMP containers of SAI next hop objects */
+#define MLNX_NHOP_CACHE_SIZE 16384
+/* SAI next hop objects that can share a container, one bit each in the instances bitmap */
+#define MLNX_NHOP_INSTANCES_MAX 64
+
+typedef struct _mlnx_nhop_cache_entry_t {
+    bool          is_used;
+    sx_ecmp_id_t  ecmp_id;
+    sx_next_hop_t next_hop;
+    /* Live OID instances of the SAI next hop objects sharing the container, bit 0 is the creator */
+    uint64_t instances;
+    /* Where the lookup for a free instance starts, so removed instances are not reused right away */
+    uint16_t next_instance;
+} mlnx_nhop_cache_entry_t;
+
+/* Identical next hops share a container when KV_NEXT_HOP_SHARING is set */
+typedef struct _mlnx_nhop_intern_entry_t {
+    bool              is_used;
+    sx_next_hop_key_t key;
+    sx_ecmp_id_t      ecmp_id;
+} mlnx_nhop_intern_entry_t;
+
+typedef struct _mlnx_nhop_cache_t {
+    bool                     is_sharing_enabled;
+    uint32_t                 count;
+    mlnx_nhop_cache_entry_t  entries[MLNX_NHOP_CACHE_SIZE];
+    uint32_t                 intern_count;
+    mlnx_nhop_intern_entry_t intern[MLNX_NHOP_CACHE_SIZE];
+} mlnx_nhop_cache_t;
+
 typedef struct sai_db {
     cl_plock_t         p_lock;
     sx_mac_addr_t      base_mac_addr;
@@ -1558,7 +1692,17 @@ typedef struct sai_db {
     mlnx_port_config_t ports_db[MAX_PORTS * 2];
     mlnx_bridge_port_t bridge_ports_db[MAX_BRIDGE_PORTS];
     mlnx_bridge_rif_t  bridge_rifs_db[MAX_BRIDGE_RIFS];
+    mlnx_rif_counter_t rif_counters_db[MAX_RIFS];
+    /* SDK rif ids with a bound counter, the collector walks only them */
+    uint32_t           rif_counters_bound[(MAX_RIFS + 31) / 32];
+    mlnx_rif_db_t      rifs_db[MAX_RIFS];
+    /* Port counter values at the last clear, the stats gets return the values relative to them */
+    uint64_t           port_stats_baseline[MAX_PORTS][MLNX_PORT_STATS_NUM];
+    /* Bumped when the baseline is replaced, by a clear of all the port counters and on port add */
+    uint32_t           port_stats_epoch[MAX_PORTS];
     mlnx_vlan_db_t     vlans_db[SXD_VID_MAX];
+    /* VLANs with a bound flow counter, up to MLNX_VLAN_COUNTERS_MAX */
+    uint32_t           vlan_counters_count;
     sx_fd_t            fd_db[MAX_FDS];
     sai_object_id_t    default_trap_group;
     sai_object_id_t    default_vrid;
@@ -1572,6 +1716,8 @@ typedef struct sai_db {
     mlnx_policer_db_entry_t   policers_db[MAX_POLICERS];
     mlnx_hash_obj_t           hash_list[SAI_HASH_MAX_OBJ_COUNT];
     sai_object_id_t           oper_hash_list[SAI_HASH_MAX_OBJ_ID];
+    mlnx_ecmp_hash_cfg_t      ecmp_hash_cfg;
+    uint32_t                  counter_refresh_interval;
     mlnx_samplepacket_t       mlnx_samplepacket_session[MLNX_SAMPLEPACKET_SESSION_MAX];
     mlnx_tunneltable_t        mlnx_tunneltable[MLNX_TUNNELTABLE_SIZE];
     tunnel_db_entry_t         tunnel_db[MAX_TUNNEL_DB_SIZE];
@@ -1586,6 +1732,8 @@ typedef struct sai_db {
     sai_packet_action_t       flood_action_bc;
     fdb_or_route_actions_db_t fdb_or_route_actions;
     bool                      transaction_mode_enable;
+    bool                      restart_warm;
+    mlnx_nhop_cache_t         nhop_cache;
 } sai_db_t;
 
 extern sai_db_t *g_sai_db_ptr;
@@ -1704,24 +1852,187 @@ sai_status_t mlnx_sai_get_port_buffer_index_array(uint32_t
 
 uint32_t mlnx_sai_get_buffer_profile_number();
 
+#define MLNX_PORT_COUNTERS_PRIO_NUM 8
+
+typedef struct _mlnx_port_counters_t {
+    sx_port_cntr_rfc_2863_t       cnts_2863;
+    sx_port_cntr_rfc_2819_t       cnts_2819;
+    sx_port_cntr_ieee_802_dot_3_t cntr_802;
+    sx_port_cntr_discard_t        discard_cnts;
+    sx_cos_redecn_port_counters_t redecn_cnts;
+    bool                          has_prio;
+    sx_port_cntr_prio_t           prio_cnts[MLNX_PORT_COUNTERS_PRIO_NUM];
+} mlnx_port_counters_t;
+
+sai_status_t mlnx_port_counters_read(_In_ sx_api_handle_t        handle,
+                                     _In_ sx_port_log_id_t       log_port,
+                                     _In_ sx_port_log_id_t       red_port,
+                                     _In_ bool                   with_prio,
+                                     _Out_ mlnx_port_counters_t *counters);
+
+typedef struct _mlnx_acl_counter_value_t {
+    uint32_t              index;
+    sx_flow_counter_id_t  counter_id;
+    sx_flow_counter_set_t value;
+    bool                  is_valid;
+} mlnx_acl_counter_value_t;
+
+void mlnx_acl_counters_read(_In_ sx_api_handle_t            handle,
+                            _Out_ mlnx_acl_counter_value_t *values,
+                            _In_ uint32_t                   max_count,
+                            _Out_ uint32_t                 *count);
+
+typedef struct _mlnx_rif_counter_value_t {
+    sx_router_interface_t   rif_id;
+    sx_router_counter_id_t  counter_id;
+    sx_router_counter_set_t value;
+    bool                    is_valid;
+} mlnx_rif_counter_value_t;
+
+void mlnx_rif_counters_read(_In_ sx_api_handle_t            handle,
+                            _Out_ mlnx_rif_counter_value_t *values,
+                            _In_ uint32_t                   max_count,
+                            _Out_ uint32_t                 *count);
+
+typedef struct _mlnx_vlan_counter_value_t {
+    sx_vlan_id_t          vlan_id;
+    sx_flow_counter_id_t  counter_id;
+    sx_flow_counter_set_t value;
+    bool                  is_valid;
+} mlnx_vlan_counter_value_t;
+
+void mlnx_vlan_counters_read(_In_ sx_api_handle_t             handle,
+                             _Out_ mlnx_vlan_counter_value_t *values,
+                             _In_ uint32_t                    max_count,
+                             _Out_ uint32_t                  *count);
+
+/* Counter snapshots, the gets return false when the value is not in a valid snapshot */
+sai_status_t mlnx_counter_collector_start(_In_ uint32_t interval_msec, _In_ bool with_counters);
+void mlnx_counter_collector_stop(void);
+void mlnx_counter_collector_invalidate(void);
+bool mlnx_watermark_pool_get(_In_ uint32_t sx_pool_id, _Out_ sx_cos_pool_occupancy_statistics_t *stats);
+bool mlnx_watermark_pg_get(_In_ sx_port_log_id_t                 log_port,
+                           _In_ uint32_t                         pg,
+                           _Out_ sx_port_occupancy_statistics_t *stats);
+bool mlnx_watermark_queue_get(_In_ sx_port_log_id_t                 log_port,
+                              _In_ uint32_t                         queue,
+                              _Out_ sx_port_occupancy_statistics_t *stats);
+bool mlnx_counter_port_get(_In_ sx_port_log_id_t log_port, _Out_ mlnx_port_counters_t *counters);
+bool mlnx_counter_tc_get(_In_ sx_port_log_id_t log_port, _In_ uint32_t tc, _Out_ sx_port_traffic_cntr_t *counters);
+bool mlnx_counter_pg_get(_In_ sx_port_log_id_t log_port, _In_ uint32_t pg, _Out_ sx_port_cntr_buff_t *counters);
+bool mlnx_counter_acl_get(_In_ uint32_t               index,
+                          _In_ sx_flow_counter_id_t   counter_id,
+                          _Out_ sx_flow_counter_set_t *value);
+bool mlnx_counter_rif_get(_In_ sx_router_interface_t     rif_id,
+                          _In_ sx_router_counter_id_t    counter_id,
+                          _Out_ sx_router_counter_set_t *value);
+bool mlnx_counter_vlan_get(_In_ sx_vlan_id_t           vlan_id,
+                           _In_ sx_flow_counter_id_t   counter_id,
+                           _Out_ sx_flow_counter_set_t *value);
+
 extern sai_buffer_db_t *g_sai_buffer_db_ptr;
 extern uint32_t         g_sai_buffer_db_size;
 
 
-#define sai_db_read_lock()  cl_plock_acquire(&g_sai_db_ptr->p_lock)
-#define sai_db_write_lock() cl_plock_excl_acquire(&g_sai_db_ptr->p_lock)
+typedef enum _mlnx_perf_op_t {
+    MLNX_PERF_OP_CREATE,
+    MLNX_PERF_OP_REMOVE,
+    MLNX_PERF_OP_SET,
+    MLNX_PERF_OP_GET,
+    MLNX_PERF_OP_STATS,
+    MLNX_PERF_OP_BULK,
+    MLNX_PERF_OP_MAX
+} mlnx_perf_op_t;
+
+/* Bucket N counts calls that took [2^(N-1), 2^N) usec, the last one is open ended */
+#define MLNX_PERF_HIST_BUCKETS 20
+
+typedef struct _mlnx_perf_entry_t {
+    uint64_t count;
+    uint64_t failed;
+    uint64_t total_ns;
+    uint64_t max_ns;
+    /* Partial, only the SDK calls wrapped by MLNX_PERF_SDK_CALL() are accounted */
+    uint64_t sdk_ns;
+    /* Calls that went through at least one accounted SDK call */
+    uint64_t sdk_count;
+    uint64_t lock_wait_ns;
+    uint64_t hist[MLNX_PERF_HIST_BUCKETS];
+} mlnx_perf_entry_t;
+
+/*
+ * Per API latency accounting. The counters are process local and only the outermost
+ * begin/end pair of a thread is accounted, nested calls are attributed to it.
+ */
+void mlnx_perf_op_begin(_In_ sai_object_type_t object_type, _In_ mlnx_perf_op_t op);
+void mlnx_perf_op_end(_In_ sai_status_t status);
+void mlnx_perf_sdk_enter(void);
+sx_status_t mlnx_perf_sdk_exit(_In_ sx_status_t status);
+void mlnx_perf_plock_acquire(_In_ cl_plock_t *lock, _In_ bool is_exclusive);
+void mlnx_perf_enable_set(_In_ bool enable);
+bool mlnx_perf_is_enabled(void);
+void mlnx_perf_clear(void);
+void mlnx_perf_entry_get(_In_ sai_object_type_t object_type, _In_ mlnx_perf_op_t op, _Out_ mlnx_perf_entry_t *entry);
+const char * mlnx_perf_op_str(_In_ mlnx_perf_op_t op);
+
+/* Vendor switch attributes, handled outside of the SAI meta data */
+typedef enum _mlnx_switch_custom_attr_t {
+    /* Per API latency accounting [bool] (default to true) */
+    MLNX_SWITCH_ATTR_API_PERF_ENABLE = SAI_SWITCH_ATTR_CUSTOM_RANGE_START,
+
+    /* Per API latency counters, read only [sai_u32_list_t]
+     * MLNX_PERF_RECORD_SIZE values for every object type and operation that was called:
+     * object type, mlnx_perf_op_t, calls, failed calls, avg/max/avg SDK/avg lock wait usec
+     * The SDK time covers only the instrumented SDK calls, it is UINT32_MAX when none was accounted */
+    MLNX_SWITCH_ATTR_API_PERF_COUNTERS,
+
+    /* Clear the per API latency counters, write only [bool] */
+    MLNX_SWITCH_ATTR_API_PERF_CLEAR,
+} mlnx_switch_custom_attr_t;
+
+#define MLNX_PERF_RECORD_SIZE 8
+
+/* Accounts the time spent in an SDK call to the current API, evaluates to the SDK status */
+#define MLNX_PERF_SDK_CALL(call) (mlnx_perf_sdk_enter(), mlnx_perf_sdk_exit(call))
+
+#define sai_db_read_lock()  mlnx_perf_plock_acquire(&g_sai_db_ptr->p_lock, false)
+#define sai_db_write_lock() mlnx_perf_plock_acquire(&g_sai_db_ptr->p_lock, true)
 #define sai_db_unlock()     cl_plock_release(&g_sai_db_ptr->p_lock)
-#define sai_db_sync()       msync(g_sai_db_ptr, sizeof(*g_sai_db_ptr), MS_SYNC)
+
+typedef enum _mlnx_shm_db_t {
+    MLNX_SHM_DB_SAI,
+    MLNX_SHM_DB_QOS,
+    MLNX_SHM_DB_BUFFER,
+    MLNX_SHM_DB_MAX
+} mlnx_shm_db_t;
+
+/* Records the pages modified by the writer, DB write lock is needed */
+void mlnx_shm_db_dirty_mark(_In_ mlnx_shm_db_t db, _In_ const void *ptr, _In_ size_t size);
+/* Flushes only the pages recorded since the last flush, DB write lock is needed */
+void mlnx_shm_db_flush(_In_ mlnx_shm_db_t db, _In_ int flags);
+
+#define sai_db_dirty_mark(ptr, size) mlnx_shm_db_dirty_mark(MLNX_SHM_DB_SAI, (ptr), (size))
+#define sai_db_field_dirty_mark(field) \
+    sai_db_dirty_mark(&g_sai_db_ptr->field, sizeof(g_sai_db_ptr->field))
+#define sai_db_sync()       mlnx_shm_db_flush(MLNX_SHM_DB_SAI, MS_SYNC)
+#define sai_db_sync_async() mlnx_shm_db_flush(MLNX_SHM_DB_SAI, MS_ASYNC)
 
 #define sai_qos_db_read_lock()  sai_db_read_lock()
 #define sai_qos_db_write_lock() sai_db_write_lock()
 #define sai_qos_db_unlock()     sai_db_unlock()
 
 #define sai_qos_sched_db (g_sai_qos_db_ptr->sched_db)
-#define sai_qos_db_sync() msync(g_sai_qos_db_ptr->db_base_ptr, g_sai_qos_db_size, MS_SYNC)
+#define sai_qos_db_dirty_mark(ptr, size) mlnx_shm_db_dirty_mark(MLNX_SHM_DB_QOS, (ptr), (size))
+#define sai_qos_db_sync()                mlnx_shm_db_flush(MLNX_SHM_DB_QOS, MS_SYNC)
+#define sai_qos_db_sync_async()          mlnx_shm_db_flush(MLNX_SHM_DB_QOS, MS_ASYNC)
+
+#define sai_buffer_db_dirty_mark(ptr, size) mlnx_shm_db_dirty_mark(MLNX_SHM_DB_BUFFER, (ptr), (size))
+#define sai_buffer_db_sync_async()          mlnx_shm_db_flush(MLNX_SHM_DB_BUFFER, MS_ASYNC)
 
 /* DB read lock is needed */
 sai_status_t mlnx_sched_hierarchy_reset(mlnx_port_config_t *port);
+/* DB write lock is needed */
+void mlnx_sched_hierarchy_child_index_update(mlnx_port_config_t *port);
 
 sai_status_t mlnx_sched_group_port_init(mlnx_port_config_t *port);
 
@@ -1748,8 +2059,12 @@ uint32_t mlnx_port_idx_get(const mlnx_port_config_t *port);
 sai_status_t mlnx_port_add(mlnx_port_config_t *port);
 sai_status_t mlnx_port_del(mlnx_port_config_t *port);
 sai_status_t mlnx_port_config_init(mlnx_port_config_t *port);
+/* DB lock is not needed, only reads the port config */
+sai_status_t mlnx_port_config_init_sdk(_In_ sx_api_handle_t handle, _In_ const mlnx_port_config_t *port);
+/* DB write lock is needed */
+sai_status_t mlnx_port_config_commit(mlnx_port_config_t *port);
 sai_status_t mlnx_port_config_uninit(mlnx_port_config_t *port);
-sai_status_t mlnx_port_speed_bitmap_apply(_In_ const mlnx_port_config_t *port);
+sai_status_t mlnx_port_speed_bitmap_apply(_In_ sx_api_handle_t handle, _In_ const mlnx_port_config_t *port);
 
 sai_status_t mlnx_port_in_use_check(const mlnx_port_config_t *port);
 bool mlnx_port_is_net(const mlnx_port_config_t *port);
@@ -1763,8 +2078,20 @@ const char * mlnx_port_type_str(const mlnx_port_config_t *port);
 /* DB read lock is needed */
 sai_status_t mlnx_switch_get_mac(sx_mac_addr_t *mac);
 
+/* DB write lock is needed */
+void mlnx_nhop_cache_add(_In_ sx_ecmp_id_t ecmp_id, _In_ const sx_next_hop_t *next_hop);
+/* DB write lock is needed */
+void mlnx_nhop_cache_del(_In_ sx_ecmp_id_t ecmp_id);
+/* Takes the DB lock, reads the SDK only if the next hop is not cached */
+sai_status_t mlnx_nhop_get_by_ecmp_id(_In_ sx_ecmp_id_t ecmp_id, _Out_ sx_next_hop_t *next_hop);
+/* Takes the DB lock, the OID of a live SAI next hop object on the container */
+sai_status_t mlnx_nhop_oid_get(_In_ sx_ecmp_id_t ecmp_id, _Out_ sai_object_id_t *next_hop_id);
+/* Takes the DB lock, fails unless the OID is a live SAI next hop object */
+sai_status_t mlnx_nhop_oid_validate(_In_ sai_object_id_t next_hop_id, _Out_opt_ sx_ecmp_id_t *sdk_ecmp_id);
+
 /* DB read lock is needed */
 sai_status_t __mlnx_wred_apply_to_port(mlnx_port_config_t *port, sai_object_id_t wred_oid);
+void mlnx_wred_port_ref_add(sai_object_id_t wred_oid, const mlnx_port_config_t *port);
 sai_status_t __mlnx_wred_apply_to_queue_idx(mlnx_port_config_t *port, uint8_t qi, sai_object_id_t wred_oid);
 
 /* DB read lock is needed */
@@ -1803,8 +2130,10 @@ typedef enum _sai_host_object_type_t {
     SAI_HOSTIF_OBJECT_TYPE_FD
 } sai_host_object_type_t;
 
-#define KV_DEVICE_MAC_ADDRESS "DEVICE_MAC_ADDRESS"
-#define KV_INITIAL_FAN_SPEED  "INITIAL_FAN_SPEED"
+#define KV_DEVICE_MAC_ADDRESS      "DEVICE_MAC_ADDRESS"
+#define KV_INITIAL_FAN_SPEED       "INITIAL_FAN_SPEED"
+#define KV_NEXT_HOP_SHARING        "NEXT_HOP_SHARING"
+#define KV_WATERMARK_POLL_INTERVAL "WATERMARK_POLL_INTERVAL"
 #define MIN_FAN_PERCENT       30
 #define MAX_FAN_PERCENT       100
 
@@ -1924,5 +2253,6 @@ void SAI_dump_tunnel(_In_ FILE *file);
 void SAI_dump_udf(_In_ FILE *file);
 void SAI_dump_vlan(_In_ FILE *file);
 void SAI_dump_wred(_In_ FILE *file);
+void SAI_dump_perf(_In_ FILE *file);
 
 #endif /* __MLNXSAI_H_ */
@@ -0,0 +1,102 @@
+/*
+ *  Copyright (C) 2017. Mellanox Technologies, Ltd. ALL RIGHTS RESERVED.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *    not use this file except in compliance with the License. You may obtain
+ *    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR
+ *    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+ *    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+ *    FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+ *
+ *    See the Apache Version 2.0 License for specific language governing
+ *    permissions and limitations under the License.
+ *
+ */
+
+#if !defined (__MLNXSAIEXT_H_)
+#define __MLNXSAIEXT_H_
+
+#include <sai.h>
+
+/*
+ * Vendor extensions of the bundled SAI headers, they follow the upstream SAI definitions
+ * and are dropped when the headers are upgraded to a version that has them.
+ */
+
+/**
+ * @brief Router interface counter IDs in sai_get_router_interface_stats() call
+ */
+typedef enum _sai_router_interface_stat_t
+{
+    /** Ingress byte stat count */
+    SAI_ROUTER_INTERFACE_STAT_IN_OCTETS,
+
+    /** Ingress packet stat count */
+    SAI_ROUTER_INTERFACE_STAT_IN_PACKETS,
+
+    /** Egress byte stat count */
+    SAI_ROUTER_INTERFACE_STAT_OUT_OCTETS,
+
+    /** Egress packet stat count */
+    SAI_ROUTER_INTERFACE_STAT_OUT_PACKETS,
+
+    /** Byte stat count for packets having errors on router ingress */
+    SAI_ROUTER_INTERFACE_STAT_IN_ERROR_OCTETS,
+
+    /** Packet stat count for packets having errors on router ingress */
+    SAI_ROUTER_INTERFACE_STAT_IN_ERROR_PACKETS,
+
+    /** Byte stat count for packets having errors on router egress */
+    SAI_ROUTER_INTERFACE_STAT_OUT_ERROR_OCTETS,
+
+    /** Packet stat count for packets having errors on router egress */
+    SAI_ROUTER_INTERFACE_STAT_OUT_ERROR_PACKETS,
+
+} sai_router_interface_stat_t;
+
+/**
+ * @brief Get router interface statistics counters.
+ *
+ * @param[in] router_interface_id Router interface id
+ * @param[in] number_of_counters Number of counters in the array
+ * @param[in] counter_ids Specifies the array of counter ids
+ * @param[out] counters Array of resulting counter values.
+ *
+ * @return #SAI_STATUS_SUCCESS on success Failure status code on error
+ */
+typedef sai_status_t (*sai_get_router_interface_stats_fn)(
+        _In_ sai_object_id_t router_interface_id,
+        _In_ uint32_t number_of_counters,
+        _In_ const sai_router_interface_stat_t *counter_ids,
+        _Out_ uint64_t *counters);
+
+/**
+ * @brief Clear router interface statistics counters.
+ *
+ * @param[in] router_interface_id Router interface id
+ * @param[in] number_of_counters Number of counters in the array
+ * @param[in] counter_ids Specifies the array of counter ids
+ *
+ * @return #SAI_STATUS_SUCCESS on success Failure status code on error
+ */
+typedef sai_status_t (*sai_clear_router_interface_stats_fn)(
+        _In_ sai_object_id_t router_interface_id,
+        _In_ uint32_t number_of_counters,
+        _In_ const sai_router_interface_stat_t *counter_ids);
+
+/**
+ * @brief Routing interface methods table with the stats methods, returned by sai_api_query()
+ * for SAI_API_ROUTER_INTERFACE. The stats methods follow the standard ones, as in the
+ * upstream sai_router_interface_api_t.
+ */
+typedef struct _mlnx_router_interface_ext_api_t
+{
+    sai_router_interface_api_t          api;
+    sai_get_router_interface_stats_fn   get_router_interface_stats;
+    sai_clear_router_interface_stats_fn clear_router_interface_stats;
+
+} mlnx_router_interface_ext_api_t;
+
+#endif /* __MLNXSAIEXT_H_ */
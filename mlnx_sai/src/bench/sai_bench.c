@@ -0,0 +1,417 @@
+/*
+ *  Copyright (C) 2017. Mellanox Technologies, Ltd. ALL RIGHTS RESERVED.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License") you may
+ *    not use this file except in compliance with the License. You may obtain
+ *    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR
+ *    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+ *    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+ *    FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+ *
+ *    See the Apache Version 2.0 License for specific language governing
+ *    permissions and limitations under the License.
+ *
+ */
+
+#include "sai_windows.h"
+#include "sai.h"
+#include "mlnx_sai.h"
+#include "assert.h"
+#include <errno.h>
+#include <time.h>
+#include <getopt.h>
+#include <arpa/inet.h>
+#include <sys/mman.h>
+#include "sx_sdk_stub.h"
+
+/*
+ *  SAI benchmark, libsai linked against the in-memory SDK stand-in (sx_sdk_stub.c).
+ *  The switch is not created through the switch API, which needs a running SDK and kernel driver. Instead the
+ *  benchmark sets up a minimal SAI DB: a private mapping with the DB lock, BENCH_PORTS present ports, the
+ *  default virtual router and a port router interface id.
+ *  Every call is timed, each case reports ops/sec, p50 and p99 latency and the SDK calls per op.
+ *  Covered: next hop, next hop group and member create/remove, IPv4 route create/remove and port stats.
+ */
+
+#define BENCH_PORTS          32
+#define BENCH_PORT_LOG_ID(i) (0x10000 + (((i) + 1) << 8))
+#define BENCH_RIF_ID         1
+#define BENCH_NHG_MEMBERS    8
+#define BENCH_COUNT_DEFAULT  10000
+#define BENCH_COUNT_MAX      30000
+
+typedef struct _bench_result_t {
+    const char *name;
+    uint32_t    count;
+    uint64_t    total_ns;
+    uint64_t    sdk_calls;
+    uint64_t   *samples;
+} bench_result_t;
+
+static sai_next_hop_api_t       *bench_next_hop_api;
+static sai_next_hop_group_api_t *bench_next_hop_group_api;
+static sai_route_api_t          *bench_route_api;
+static sai_port_api_t           *bench_port_api;
+static sai_object_id_t           bench_switch_id;
+static sai_object_id_t           bench_vr_id;
+static sai_object_id_t           bench_rif_id;
+static sai_object_id_t           bench_ports[BENCH_PORTS];
+static uint32_t                  bench_count = BENCH_COUNT_DEFAULT;
+static sai_object_id_t          *bench_next_hops;
+static sai_object_id_t          *bench_groups;
+static sai_object_id_t          *bench_members;
+static uint32_t                  bench_groups_count;
+
+static const char* bench_profile_get_value(_In_ sai_switch_profile_id_t profile_id, _In_ const char *variable)
+{
+    return NULL;
+}
+
+static int bench_profile_get_next_value(_In_ sai_switch_profile_id_t profile_id,
+                                        _Out_ const char           **variable,
+                                        _Out_ const char           **value)
+{
+    return -1;
+}
+
+static const service_method_table_t bench_services = {
+    bench_profile_get_value,
+    bench_profile_get_next_value
+};
+
+static uint64_t bench_time_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static int bench_u64_cmp(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t*)a;
+    uint64_t y = *(const uint64_t*)b;
+
+    return (x > y) - (x < y);
+}
+
+/* Minimal DB for the benchmarked paths, instead of the shared memory created by the switch init */
+static sai_status_t bench_db_init(void)
+{
+    mlnx_port_config_t *port;
+    sai_status_t        status;
+    uint32_t            ii;
+
+    g_sai_db_ptr = mmap(NULL, sizeof(*g_sai_db_ptr), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (g_sai_db_ptr == MAP_FAILED) {
+        fprintf(stderr, "Failed to map the SAI DB - %s\n", strerror(errno));
+        g_sai_db_ptr = NULL;
+        return SAI_STATUS_NO_MEMORY;
+    }
+
+    if (cl_plock_init_pshared(&g_sai_db_ptr->p_lock)) {
+        fprintf(stderr, "Failed to initialize the SAI DB rwlock\n");
+        return SAI_STATUS_FAILURE;
+    }
+
+    if (SX_STATUS_SUCCESS != sx_api_open(NULL, &gh_sdk)) {
+        fprintf(stderr, "Failed to open the SDK stub\n");
+        return SAI_STATUS_FAILURE;
+    }
+
+    for (ii = 0; ii < BENCH_PORTS; ii++) {
+        port             = &mlnx_ports_db[ii];
+        port->index      = ii;
+        port->logical    = BENCH_PORT_LOG_ID(ii);
+        port->is_present = true;
+
+        status = mlnx_create_object(SAI_OBJECT_TYPE_PORT, port->logical, NULL, &port->saiport);
+        if (SAI_ERR(status)) {
+            return status;
+        }
+        bench_ports[ii] = port->saiport;
+    }
+    g_sai_db_ptr->ports_number = BENCH_PORTS;
+
+    status = mlnx_create_object(SAI_OBJECT_TYPE_VIRTUAL_ROUTER, DEFAULT_VRID, NULL, &bench_vr_id);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+    g_sai_db_ptr->default_vrid = bench_vr_id;
+
+    status = mlnx_create_object(SAI_OBJECT_TYPE_ROUTER_INTERFACE, BENCH_RIF_ID, NULL, &bench_rif_id);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    return mlnx_create_object(SAI_OBJECT_TYPE_SWITCH, 0, NULL, &bench_switch_id);
+}
+
+static sai_status_t bench_api_init(void)
+{
+    sai_status_t status;
+    sai_api_t    api;
+
+    if (SAI_STATUS_SUCCESS != (status = sai_api_initialize(0, &bench_services))) {
+        return status;
+    }
+
+    if (SAI_STATUS_SUCCESS != (status = sai_api_query(SAI_API_NEXT_HOP, (void**)&bench_next_hop_api))) {
+        return status;
+    }
+
+    if (SAI_STATUS_SUCCESS !=
+        (status = sai_api_query(SAI_API_NEXT_HOP_GROUP, (void**)&bench_next_hop_group_api))) {
+        return status;
+    }
+
+    if (SAI_STATUS_SUCCESS != (status = sai_api_query(SAI_API_ROUTE, (void**)&bench_route_api))) {
+        return status;
+    }
+
+    if (SAI_STATUS_SUCCESS != (status = sai_api_query(SAI_API_PORT, (void**)&bench_port_api))) {
+        return status;
+    }
+
+    /* Keep the notices of every create/remove out of the measurements */
+    for (api = SAI_API_UNSPECIFIED + 1; api < SAI_API_MAX; api++) {
+        sai_log_set(api, SAI_LOG_LEVEL_ERROR);
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static void bench_route_entry(_In_ uint32_t index, _Out_ sai_route_entry_t *route_entry)
+{
+    memset(route_entry, 0, sizeof(*route_entry));
+    route_entry->switch_id               = bench_switch_id;
+    route_entry->vr_id                   = bench_vr_id;
+    route_entry->destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+    route_entry->destination.addr.ip4    = htonl(0x0a000000 + index);
+    route_entry->destination.mask.ip4    = htonl(0xffffffff);
+}
+
+static sai_status_t bench_next_hop_create(_In_ uint32_t index)
+{
+    sai_attribute_t attrs[3];
+
+    attrs[0].id                       = SAI_NEXT_HOP_ATTR_TYPE;
+    attrs[0].value.s32                = SAI_NEXT_HOP_TYPE_IP;
+    attrs[1].id                       = SAI_NEXT_HOP_ATTR_ROUTER_INTERFACE_ID;
+    attrs[1].value.oid                = bench_rif_id;
+    attrs[2].id                       = SAI_NEXT_HOP_ATTR_IP;
+    attrs[2].value.ipaddr.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+    attrs[2].value.ipaddr.addr.ip4    = htonl(0xc0a80000 + index);
+
+    return bench_next_hop_api->create_next_hop(&bench_next_hops[index], bench_switch_id, 3, attrs);
+}
+
+static sai_status_t bench_next_hop_remove(_In_ uint32_t index)
+{
+    return bench_next_hop_api->remove_next_hop(bench_next_hops[index]);
+}
+
+static sai_status_t bench_group_create(_In_ uint32_t index)
+{
+    sai_attribute_t attr;
+
+    attr.id        = SAI_NEXT_HOP_GROUP_ATTR_TYPE;
+    attr.value.s32 = SAI_NEXT_HOP_GROUP_TYPE_ECMP;
+
+    return bench_next_hop_group_api->create_next_hop_group(&bench_groups[index], bench_switch_id, 1, &attr);
+}
+
+static sai_status_t bench_group_remove(_In_ uint32_t index)
+{
+    return bench_next_hop_group_api->remove_next_hop_group(bench_groups[index]);
+}
+
+/* Members are spread over the groups, BENCH_NHG_MEMBERS per group (a few more when count is not a multiple) */
+static sai_status_t bench_member_create(_In_ uint32_t index)
+{
+    sai_attribute_t attrs[2];
+
+    attrs[0].id        = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_GROUP_ID;
+    attrs[0].value.oid = bench_groups[index % bench_groups_count];
+    attrs[1].id        = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_ID;
+    attrs[1].value.oid = bench_next_hops[index];
+
+    return bench_next_hop_group_api->create_next_hop_group_member(&bench_members[index], bench_switch_id, 2,
+                                                                  attrs);
+}
+
+static sai_status_t bench_member_remove(_In_ uint32_t index)
+{
+    return bench_next_hop_group_api->remove_next_hop_group_member(bench_members[index]);
+}
+
+static sai_status_t bench_route_create(_In_ uint32_t index)
+{
+    sai_route_entry_t route_entry;
+    sai_attribute_t   attr;
+
+    bench_route_entry(index, &route_entry);
+    attr.id        = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
+    attr.value.oid = bench_groups[index % bench_groups_count];
+
+    return bench_route_api->create_route_entry(&route_entry, 1, &attr);
+}
+
+static sai_status_t bench_route_remove(_In_ uint32_t index)
+{
+    sai_route_entry_t route_entry;
+
+    bench_route_entry(index, &route_entry);
+
+    return bench_route_api->remove_route_entry(&route_entry);
+}
+
+static sai_status_t bench_port_stats_get(_In_ uint32_t index)
+{
+    static const sai_port_stat_t ids[] = {
+        SAI_PORT_STAT_IF_IN_OCTETS,
+        SAI_PORT_STAT_IF_IN_UCAST_PKTS,
+        SAI_PORT_STAT_IF_IN_DISCARDS,
+        SAI_PORT_STAT_IF_IN_ERRORS,
+        SAI_PORT_STAT_IF_OUT_OCTETS,
+        SAI_PORT_STAT_IF_OUT_UCAST_PKTS,
+        SAI_PORT_STAT_IF_OUT_DISCARDS,
+        SAI_PORT_STAT_IF_OUT_ERRORS,
+    };
+    uint64_t counters[ARRAY_SIZE(ids)];
+
+    return bench_port_api->get_port_stats(bench_ports[index % BENCH_PORTS], ARRAY_SIZE(ids), ids, counters);
+}
+
+static sai_status_t bench_run(_In_ const char      *name,
+                              _In_ uint32_t          count,
+                              _In_ sai_status_t(*op)(_In_ uint32_t index),
+                              _Out_ bench_result_t  *result)
+{
+    sai_status_t status;
+    uint64_t     start, end, sdk_calls;
+    uint32_t     ii;
+
+    result->name    = name;
+    result->count   = count;
+    result->samples = calloc(count, sizeof(*result->samples));
+    if (NULL == result->samples) {
+        fprintf(stderr, "Failed to allocate %u samples\n", count);
+        return SAI_STATUS_NO_MEMORY;
+    }
+
+    sdk_calls        = sx_sdk_stub_calls_get();
+    result->total_ns = 0;
+
+    for (ii = 0; ii < count; ii++) {
+        start  = bench_time_ns();
+        status = op(ii);
+        end    = bench_time_ns();
+
+        if (SAI_ERR(status)) {
+            fprintf(stderr, "%s %u failed - %d\n", name, ii, status);
+            return status;
+        }
+
+        result->samples[ii] = end - start;
+        result->total_ns   += end - start;
+    }
+
+    result->sdk_calls = sx_sdk_stub_calls_get() - sdk_calls;
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static void bench_result_print(_Inout_ bench_result_t *result)
+{
+    uint64_t p50, p99;
+    double   ops_sec;
+
+    qsort(result->samples, result->count, sizeof(*result->samples), bench_u64_cmp);
+
+    p50     = result->samples[(result->count - 1) * 50 / 100];
+    p99     = result->samples[(result->count - 1) * 99 / 100];
+    ops_sec = result->total_ns ? (double)result->count * 1000000000.0 / result->total_ns : 0;
+
+    printf("%-28s %8u %12.0f %10.2f %10.2f %10.2f\n",
+           result->name, result->count, ops_sec, p50 / 1000.0, p99 / 1000.0,
+           (double)result->sdk_calls / result->count);
+}
+
+static void bench_usage(_In_ const char *prog)
+{
+    fprintf(stderr, "Usage: %s [-n count] [-l latency usec]\n", prog);
+    fprintf(stderr, "  -n  objects per case, up to %u (default %u)\n", BENCH_COUNT_MAX, BENCH_COUNT_DEFAULT);
+    fprintf(stderr, "  -l  latency added to every SDK call (default SX_SDK_STUB_LATENCY_USEC or 0)\n");
+}
+
+int main(int argc, char *argv[])
+{
+    bench_result_t results[9];
+    uint32_t       results_count = 0, ii;
+    sai_status_t   status;
+    int            opt;
+
+    while (-1 != (opt = getopt(argc, argv, "n:l:h"))) {
+        switch (opt) {
+        case 'n':
+            bench_count = strtoul(optarg, NULL, 0);
+            break;
+
+        case 'l':
+            sx_sdk_stub_latency_set(strtoul(optarg, NULL, 0));
+            break;
+
+        default:
+            bench_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if ((bench_count < BENCH_NHG_MEMBERS) || (bench_count > BENCH_COUNT_MAX)) {
+        fprintf(stderr, "Count %u is out of range [%u, %u]\n", bench_count, BENCH_NHG_MEMBERS, BENCH_COUNT_MAX);
+        return 1;
+    }
+
+    bench_groups_count = bench_count / BENCH_NHG_MEMBERS;
+    bench_next_hops    = calloc(bench_count, sizeof(*bench_next_hops));
+    bench_groups       = calloc(bench_groups_count, sizeof(*bench_groups));
+    bench_members      = calloc(bench_count, sizeof(*bench_members));
+    if (!bench_next_hops || !bench_groups || !bench_members) {
+        fprintf(stderr, "Failed to allocate the object ids\n");
+        return 1;
+    }
+
+    if (SAI_ERR(status = bench_db_init()) || SAI_ERR(status = bench_api_init())) {
+        fprintf(stderr, "Failed to set up the benchmark - %d\n", status);
+        return 1;
+    }
+
+    /* Remove cases run in the reverse order of the creates, each one needs the objects of the previous ones */
+    if (SAI_ERR(bench_run("next hop create", bench_count, bench_next_hop_create, &results[results_count++])) ||
+        SAI_ERR(bench_run("next hop group create", bench_groups_count, bench_group_create,
+                          &results[results_count++])) ||
+        SAI_ERR(bench_run("next hop group member create", bench_count, bench_member_create,
+                          &results[results_count++])) ||
+        SAI_ERR(bench_run("route create", bench_count, bench_route_create, &results[results_count++])) ||
+        SAI_ERR(bench_run("port stats get", bench_count, bench_port_stats_get, &results[results_count++])) ||
+        SAI_ERR(bench_run("route remove", bench_count, bench_route_remove, &results[results_count++])) ||
+        SAI_ERR(bench_run("next hop group member remove", bench_count, bench_member_remove,
+                          &results[results_count++])) ||
+        SAI_ERR(bench_run("next hop group remove", bench_groups_count, bench_group_remove,
+                          &results[results_count++])) ||
+        SAI_ERR(bench_run("next hop remove", bench_count, bench_next_hop_remove, &results[results_count++]))) {
+        return 1;
+    }
+
+    printf("%-28s %8s %12s %10s %10s %10s\n", "case", "ops", "ops/sec", "p50 usec", "p99 usec", "SDK/op");
+    for (ii = 0; ii < results_count; ii++) {
+        bench_result_print(&results[ii]);
+        free(results[ii].samples);
+    }
+
+    return 0;
+}
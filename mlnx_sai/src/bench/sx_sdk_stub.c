@@ -0,0 +1,345 @@
+/*
+ *  Copyright (C) 2017. Mellanox Technologies, Ltd. ALL RIGHTS RESERVED.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License") you may
+ *    not use this file except in compliance with the License. You may obtain
+ *    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR
+ *    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+ *    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+ *    FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+ *
+ *    See the Apache Version 2.0 License for specific language governing
+ *    permissions and limitations under the License.
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+#include <pthread.h>
+#include <sx/sdk/sx_api.h>
+#include <sx/sdk/sx_api_port.h>
+#include <sx/sdk/sx_api_router.h>
+#include "sx_sdk_stub.h"
+
+/*
+ *  In-memory stand-in for the SX SDK, linked into the benchmark instead of libsxapi.
+ *  The router ECMP containers are kept in memory, so the next hop and next hop group paths of libsai see
+ *  the SDK state they wrote. UC routes are only counted and the port RFC 2863 counters go up on every read.
+ *  Every other SDK, sxd and flextrum entry point referenced by libsai is a generated default stub
+ *  (sx_sdk_stub_gen.sh) which returns success and leaves the outputs as initialized by the caller.
+ *  All the stubs spin for SX_SDK_STUB_LATENCY_USEC (0 by default) to emulate the SDK round trip.
+ */
+
+#define SX_SDK_STUB_ECMP_MAX       65536
+#define SX_SDK_STUB_ECMP_PATHS_MAX 4096
+
+typedef struct _sx_sdk_stub_ecmp_t {
+    bool           is_used;
+    uint32_t       next_hop_cnt;
+    sx_next_hop_t *next_hops;
+} sx_sdk_stub_ecmp_t;
+
+static pthread_once_t     sx_sdk_stub_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t    sx_sdk_stub_lock = PTHREAD_MUTEX_INITIALIZER;
+static uint64_t           sx_sdk_stub_latency_ns;
+static uint64_t           sx_sdk_stub_calls;
+static sx_sdk_stub_ecmp_t sx_sdk_stub_ecmps[SX_SDK_STUB_ECMP_MAX];
+static uint32_t           sx_sdk_stub_ecmp_last;
+static uint64_t           sx_sdk_stub_routes;
+static uint64_t           sx_sdk_stub_counter_reads;
+
+static void sx_sdk_stub_init(void)
+{
+    const char *latency = getenv("SX_SDK_STUB_LATENCY_USEC");
+
+    if (latency) {
+        sx_sdk_stub_latency_ns = strtoull(latency, NULL, 0) * 1000;
+    }
+}
+
+static uint64_t sx_sdk_stub_time_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+void sx_sdk_stub_latency_set(uint32_t usec)
+{
+    pthread_once(&sx_sdk_stub_once, sx_sdk_stub_init);
+    sx_sdk_stub_latency_ns = (uint64_t)usec * 1000;
+}
+
+uint64_t sx_sdk_stub_calls_get(void)
+{
+    return __sync_fetch_and_add(&sx_sdk_stub_calls, 0);
+}
+
+void sx_sdk_stub_call(void)
+{
+    uint64_t start;
+
+    pthread_once(&sx_sdk_stub_once, sx_sdk_stub_init);
+    __sync_fetch_and_add(&sx_sdk_stub_calls, 1);
+
+    if (0 == sx_sdk_stub_latency_ns) {
+        return;
+    }
+
+    /* Spin rather than sleep, the SDK RPC keeps the caller busy and a sleep is too coarse for a few usec */
+    start = sx_sdk_stub_time_ns();
+    while (sx_sdk_stub_time_ns() - start < sx_sdk_stub_latency_ns) {
+    }
+}
+
+int sx_sdk_stub_default(void)
+{
+    sx_sdk_stub_call();
+
+    return SX_STATUS_SUCCESS;
+}
+
+sx_status_t sx_api_open(sx_log_cb_t logging_cb, sx_api_handle_t *handle)
+{
+    sx_sdk_stub_call();
+
+    if (NULL == handle) {
+        return SX_STATUS_PARAM_NULL;
+    }
+
+    *handle = 1;
+
+    return SX_STATUS_SUCCESS;
+}
+
+sx_status_t sx_api_close(sx_api_handle_t *handle)
+{
+    sx_sdk_stub_call();
+
+    if (NULL == handle) {
+        return SX_STATUS_PARAM_NULL;
+    }
+
+    *handle = 0;
+
+    return SX_STATUS_SUCCESS;
+}
+
+/* Stub lock is needed */
+static sx_status_t sx_sdk_stub_ecmp_fill(sx_sdk_stub_ecmp_t  *ecmp,
+                                         const sx_next_hop_t *next_hop_list_p,
+                                         uint32_t             next_hop_cnt)
+{
+    sx_next_hop_t *next_hops = NULL;
+
+    if (next_hop_cnt > SX_SDK_STUB_ECMP_PATHS_MAX) {
+        return SX_STATUS_PARAM_EXCEEDS_RANGE;
+    }
+
+    if ((0 != next_hop_cnt) && (NULL == next_hop_list_p)) {
+        return SX_STATUS_PARAM_NULL;
+    }
+
+    if (0 != next_hop_cnt) {
+        next_hops = malloc(next_hop_cnt * sizeof(*next_hops));
+        if (NULL == next_hops) {
+            return SX_STATUS_NO_MEMORY;
+        }
+        memcpy(next_hops, next_hop_list_p, next_hop_cnt * sizeof(*next_hops));
+    }
+
+    free(ecmp->next_hops);
+    ecmp->next_hops    = next_hops;
+    ecmp->next_hop_cnt = next_hop_cnt;
+
+    return SX_STATUS_SUCCESS;
+}
+
+sx_status_t sx_api_router_ecmp_set(const sx_api_handle_t handle,
+                                   const sx_access_cmd_t cmd,
+                                   sx_ecmp_id_t         *ecmp_id_p,
+                                   sx_next_hop_t        *next_hop_list_p,
+                                   uint32_t             *next_hop_cnt_p)
+{
+    sx_sdk_stub_ecmp_t *ecmp = NULL;
+    sx_status_t         status;
+    uint32_t            ii, id = 0;
+
+    sx_sdk_stub_call();
+
+    if ((NULL == ecmp_id_p) || (NULL == next_hop_cnt_p)) {
+        return SX_STATUS_PARAM_NULL;
+    }
+
+    pthread_mutex_lock(&sx_sdk_stub_lock);
+
+    switch (cmd) {
+    case SX_ACCESS_CMD_CREATE:
+        /* Id 0 is not handed out, ids are reused only after a wrap around */
+        for (ii = 1; ii < SX_SDK_STUB_ECMP_MAX; ii++) {
+            id = (sx_sdk_stub_ecmp_last + ii) % SX_SDK_STUB_ECMP_MAX;
+            if ((0 != id) && !sx_sdk_stub_ecmps[id].is_used) {
+                ecmp = &sx_sdk_stub_ecmps[id];
+                break;
+            }
+        }
+
+        if (NULL == ecmp) {
+            status = SX_STATUS_NO_RESOURCES;
+            break;
+        }
+
+        status = sx_sdk_stub_ecmp_fill(ecmp, next_hop_list_p, *next_hop_cnt_p);
+        if (SX_STATUS_SUCCESS == status) {
+            ecmp->is_used         = true;
+            sx_sdk_stub_ecmp_last = id;
+            *ecmp_id_p            = id;
+        }
+        break;
+
+    case SX_ACCESS_CMD_SET:
+    case SX_ACCESS_CMD_DESTROY:
+        if ((*ecmp_id_p >= SX_SDK_STUB_ECMP_MAX) || !sx_sdk_stub_ecmps[*ecmp_id_p].is_used) {
+            status = SX_STATUS_ENTRY_NOT_FOUND;
+            break;
+        }
+
+        ecmp = &sx_sdk_stub_ecmps[*ecmp_id_p];
+        if (SX_ACCESS_CMD_SET == cmd) {
+            status = sx_sdk_stub_ecmp_fill(ecmp, next_hop_list_p, *next_hop_cnt_p);
+            break;
+        }
+
+        free(ecmp->next_hops);
+        memset(ecmp, 0, sizeof(*ecmp));
+        status = SX_STATUS_SUCCESS;
+        break;
+
+    default:
+        status = SX_STATUS_UNSUPPORTED;
+        break;
+    }
+
+    pthread_mutex_unlock(&sx_sdk_stub_lock);
+
+    return status;
+}
+
+sx_status_t sx_api_router_ecmp_get(const sx_api_handle_t handle,
+                                   const sx_ecmp_id_t    ecmp_id,
+                                   sx_next_hop_t        *next_hop_list_p,
+                                   uint32_t             *next_hop_cnt_p)
+{
+    const sx_sdk_stub_ecmp_t *ecmp;
+    uint32_t                  count;
+
+    sx_sdk_stub_call();
+
+    if (NULL == next_hop_cnt_p) {
+        return SX_STATUS_PARAM_NULL;
+    }
+
+    pthread_mutex_lock(&sx_sdk_stub_lock);
+
+    if ((ecmp_id >= SX_SDK_STUB_ECMP_MAX) || !sx_sdk_stub_ecmps[ecmp_id].is_used) {
+        pthread_mutex_unlock(&sx_sdk_stub_lock);
+        return SX_STATUS_ENTRY_NOT_FOUND;
+    }
+
+    ecmp = &sx_sdk_stub_ecmps[ecmp_id];
+
+    /* NULL list queries the count, otherwise up to *next_hop_cnt_p next hops are returned */
+    if (NULL == next_hop_list_p) {
+        *next_hop_cnt_p = ecmp->next_hop_cnt;
+    } else {
+        count = (*next_hop_cnt_p < ecmp->next_hop_cnt) ? *next_hop_cnt_p : ecmp->next_hop_cnt;
+        if (0 != count) {
+            memcpy(next_hop_list_p, ecmp->next_hops, count * sizeof(*next_hop_list_p));
+        }
+        *next_hop_cnt_p = count;
+    }
+
+    pthread_mutex_unlock(&sx_sdk_stub_lock);
+
+    return SX_STATUS_SUCCESS;
+}
+
+sx_status_t sx_api_router_uc_route_set(const sx_api_handle_t handle,
+                                       const sx_access_cmd_t cmd,
+                                       const sx_router_id_t  vrid,
+                                       const sx_ip_prefix_t *network_addr,
+                                       sx_uc_route_data_t   *uc_route_data)
+{
+    sx_status_t status = SX_STATUS_SUCCESS;
+
+    sx_sdk_stub_call();
+
+    if (NULL == network_addr) {
+        return SX_STATUS_PARAM_NULL;
+    }
+
+    pthread_mutex_lock(&sx_sdk_stub_lock);
+
+    switch (cmd) {
+    case SX_ACCESS_CMD_ADD:
+        if (NULL == uc_route_data) {
+            status = SX_STATUS_PARAM_NULL;
+            break;
+        }
+        sx_sdk_stub_routes++;
+        break;
+
+    case SX_ACCESS_CMD_SET:
+        break;
+
+    case SX_ACCESS_CMD_DELETE:
+        if (0 == sx_sdk_stub_routes) {
+            status = SX_STATUS_ENTRY_NOT_FOUND;
+            break;
+        }
+        sx_sdk_stub_routes--;
+        break;
+
+    case SX_ACCESS_CMD_DELETE_ALL:
+        sx_sdk_stub_routes = 0;
+        break;
+
+    default:
+        status = SX_STATUS_UNSUPPORTED;
+        break;
+    }
+
+    pthread_mutex_unlock(&sx_sdk_stub_lock);
+
+    return status;
+}
+
+sx_status_t sx_api_port_counter_rfc_2863_get(const sx_api_handle_t    handle,
+                                             const sx_access_cmd_t    cmd,
+                                             const sx_port_log_id_t   log_port,
+                                             sx_port_cntr_rfc_2863_t *cntr_rfc_2863_p)
+{
+    uint64_t reads;
+
+    sx_sdk_stub_call();
+
+    if (NULL == cntr_rfc_2863_p) {
+        return SX_STATUS_PARAM_NULL;
+    }
+
+    reads = __sync_add_and_fetch(&sx_sdk_stub_counter_reads, 1);
+
+    memset(cntr_rfc_2863_p, 0, sizeof(*cntr_rfc_2863_p));
+    cntr_rfc_2863_p->if_in_ucast_pkts  = reads;
+    cntr_rfc_2863_p->if_in_octets      = reads * 64;
+    cntr_rfc_2863_p->if_out_ucast_pkts = reads;
+    cntr_rfc_2863_p->if_out_octets     = reads * 64;
+
+    return SX_STATUS_SUCCESS;
+}
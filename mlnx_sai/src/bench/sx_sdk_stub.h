@@ -0,0 +1,32 @@
+/*
+ *  Copyright (C) 2017. Mellanox Technologies, Ltd. ALL RIGHTS RESERVED.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License") you may
+ *    not use this file except in compliance with the License. You may obtain
+ *    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR
+ *    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+ *    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+ *    FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+ *
+ *    See the Apache Version 2.0 License for specific language governing
+ *    permissions and limitations under the License.
+ *
+ */
+
+#if !defined (__SX_SDK_STUB_H_)
+#define __SX_SDK_STUB_H_
+
+#include <stdint.h>
+
+/* Latency added to every stub call, overrides SX_SDK_STUB_LATENCY_USEC */
+void sx_sdk_stub_latency_set(uint32_t usec);
+/* Number of stub calls since the start, semantic and default ones */
+uint64_t sx_sdk_stub_calls_get(void);
+/* Accounts a call and spins for the configured latency */
+void sx_sdk_stub_call(void);
+/* Body of the generated default stubs (sx_sdk_stub_default.c), returns SX_STATUS_SUCCESS */
+int sx_sdk_stub_default(void);
+
+#endif /* __SX_SDK_STUB_H_ */
@@ -0,0 +1,53 @@
+#!/bin/sh
+#
+# Copyright (C) 2017. Mellanox Technologies, Ltd. ALL RIGHTS RESERVED.
+#
+#    Licensed under the Apache License, Version 2.0 (the "License") you may
+#    not use this file except in compliance with the License. You may obtain
+#    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+#
+#    THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR
+#    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+#    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+#    FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+#
+#    See the Apache Version 2.0 License for specific language governing
+#    permissions and limitations under the License.
+#
+
+# Prints the default stubs of the SX SDK, sxd and flextrum entry points which are referenced
+# by the given objects and defined by none of them (see sx_sdk_stub.c).
+# Usage: sx_sdk_stub_gen.sh <nm> <object or archive>...
+
+set -e
+
+if [ $# -lt 2 ]; then
+    echo "Usage: $0 <nm> <object or archive>..." >&2
+    exit 1
+fi
+
+NM=$1
+shift
+
+SYMS=`$NM "$@" | awk '
+    NF == 2 && $1 == "U" { undef[$2] = 1 }
+    NF == 3 && $2 ~ /^[TtWwDdBbRr]$/ { def[$3] = 1 }
+    END {
+        for (sym in undef) {
+            if (!(sym in def) && sym ~ /^(sx_api_|sx_lib_|sxd_|fx_)/) {
+                print sym
+            }
+        }
+    }' | sort`
+
+echo "/* Generated by sx_sdk_stub_gen.sh, do not edit */"
+echo ""
+echo "int sx_sdk_stub_default(void);"
+
+for sym in $SYMS; do
+    echo ""
+    echo "int $sym(void)"
+    echo "{"
+    echo "    return sx_sdk_stub_default();"
+    echo "}"
+done
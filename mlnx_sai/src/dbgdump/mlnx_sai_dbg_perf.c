@@ -0,0 +1,168 @@
+/*
+ *  Copyright (C) 2017. Mellanox Technologies, Ltd. ALL RIGHTS RESERVED.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *    not use this file except in compliance with the License. You may obtain
+ *    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR
+ *    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+ *    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+ *    FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+ *
+ *    See the Apache Version 2.0 License for specific language governing
+ *    permissions and limitations under the License.
+ *
+ */
+
+#include "mlnx_sai.h"
+#include <sx/utils/dbg_utils.h>
+#include <inttypes.h>
+#include "assert.h"
+
+static void SAI_dump_perf_getdb(_Out_ mlnx_perf_entry_t *perf_db)
+{
+    uint32_t object_type, op;
+
+    assert(NULL != perf_db);
+
+    for (object_type = SAI_OBJECT_TYPE_NULL; object_type < SAI_OBJECT_TYPE_MAX; object_type++) {
+        for (op = 0; op < MLNX_PERF_OP_MAX; op++) {
+            mlnx_perf_entry_get(object_type, op, &perf_db[object_type * MLNX_PERF_OP_MAX + op]);
+        }
+    }
+}
+
+static void SAI_dump_perf_latency_print(_In_ FILE *file, _In_ mlnx_perf_entry_t *perf_db)
+{
+    uint32_t                  object_type, op;
+    mlnx_perf_entry_t        *entry;
+    char                      type_str[LINE_LENGTH];
+    char                      op_str[LINE_LENGTH];
+    char                      sdk_str[LINE_LENGTH];
+    uint64_t                  count, failed, avg_usec, max_usec, lock_usec, sai_usec;
+    dbg_utils_table_columns_t perf_clmns[] = {
+        {"object type",     24, PARAM_STRING_E, type_str},
+        {"op",              6,  PARAM_STRING_E, op_str},
+        {"calls",           12, PARAM_UINT64_E, &count},
+        {"failed",          8,  PARAM_UINT64_E, &failed},
+        {"avg usec",        10, PARAM_UINT64_E, &avg_usec},
+        {"max usec",        10, PARAM_UINT64_E, &max_usec},
+        {"avg sai usec",    12, PARAM_UINT64_E, &sai_usec},
+        {"avg sdk usec",    12, PARAM_STRING_E, sdk_str},
+        {"avg lock usec",   13, PARAM_UINT64_E, &lock_usec},
+        {NULL,              0,  0,              NULL}
+    };
+
+    assert(NULL != perf_db);
+
+    dbg_utils_print_general_header(file, "API latency");
+
+    dbg_utils_print_secondary_header(file, "mlnx_perf_entry_t");
+
+    dbg_utils_print(file, "SDK time is partial, only instrumented SDK calls are accounted (n/a - none on the path).\n"
+                    "Not accounted SDK time is part of the SAI time.\n\n");
+
+    dbg_utils_print_table_headline(file, perf_clmns);
+
+    for (object_type = SAI_OBJECT_TYPE_NULL; object_type < SAI_OBJECT_TYPE_MAX; object_type++) {
+        for (op = 0; op < MLNX_PERF_OP_MAX; op++) {
+            entry = &perf_db[object_type * MLNX_PERF_OP_MAX + op];
+            if (0 == entry->count) {
+                continue;
+            }
+
+            snprintf(type_str, sizeof(type_str), "%s", SAI_TYPE_STR(object_type));
+            snprintf(op_str, sizeof(op_str), "%s", mlnx_perf_op_str(op));
+
+            count     = entry->count;
+            failed    = entry->failed;
+            avg_usec  = entry->total_ns / count / 1000;
+            max_usec  = entry->max_ns / 1000;
+            lock_usec = entry->lock_wait_ns / count / 1000;
+            sai_usec  = (entry->total_ns > entry->sdk_ns + entry->lock_wait_ns) ?
+                        (entry->total_ns - entry->sdk_ns - entry->lock_wait_ns) / count / 1000 : 0;
+
+            if (0 == entry->sdk_count) {
+                snprintf(sdk_str, sizeof(sdk_str), "n/a");
+            } else {
+                snprintf(sdk_str, sizeof(sdk_str), "%" PRIu64, entry->sdk_ns / count / 1000);
+            }
+
+            dbg_utils_print_table_data_line(file, perf_clmns);
+        }
+    }
+}
+
+static void SAI_dump_perf_histogram_print(_In_ FILE *file, _In_ mlnx_perf_entry_t *perf_db)
+{
+    uint32_t                  object_type, op, bucket;
+    mlnx_perf_entry_t        *entry;
+    char                      type_str[LINE_LENGTH];
+    char                      op_str[LINE_LENGTH];
+    char                      range_str[LINE_LENGTH];
+    uint64_t                  count;
+    dbg_utils_table_columns_t hist_clmns[] = {
+        {"object type",     24, PARAM_STRING_E, type_str},
+        {"op",              6,  PARAM_STRING_E, op_str},
+        {"usec",            16, PARAM_STRING_E, range_str},
+        {"calls",           12, PARAM_UINT64_E, &count},
+        {NULL,              0,  0,              NULL}
+    };
+
+    assert(NULL != perf_db);
+
+    dbg_utils_print_general_header(file, "API latency histogram");
+
+    dbg_utils_print_secondary_header(file, "mlnx_perf_entry_t.hist");
+
+    dbg_utils_print_table_headline(file, hist_clmns);
+
+    for (object_type = SAI_OBJECT_TYPE_NULL; object_type < SAI_OBJECT_TYPE_MAX; object_type++) {
+        for (op = 0; op < MLNX_PERF_OP_MAX; op++) {
+            entry = &perf_db[object_type * MLNX_PERF_OP_MAX + op];
+
+            for (bucket = 0; bucket < MLNX_PERF_HIST_BUCKETS; bucket++) {
+                if (0 == entry->hist[bucket]) {
+                    continue;
+                }
+
+                snprintf(type_str, sizeof(type_str), "%s", SAI_TYPE_STR(object_type));
+                snprintf(op_str, sizeof(op_str), "%s", mlnx_perf_op_str(op));
+
+                if (0 == bucket) {
+                    snprintf(range_str, sizeof(range_str), "< 1");
+                } else if (MLNX_PERF_HIST_BUCKETS - 1 == bucket) {
+                    snprintf(range_str, sizeof(range_str), ">= %u", 1U << (bucket - 1));
+                } else {
+                    snprintf(range_str, sizeof(range_str), "%u - %u", 1U << (bucket - 1), 1U << bucket);
+                }
+
+                count = entry->hist[bucket];
+
+                dbg_utils_print_table_data_line(file, hist_clmns);
+            }
+        }
+    }
+}
+
+void SAI_dump_perf(_In_ FILE *file)
+{
+    mlnx_perf_entry_t *perf_db = NULL;
+
+    perf_db = (mlnx_perf_entry_t*)calloc(SAI_OBJECT_TYPE_MAX * MLNX_PERF_OP_MAX, sizeof(mlnx_perf_entry_t));
+
+    if (!perf_db) {
+        return;
+    }
+
+    SAI_dump_perf_getdb(perf_db);
+
+    dbg_utils_print_module_header(file, "SAI API Perf");
+
+    SAI_dump_perf_latency_print(file, perf_db);
+
+    SAI_dump_perf_histogram_print(file, perf_db);
+
+    free(perf_db);
+}
@@ -6959,7 +6959,7 @@ static sai_status_t mlnx_acl_entry_action_set(_In_ const sai_object_key_t      *
                 goto out;
             }
 
-            /* cl_plock_acquire(&g_sai_db_ptr->p_lock); */
+            /* sai_db_read_lock(); */
             status = mlnx_sai_get_or_create_regular_sx_policer_for_bind(
                         value->aclaction.parameter.oid,
                         false,
@@ -6968,10 +6968,10 @@ static sai_status_t mlnx_acl_entry_action_set(_In_ const sai_object_key_t      *
             if (SAI_STATUS_SUCCESS != status) {
                 SX_LOG_ERR("Failed to obtain sx_policer_id. input sai policer object_id:0x%" PRIx64 "\n",
                            value->aclaction.parameter.oid);
-                /* cl_plock_release(&g_sai_db_ptr->p_lock); */
+                /* sai_db_unlock(); */
                 goto out;
             }
-            /*cl_plock_release(&g_sai_db_ptr->p_lock); */
+            /*sai_db_unlock(); */
             flex_acl_rule.action_list_p[flex_action_index].type = SX_FLEX_ACL_ACTION_POLICER;
         }
         break;
@@ -7961,10 +7961,10 @@ static sai_status_t mlnx_acl_range_attr_get(_In_ const sai_object_key_t   *key,
  *    Failure status code on error
  */
 
-sai_status_t mlnx_create_acl_entry(_Out_ sai_object_id_t     * acl_entry_id,
-                                   _In_ sai_object_id_t        switch_id,
-                                   _In_ uint32_t               attr_count,
-                                   _In_ const sai_attribute_t *attr_list)
+static sai_status_t mlnx_create_acl_entry_impl(_Out_ sai_object_id_t     * acl_entry_id,
+                                               _In_ sai_object_id_t        switch_id,
+                                               _In_ uint32_t               attr_count,
+                                               _In_ const sai_attribute_t *attr_list)
 {
     sai_status_t                 status;
     sx_flex_acl_flex_rule_t      flex_acl_rule = MLNX_ACL_SX_FLEX_RULE_EMPTY;
@@ -8545,7 +8545,7 @@ sai_status_t mlnx_create_acl_entry(_Out_ sai_object_id_t     * acl_entry_id,
                 goto out;
             }
 
-            /* cl_plock_acquire(&g_sai_db_ptr->p_lock); */
+            /* sai_db_read_lock(); */
             if (SAI_STATUS_SUCCESS != (status = mlnx_sai_get_or_create_regular_sx_policer_for_bind(
                                            action_set_policer->aclaction.parameter.oid,
                                            false,
@@ -8553,10 +8553,10 @@ sai_status_t mlnx_create_acl_entry(_Out_ sai_object_id_t     * acl_entry_id,
                                            policer_id))) {
                 SX_LOG_ERR("Failed to obtain sx_policer_id. input sai policer object_id:0x%" PRIx64 "\n",
                            action_set_policer->aclaction.parameter.oid);
-                /*  cl_plock_release(&g_sai_db_ptr->p_lock); */
+                /*  sai_db_unlock(); */
                 goto out;
             }
-            /* cl_plock_release(&g_sai_db_ptr->p_lock); */
+            /* sai_db_unlock(); */
 
             flex_acl_rule.action_list_p[flex_action_index].type = SX_FLEX_ACL_ACTION_POLICER;
             flex_action_index++;
@@ -8799,6 +8799,20 @@ out:
     return status;
 }
 
+sai_status_t mlnx_create_acl_entry(_Out_ sai_object_id_t     * acl_entry_id,
+                                   _In_ sai_object_id_t        switch_id,
+                                   _In_ uint32_t               attr_count,
+                                   _In_ const sai_attribute_t *attr_list)
+{
+    sai_status_t status;
+
+    mlnx_perf_op_begin(SAI_OBJECT_TYPE_ACL_ENTRY, MLNX_PERF_OP_CREATE);
+    status = mlnx_create_acl_entry_impl(acl_entry_id, switch_id, attr_count, attr_list);
+    mlnx_perf_op_end(status);
+
+    return status;
+}
+
 /*
  * Routine Description:
  *   Create an ACL table
@@ -9358,6 +9372,8 @@ static sai_status_t mlnx_acl_counter_set(_In_ const sai_object_key_t      *key,
             status = sdk_to_sai(sx_status);
             goto out;
         }
+
+        mlnx_counter_collector_invalidate();
     }
 
 out:
@@ -9391,11 +9407,13 @@ static sai_status_t mlnx_acl_counter_get(_In_ const sai_object_key_t   *key,
 
     counter_id = sai_acl_db->acl_counter_db[acl_counter_index].counter_id;
 
-    sx_status = sx_api_flow_counter_get(gh_sdk, SX_ACCESS_CMD_READ, counter_id, &counter_value);
-    if (SX_STATUS_SUCCESS != sx_status) {
-        SX_LOG_ERR(" Failure to get counter in SDK - %s \n", SX_STATUS_MSG(sx_status));
-        status = sdk_to_sai(sx_status);
-        goto out;
+    if (!mlnx_counter_acl_get(acl_counter_index, counter_id, &counter_value)) {
+        sx_status = sx_api_flow_counter_get(gh_sdk, SX_ACCESS_CMD_READ, counter_id, &counter_value);
+        if (SX_STATUS_SUCCESS != sx_status) {
+            SX_LOG_ERR(" Failure to get counter in SDK - %s \n", SX_STATUS_MSG(sx_status));
+            status = sdk_to_sai(sx_status);
+            goto out;
+        }
     }
 
     switch ((int64_t)arg) {
@@ -9414,6 +9432,46 @@ out:
     return status;
 }
 
+/*
+ * Reads all the valid ACL counters for the counter collector, ordered by the DB index.
+ * Only the SX ids are taken under the ACL lock, the counters are read from SDK after it's released.
+ * A counter that fails to read is marked invalid, the rest are still read.
+ */
+void mlnx_acl_counters_read(_In_ sx_api_handle_t            handle,
+                            _Out_ mlnx_acl_counter_value_t *values,
+                            _In_ uint32_t                   max_count,
+                            _Out_ uint32_t                 *count)
+{
+    sx_status_t sx_status;
+    uint32_t    ii, values_count = 0;
+
+    *count = 0;
+
+    if (NULL == sai_acl_db) {
+        return;
+    }
+
+    acl_global_lock();
+    for (ii = 0; (ii < ACL_MAX_COUNTER_NUM) && (values_count < max_count); ii++) {
+        if (sai_acl_db->acl_counter_db[ii].is_valid) {
+            values[values_count].index      = ii;
+            values[values_count].counter_id = sai_acl_db->acl_counter_db[ii].counter_id;
+            values_count++;
+        }
+    }
+    acl_global_unlock();
+
+    for (ii = 0; ii < values_count; ii++) {
+        sx_status = sx_api_flow_counter_get(handle, SX_ACCESS_CMD_READ, values[ii].counter_id, &values[ii].value);
+        values[ii].is_valid = (SX_STATUS_SUCCESS == sx_status);
+        if (!values[ii].is_valid) {
+            SX_LOG_ERR("Failed to get ACL counter %u - %s\n", values[ii].counter_id, SX_STATUS_MSG(sx_status));
+        }
+    }
+
+    *count = values_count;
+}
+
 static sai_status_t db_find_acl_counter_free_index(_Out_ uint32_t *free_index)
 {
     uint32_t     ii;
@@ -9666,7 +9724,7 @@ static sai_status_t mlnx_get_acl_entry_attribute(_In_ sai_object_id_t   acl_entr
  *       SAI_STATUS_SUCCESS on success
  *       Failure status code on error
  **/
-static sai_status_t mlnx_delete_acl_entry(_In_ sai_object_id_t acl_entry_id)
+static sai_status_t mlnx_delete_acl_entry_impl(_In_ sai_object_id_t acl_entry_id)
 {
     sai_status_t               status;
     char                       key_str[MAX_KEY_STR_LEN];
@@ -9710,6 +9768,17 @@ out:
     return status;
 }
 
+static sai_status_t mlnx_delete_acl_entry(_In_ sai_object_id_t acl_entry_id)
+{
+    sai_status_t status;
+
+    mlnx_perf_op_begin(SAI_OBJECT_TYPE_ACL_ENTRY, MLNX_PERF_OP_REMOVE);
+    status = mlnx_delete_acl_entry_impl(acl_entry_id);
+    mlnx_perf_op_end(status);
+
+    return status;
+}
+
 /*
  * Routine Description:
  *   Delete an ACL table
@@ -10057,7 +10126,8 @@ static sai_status_t mlnx_acl_entry_sx_acl_rule_set(_In_ uint32_t
     sx_region_id   = acl_db_table(acl_table_index).region_id;
     sx_rule_offset = acl_db_entry(acl_entry_index).offset;
 
-    sx_status = sx_api_acl_flex_rules_set(gh_sdk, SX_ACCESS_CMD_SET, sx_region_id, &sx_rule_offset, sx_flex_rule, 1);
+    sx_status = MLNX_PERF_SDK_CALL(sx_api_acl_flex_rules_set(gh_sdk, SX_ACCESS_CMD_SET, sx_region_id, &sx_rule_offset,
+                                                             sx_flex_rule, 1));
     if (SX_ERR(sx_status)) {
         SX_LOG_ERR("Failed to set ACL rule - %s.\n", SX_STATUS_MSG(sx_status));
         return sdk_to_sai(sx_status);
@@ -10088,7 +10158,8 @@ static sai_status_t mlnx_acl_flex_rule_delete(_In_ uint32_t             acl_tabl
 
     sx_flex_rule.valid  = false;
 
-    sx_status = sx_api_acl_flex_rules_set(gh_sdk, SX_ACCESS_CMD_DELETE, sx_region_id, &sx_acl_rule_offset, &sx_flex_rule, 1);
+    sx_status = MLNX_PERF_SDK_CALL(sx_api_acl_flex_rules_set(gh_sdk, SX_ACCESS_CMD_DELETE, sx_region_id,
+                                                             &sx_acl_rule_offset, &sx_flex_rule, 1));
     if (SX_ERR(sx_status)) {
         SX_LOG_ERR("Failed to set ACL rule - %s.\n", SX_STATUS_MSG(sx_status));
         status = sdk_to_sai(sx_status);
@@ -13876,7 +13947,8 @@ static sai_status_t mlnx_acl_table_set_def_rule(_In_ uint32_t src_table_index, _
         default_rule.action_list_p[0].fields.action_goto.acl_group_id    = sx_target_group_id;
     }
 
-    sx_status = sx_api_acl_flex_rules_set(gh_sdk, SX_ACCESS_CMD_SET, region_id, &rule_offset, &default_rule, 1);
+    sx_status = MLNX_PERF_SDK_CALL(sx_api_acl_flex_rules_set(gh_sdk, SX_ACCESS_CMD_SET, region_id, &rule_offset,
+                                                             &default_rule, 1));
     if (SX_STATUS_SUCCESS != sx_status) {
         SX_LOG_ERR("Failed to set ACL rule - %s.\n", SX_STATUS_MSG(sx_status));
         status = sdk_to_sai(sx_status);
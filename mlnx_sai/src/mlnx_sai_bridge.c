@@ -1924,6 +1924,10 @@ static sai_status_t mlnx_create_bridge_port(_Out_ sai_object_id_t     * bridge_p
             goto out;
         }
 
+        if (SAI_ERR(mlnx_rif_sx_counter_attach(bridge_rif->rif_id))) {
+            SX_LOG_WRN("Bridge router interface %u is created without counters\n", bridge_rif->rif_id);
+        }
+
         sx_status = sx_api_router_interface_state_set(gh_sdk, bridge_rif->rif_id, &bridge_rif->intf_state);
         if (SX_ERR(sx_status)) {
             SX_LOG_ERR("Failed to set bridge router interface state - %s.\n", SX_STATUS_MSG(sx_status));
@@ -1979,6 +1983,7 @@ out:
         }
     }
 
+    sai_db_sync_async();
     sai_db_unlock();
     SX_LOG_EXIT();
     return status;
@@ -2059,6 +2064,11 @@ static sai_status_t mlnx_remove_bridge_port(_In_ sai_object_id_t bridge_port_id)
             goto out;
         }
 
+        status = mlnx_rif_sx_counter_detach(bridge_rif->rif_id);
+        if (SAI_ERR(status)) {
+            goto out;
+        }
+
         status = sx_api_router_interface_set(gh_sdk, SX_ACCESS_CMD_DELETE, bridge_rif->vrf_id,
                                              &bridge_rif->intf_params, &bridge_rif->intf_attribs,
                                              &bridge_rif->rif_id);
@@ -2084,6 +2094,7 @@ static sai_status_t mlnx_remove_bridge_port(_In_ sai_object_id_t bridge_port_id)
     }
 
 out:
+    sai_db_sync_async();
     sai_db_unlock();
     SX_LOG_EXIT();
     return status;
@@ -58,6 +58,12 @@ typedef struct _mlnx_affect_port_buff_items {
     bool   * e_port_buffers;
 } mlnx_affect_port_buff_items_t;
 
+/* Buffers of one port affected by a buffer profile change */
+typedef struct _mlnx_buffer_port_change {
+    uint32_t                      db_port_ind;
+    mlnx_affect_port_buff_items_t affected_items;
+} mlnx_buffer_port_change_t;
+
 static sai_status_t mlnx_get_sai_pool_data(_In_ sai_object_id_t               sai_pool,
                                            _Out_ mlnx_sai_buffer_pool_attr_t* sai_pool_attr);
 static sai_status_t mlnx_sai_buffer_unbind_shared_buffers(_In_ sx_port_log_id_t log_port);
@@ -75,8 +81,9 @@ static sai_status_t mlnx_sai_buffer_configure_reserved_buffers(_In_ sx_port_log_
 static sai_status_t mlnx_sai_buffer_configure_shared_buffers(_In_ sx_port_log_id_t                   logical_port,
                                                              _Out_ sx_cos_port_shared_buffer_attr_t* sx_port_shared_buff_attr_arr,
                                                              _In_ uint32_t                           count);
-static sai_status_t mlnx_sai_buffer_apply_buffer_change_to_references(_In_ sai_object_id_t sai_buffer_id,
-                                                                      _In_ sai_object_id_t prev_pool);
+static sai_status_t mlnx_sai_buffer_apply_buffer_change_to_references(
+    _In_ sai_object_id_t                           sai_buffer_id,
+    _In_ const mlnx_sai_db_buffer_profile_entry_t *prev_entry);
 static sai_status_t mlnx_sai_buffer_apply_buffer_to_queue(_In_ uint32_t                           qos_db_port_ind,
                                                           _In_ uint32_t                           qos_ind,
                                                           _In_ mlnx_sai_db_buffer_profile_entry_t buff_db_entry,
@@ -416,6 +423,25 @@ static sai_status_t mlnx_sai_buffer_set_pool_raise_triggered_flag()
     return SAI_STATUS_SUCCESS;
 }
 
+/* Called under sai db lock */
+static bool mlnx_sai_buffer_pool_is_allocated(_In_ uint32_t sx_pool_id)
+{
+    const mlnx_sai_buffer_resource_limits_t *limits = mlnx_sai_get_buffer_resource_limits();
+
+    if ((sx_pool_id >= BASE_INGRESS_USER_SX_POOL_ID) &&
+        (sx_pool_id < BASE_INGRESS_USER_SX_POOL_ID + limits->num_ingress_pools)) {
+        return g_sai_buffer_db_ptr->pool_allocation[1 + sx_pool_id - BASE_INGRESS_USER_SX_POOL_ID];
+    }
+
+    if ((sx_pool_id >= BASE_EGRESS_USER_SX_POOL_ID) &&
+        (sx_pool_id < BASE_EGRESS_USER_SX_POOL_ID + limits->num_egress_pools)) {
+        return g_sai_buffer_db_ptr->pool_allocation[1 + limits->num_ingress_pools +
+                                                    sx_pool_id - BASE_EGRESS_USER_SX_POOL_ID];
+    }
+
+    return false;
+}
+
 #define max_value(x, y) ((x > y) ? x : y)
 
 uint32_t mlnx_cells_to_bytes(uint32_t cells)
@@ -968,10 +994,10 @@ static sai_status_t pg_profile_set(uint32_t db_port_index, uint32_t port_pg_ind,
         SX_LOG_EXIT();
         return sai_status;
     }
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_write_lock();
     if (SAI_STATUS_SUCCESS !=
         (sai_status = mlnx_sai_get_port_buffer_index_array(db_port_index, PORT_BUFF_TYPE_PG, &port_pg_profile_refs))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
@@ -992,7 +1018,7 @@ static sai_status_t pg_profile_set(uint32_t db_port_index, uint32_t port_pg_ind,
         }
         if (SAI_STATUS_SUCCESS !=
             (sai_status = mlnx_sai_buffer_apply_buffer_to_pg(db_port_index, port_pg_ind, buff_db_entry, prev_pool))) {
-            cl_plock_release(&g_sai_db_ptr->p_lock);
+            sai_db_unlock();
             SX_LOG_EXIT();
             return sai_status;
         }
@@ -1000,7 +1026,7 @@ static sai_status_t pg_profile_set(uint32_t db_port_index, uint32_t port_pg_ind,
     } else {
         if (SAI_STATUS_SUCCESS !=
             (sai_status = mlnx_get_sai_buffer_profile_data(profile, &input_db_buffer_profile_index, &sai_pool_attr))) {
-            cl_plock_release(&g_sai_db_ptr->p_lock);
+            sai_db_unlock();
             SX_LOG_EXIT();
             return sai_status;
         }
@@ -1014,7 +1040,7 @@ static sai_status_t pg_profile_set(uint32_t db_port_index, uint32_t port_pg_ind,
                 g_sai_buffer_db_ptr->buffer_profiles[input_db_buffer_profile_index].sai_pool,
                 db_port_index,
                 port_pg_ind);
-            cl_plock_release(&g_sai_db_ptr->p_lock);
+            sai_db_unlock();
             SX_LOG_EXIT();
             return SAI_STATUS_INVALID_PARAMETER;
         }
@@ -1043,7 +1069,7 @@ static sai_status_t pg_profile_set(uint32_t db_port_index, uint32_t port_pg_ind,
         }
         if (SAI_STATUS_SUCCESS !=
             (sai_status = mlnx_sai_buffer_apply_buffer_to_pg(db_port_index, port_pg_ind, buff_db_entry, prev_pool))) {
-            cl_plock_release(&g_sai_db_ptr->p_lock);
+            sai_db_unlock();
             SX_LOG_EXIT();
             return sai_status;
         }
@@ -1051,8 +1077,9 @@ static sai_status_t pg_profile_set(uint32_t db_port_index, uint32_t port_pg_ind,
         SX_LOG_DBG("Logging newly set buffer profile\n");
         log_sai_buffer_profile_db_entry(input_db_buffer_profile_index);
     }
-    msync(g_sai_db_ptr, sizeof(*g_sai_db_ptr), MS_SYNC);
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_buffer_db_dirty_mark(&port_pg_profile_refs[port_pg_ind], sizeof(port_pg_profile_refs[port_pg_ind]));
+    sai_buffer_db_sync_async();
+    sai_db_unlock();
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
@@ -1135,10 +1162,10 @@ static sai_status_t mlnx_sai_get_ingress_priority_group_buffer_profile_attr(_In_
         return sai_status;
     }
 
-    cl_plock_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_read_lock();
     if (SAI_STATUS_SUCCESS !=
         (sai_status = mlnx_sai_get_port_buffer_index_array(db_port_index, PORT_BUFF_TYPE_PG, &port_pg_profile_refs))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
@@ -1148,12 +1175,12 @@ static sai_status_t mlnx_sai_get_ingress_priority_group_buffer_profile_attr(_In_
     } else {
         if (SAI_STATUS_SUCCESS !=
             (sai_status = mlnx_create_object(SAI_OBJECT_TYPE_BUFFER_PROFILE, pg_buffer_db_ind, NULL, &value->oid))) {
-            cl_plock_release(&g_sai_db_ptr->p_lock);
+            sai_db_unlock();
             SX_LOG_EXIT();
             return sai_status;
         }
     }
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_unlock();
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
@@ -1621,18 +1648,18 @@ static sai_status_t mlnx_sai_create_buffer_pool(_Out_ sai_object_id_t     * pool
     sx_pool_attr.pool_size = bytes_to_mlnx_cells(pool_size);
     SX_LOG_DBG("Input bytes:%d, cells:%d\n", pool_size, sx_pool_attr.pool_size);
 
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_write_lock();
     pool_creation_triggered = mlnx_sai_buffer_get_pool_create_triggered_flag();
     if (!pool_creation_triggered) {
         SX_LOG_NTC(
             "First call to create pool. Will delete all existing pools and buffers before creating new pool now\n");
         if (SAI_STATUS_SUCCESS != (sai_status = mlnx_sai_cleanup_buffer_config())) {
-            cl_plock_release(&g_sai_db_ptr->p_lock);
+            sai_db_unlock();
             SX_LOG_EXIT();
             return sai_status;
         }
         if (SAI_STATUS_SUCCESS != (sai_status = mlnx_sai_buffer_set_pool_raise_triggered_flag())) {
-            cl_plock_release(&g_sai_db_ptr->p_lock);
+            sai_db_unlock();
             SX_LOG_EXIT();
             return sai_status;
         }
@@ -1640,11 +1667,11 @@ static sai_status_t mlnx_sai_create_buffer_pool(_Out_ sai_object_id_t     * pool
     if (SX_STATUS_SUCCESS !=
         (sx_status = sx_api_cos_shared_buff_pool_set(gh_sdk, SX_ACCESS_CMD_CREATE, &sx_pool_attr, &sx_pool_id))) {
         SX_LOG_ERR("Pool creation failed. sx_status:%d, message %s.\n", sx_status, SX_STATUS_MSG(sx_status));
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         return sdk_to_sai(sx_status);
     }
     if (SAI_STATUS_SUCCESS != (sai_status = mlnx_create_sai_pool_id(sx_pool_id, &sai_pool))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
@@ -1661,8 +1688,11 @@ static sai_status_t mlnx_sai_create_buffer_pool(_Out_ sai_object_id_t     * pool
                                              sx_pool_id - BASE_EGRESS_USER_SX_POOL_ID] = true;
     }
     *pool_id = sai_pool;
-    msync(g_sai_db_ptr, sizeof(*g_sai_db_ptr), MS_SYNC);
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_buffer_db_dirty_mark(g_sai_buffer_db_ptr->pool_allocation,
+                             sizeof(bool) * (1 + mlnx_sai_get_buffer_resource_limits()->num_ingress_pools +
+                                             mlnx_sai_get_buffer_resource_limits()->num_egress_pools));
+    sai_buffer_db_sync_async();
+    sai_db_unlock();
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
@@ -1676,9 +1706,9 @@ static sai_status_t mlnx_sai_remove_buffer_pool(_In_ sai_object_id_t pool_id)
 
     SX_LOG_ENTER();
     memset(&sx_pool_attr, 0, sizeof(sx_cos_pool_attr_t));
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_write_lock();
     if (SAI_STATUS_SUCCESS != (sai_status = mlnx_get_sai_pool_data(pool_id, &sai_pool_attr))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
@@ -1687,7 +1717,7 @@ static sai_status_t mlnx_sai_remove_buffer_pool(_In_ sai_object_id_t pool_id)
         (sx_status = sx_api_cos_shared_buff_pool_set(gh_sdk, SX_ACCESS_CMD_DESTROY, &sx_pool_attr,
                                                      &sai_pool_attr.sx_pool_id))) {
         SX_LOG_ERR("Failed to destroy sx pool, sx_status:%d, message %s.\n", sx_status, SX_STATUS_MSG(sx_status));
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         SX_LOG_EXIT();
         return sdk_to_sai(sx_status);
     }
@@ -1699,8 +1729,11 @@ static sai_status_t mlnx_sai_remove_buffer_pool(_In_ sai_object_id_t pool_id)
                                              sai_pool_attr.sx_pool_id - BASE_EGRESS_USER_SX_POOL_ID] = false;
     }
 
-    msync(g_sai_db_ptr, sizeof(*g_sai_db_ptr), MS_SYNC);
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_buffer_db_dirty_mark(g_sai_buffer_db_ptr->pool_allocation,
+                             sizeof(bool) * (1 + mlnx_sai_get_buffer_resource_limits()->num_ingress_pools +
+                                             mlnx_sai_get_buffer_resource_limits()->num_egress_pools));
+    sai_buffer_db_sync_async();
+    sai_db_unlock();
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
@@ -1752,13 +1785,13 @@ static sai_status_t mlnx_sai_get_pool_size_attr(_In_ const sai_object_key_t   *
     mlnx_sai_buffer_pool_attr_t sai_pool_attr;
 
     SX_LOG_ENTER();
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_write_lock();
     if (SAI_STATUS_SUCCESS != (sai_status = mlnx_get_sai_pool_data(key->key.object_id, &sai_pool_attr))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_unlock();
     value->u32 = sai_pool_attr.pool_size;
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
@@ -1954,10 +1987,10 @@ static sai_status_t mlnx_sai_get_pool_shared_size_attr(_In_ const sai_object_key
         SX_LOG_EXIT();
         return SAI_STATUS_NO_MEMORY;
     }
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_write_lock();
     sai_status =
         mlnx_sai_buffer_compute_shared_size(key->key.object_id, sx_port_reserved_buff_attr_arr, count, &(value->u32));
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_unlock();
     free(sx_port_reserved_buff_attr_arr);
     SX_LOG_EXIT();
     return sai_status;
@@ -1974,14 +2007,14 @@ static sai_status_t mlnx_sai_get_pool_type_attr(_In_ const sai_object_key_t   *
     mlnx_sai_buffer_pool_attr_t sai_pool_attr;
 
     SX_LOG_ENTER();
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_write_lock();
     if (SAI_STATUS_SUCCESS != (sai_status = mlnx_get_sai_pool_data(key->key.object_id, &sai_pool_attr))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
     value->s32 = sai_pool_attr.pool_type;
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_unlock();
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
@@ -1998,14 +2031,14 @@ static sai_status_t mlnx_sai_get_pool_th_mode_attr(_In_ const sai_object_key_t
     mlnx_sai_buffer_pool_attr_t sai_pool_attr;
 
     SX_LOG_ENTER();
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_write_lock();
     if (SAI_STATUS_SUCCESS != (sai_status = mlnx_get_sai_pool_data(key->key.object_id, &sai_pool_attr))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
     value->s32 = sai_pool_attr.pool_mode;
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_unlock();
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
@@ -2034,7 +2067,7 @@ static sai_status_t db_buffer_profile_reserve_entry(_Out_ uint32_t* buff_profile
     uint32_t     buff_profile_db_cnt = mlnx_sai_get_buffer_profile_number();
 
     SX_LOG_ENTER();
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_write_lock();
     for (buff_profile_db_ind = SENTINEL_BUFFER_DB_ENTRY_INDEX + 1;
          buff_profile_db_ind < buff_profile_db_cnt;
          buff_profile_db_ind++) {
@@ -2044,12 +2077,14 @@ static sai_status_t db_buffer_profile_reserve_entry(_Out_ uint32_t* buff_profile
     }
     if (buff_profile_db_ind == buff_profile_db_cnt) {
         SX_LOG_ERR("Buffer profile db full\n");
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         return SAI_STATUS_TABLE_FULL;
     }
     g_sai_buffer_db_ptr->buffer_profiles[buff_profile_db_ind].is_valid = true;
-    msync(g_sai_db_ptr, sizeof(*g_sai_db_ptr), MS_SYNC);
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_buffer_db_dirty_mark(&g_sai_buffer_db_ptr->buffer_profiles[buff_profile_db_ind],
+                             sizeof(g_sai_buffer_db_ptr->buffer_profiles[buff_profile_db_ind]));
+    sai_buffer_db_sync_async();
+    sai_db_unlock();
 
     *buff_profile_db_ind_out = buff_profile_db_ind;
     SX_LOG_DBG("Reserved buffer profile db item_ind:0x%X\n", buff_profile_db_ind);
@@ -2096,13 +2131,13 @@ static sai_status_t mlnx_sai_create_buffer_profile(_Out_ sai_object_id_t     * b
     sai_status = find_attrib_in_list(attr_count, attr_list, SAI_BUFFER_PROFILE_ATTR_POOL_ID, &attr, &attr_ind);
     assert(SAI_STATUS_SUCCESS == sai_status);
 
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_write_lock();
     if (SAI_STATUS_SUCCESS != (sai_status = mlnx_get_sai_pool_data(attr->oid, &sai_pool_attr))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_unlock();
 
     new_buffer_profile.sai_pool = attr->oid;
     sai_status                  = find_attrib_in_list(attr_count, attr_list, SAI_BUFFER_PROFILE_ATTR_BUFFER_SIZE,
@@ -2182,11 +2217,13 @@ static sai_status_t mlnx_sai_create_buffer_profile(_Out_ sai_object_id_t     * b
         SX_LOG_EXIT();
         return sai_status;
     }
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_write_lock();
     new_buffer_profile.is_valid                               = true;
     g_sai_buffer_db_ptr->buffer_profiles[buff_profile_db_ind] = new_buffer_profile;
-    msync(g_sai_db_ptr, sizeof(*g_sai_db_ptr), MS_SYNC);
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_buffer_db_dirty_mark(&g_sai_buffer_db_ptr->buffer_profiles[buff_profile_db_ind],
+                             sizeof(g_sai_buffer_db_ptr->buffer_profiles[buff_profile_db_ind]));
+    sai_buffer_db_sync_async();
+    sai_db_unlock();
     if (SAI_STATUS_SUCCESS !=
         (sai_status =
              mlnx_create_object(SAI_OBJECT_TYPE_BUFFER_PROFILE, buff_profile_db_ind, NULL, buffer_profile_id))) {
@@ -2212,15 +2249,15 @@ static sai_status_t mlnx_sai_remove_buffer_profile(_In_ sai_object_id_t buffer_p
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_write_lock();
     if (SAI_STATUS_SUCCESS !=
         (sai_status = mlnx_get_sai_buffer_profile_data(buffer_profile_id, &db_buffer_profile_index, NULL))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
     if (SAI_STATUS_SUCCESS != (sai_status = mlnx_sai_is_buffer_in_use(buffer_profile_id))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
@@ -2228,8 +2265,10 @@ static sai_status_t mlnx_sai_remove_buffer_profile(_In_ sai_object_id_t buffer_p
     memset(&g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index],
            0,
            sizeof(mlnx_sai_db_buffer_profile_entry_t));
-    msync(g_sai_db_ptr, sizeof(*g_sai_db_ptr), MS_SYNC);
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_buffer_db_dirty_mark(&g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index],
+                             sizeof(g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index]));
+    sai_buffer_db_sync_async();
+    sai_db_unlock();
 
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
@@ -2247,16 +2286,16 @@ static sai_status_t mlnx_sai_get_buffer_profile_pool_id_attr(_In_ const sai_obje
     mlnx_sai_buffer_pool_attr_t sai_pool_attr;
 
     SX_LOG_ENTER();
-    cl_plock_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_read_lock();
     if (SAI_STATUS_SUCCESS !=
         (sai_status =
              mlnx_get_sai_buffer_profile_data(key->key.object_id, &db_buffer_profile_index, &sai_pool_attr))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
     value->oid = g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index].sai_pool;
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_unlock();
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
@@ -2267,24 +2306,24 @@ static sai_status_t mlnx_sai_set_buffer_profile_pool_id_attr(_In_ const sai_obje
                                                              _In_ const sai_attribute_value_t * value,
                                                              void                             * arg)
 {
-    char                        key_str[MAX_KEY_STR_LEN];
-    sai_status_t                sai_status;
-    mlnx_sai_buffer_pool_attr_t cur_sai_pool_attr;
-    mlnx_sai_buffer_pool_attr_t new_sai_pool_attr;
-    uint32_t                    db_buffer_profile_index;
-    sai_object_id_t             prev_pool = SAI_NULL_OBJECT_ID;
+    char                               key_str[MAX_KEY_STR_LEN];
+    sai_status_t                       sai_status;
+    mlnx_sai_buffer_pool_attr_t        cur_sai_pool_attr;
+    mlnx_sai_buffer_pool_attr_t        new_sai_pool_attr;
+    uint32_t                           db_buffer_profile_index;
+    mlnx_sai_db_buffer_profile_entry_t prev_entry;
 
     SX_LOG_ENTER();
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_write_lock();
     if (SAI_STATUS_SUCCESS !=
         (sai_status =
              mlnx_get_sai_buffer_profile_data(key->key.object_id, &db_buffer_profile_index, &cur_sai_pool_attr))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
     if (SAI_STATUS_SUCCESS != (sai_status = mlnx_get_sai_pool_data(value->oid, &new_sai_pool_attr))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
@@ -2300,27 +2339,28 @@ static sai_status_t mlnx_sai_set_buffer_profile_pool_id_attr(_In_ const sai_obje
             SX_LOG_ERR("Invalid pool specified for a set operation\n");
             pool_key_to_str(value->oid, key_str);
             SX_LOG_DBG("%s\n", key_str);
-            cl_plock_release(&g_sai_db_ptr->p_lock);
+            sai_db_unlock();
             SX_LOG_EXIT();
             return SAI_STATUS_INVALID_PARAMETER;
         }
     } else if (SAI_STATUS_SUCCESS != sai_status) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
-    if (g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index].sai_pool != value->oid) {
-        prev_pool = g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index].sai_pool;
-    }
+    prev_entry = g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index];
     g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index].sai_pool = value->oid;
     if (SAI_STATUS_SUCCESS !=
-        (sai_status = mlnx_sai_buffer_apply_buffer_change_to_references(key->key.object_id, prev_pool))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        (sai_status = mlnx_sai_buffer_apply_buffer_change_to_references(key->key.object_id, &prev_entry))) {
+        g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index] = prev_entry;
+        sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
-    msync(g_sai_db_ptr, sizeof(*g_sai_db_ptr), MS_SYNC);
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_buffer_db_dirty_mark(&g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index],
+                             sizeof(g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index]));
+    sai_buffer_db_sync_async();
+    sai_db_unlock();
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
@@ -2336,15 +2376,15 @@ static sai_status_t mlnx_sai_get_buffer_profile_size_attr(_In_ const sai_object_
     uint32_t     db_buffer_profile_ind;
 
     SX_LOG_ENTER();
-    cl_plock_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_read_lock();
     if (SAI_STATUS_SUCCESS !=
         (sai_status = mlnx_get_sai_buffer_profile_data(key->key.object_id, &db_buffer_profile_ind, NULL))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
     value->u32 = g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_ind].reserved_size;
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_unlock();
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
@@ -2815,7 +2855,7 @@ static sai_status_t mlnx_sai_buffer_prepare_affected_buffers(_In_ mlnx_sai_buffe
     return SAI_STATUS_SUCCESS;
 }
 
-static sai_status_t mlnx_sai_apply_buffer_settings_to_port(_In_ sx_port_log_id_t                     log_port,
+static sai_status_t mlnx_sai_apply_buffer_settings_to_port(_In_ uint32_t                             db_port_ind,
                                                            _In_ mlnx_sai_db_buffer_profile_entry_t   buff_db_entry,
                                                            _In_ mlnx_affect_port_buff_items_t const* affected_items,
                                                            _In_ sai_object_id_t                      prev_pool)
@@ -2825,13 +2865,15 @@ static sai_status_t mlnx_sai_apply_buffer_settings_to_port(_In_ sx_port_log_id_t
     sx_cos_port_shared_buffer_attr_t* sx_port_shared_buff_attr_arr;
     sx_cos_port_buffer_attr_t       * sx_port_reserved_buff_attr_arr;
     uint32_t                          count;
-    uint32_t                          db_port_ind = UINT_MAX;
-    mlnx_port_config_t               *port;
+    sx_port_log_id_t                  log_port;
     mlnx_sai_buffer_pool_attr_t       prev_pool_attr;
     mlnx_sai_buffer_pool_attr_t       new_pool_attr;
 
     SX_LOG_ENTER();
 
+    assert(db_port_ind < MAX_PORTS * 2);
+    log_port = g_sai_db_ptr->ports_db[db_port_ind].logical;
+
     if (SAI_STATUS_SUCCESS != (sai_status = mlnx_get_sai_pool_data(buff_db_entry.sai_pool, &new_pool_attr))) {
         SX_LOG_EXIT();
         return sai_status;
@@ -2845,11 +2887,6 @@ static sai_status_t mlnx_sai_apply_buffer_settings_to_port(_In_ sx_port_log_id_t
         }
         log_sai_pool_attribs(prev_pool_attr);
     }
-    mlnx_port_phy_foreach(port, db_port_ind) {
-        if (port->logical == log_port) {
-            break;
-        }
-    }
     count = affected_items->affected_count;
     SX_LOG_DBG("count.1:%d\n", count);
     assert(count <= buffer_limits.max_buffers_per_port);
@@ -3010,8 +3047,8 @@ static sai_status_t mlnx_sai_buffer_apply_buffer_to_pg(_In_ uint32_t
     }
     affected_items.pgs[pg_ind]    = true;
     affected_items.affected_count = 1;
-    sai_status                    = mlnx_sai_apply_buffer_settings_to_port(g_sai_db_ptr->ports_db[port_ind].logical,
-                                                                           buff_db_entry, &affected_items, prev_pool);
+    sai_status                    = mlnx_sai_apply_buffer_settings_to_port(port_ind, buff_db_entry, &affected_items,
+                                                                           prev_pool);
     free_affected_items(&affected_items);
     SX_LOG_EXIT();
     return sai_status;
@@ -3032,8 +3069,7 @@ static sai_status_t mlnx_sai_buffer_apply_buffer_to_queue(_In_ uint32_t
     affected_items.tcs[qos_ind]   = true;
     affected_items.affected_count = 1;
     SX_LOG_ENTER();
-    sai_status = mlnx_sai_apply_buffer_settings_to_port(g_sai_db_ptr->ports_db[qos_db_port_ind].logical,
-                                                        buff_db_entry, &affected_items, prev_pool);
+    sai_status = mlnx_sai_apply_buffer_settings_to_port(qos_db_port_ind, buff_db_entry, &affected_items, prev_pool);
     free_affected_items(&affected_items);
     SX_LOG_EXIT();
     return sai_status;
@@ -3152,50 +3188,102 @@ static sai_status_t mlnx_sai_collect_buffer_refs(_In_ sai_object_id_t
     return SAI_STATUS_SUCCESS;
 }
 
-static sai_status_t mlnx_sai_buffer_apply_buffer_change_to_references(_In_ sai_object_id_t sai_buffer_id,
-                                                                      _In_ sai_object_id_t prev_pool)
+/*
+ *  Applies the change of a buffer profile to all the port buffers referencing it.
+ *  The affected buffers of all the ports are collected first and then pushed port by port.
+ *  If a port fails, the ports changed so far (including the failed one) are set back to prev_entry.
+ *  DB write lock is needed.
+ */
+static sai_status_t mlnx_sai_buffer_apply_buffer_change_to_references(
+    _In_ sai_object_id_t                           sai_buffer_id,
+    _In_ const mlnx_sai_db_buffer_profile_entry_t *prev_entry)
 {
     sai_status_t                       sai_status;
-    mlnx_affect_port_buff_items_t      affected_items;
+    sai_status_t                       rollback_status;
+    mlnx_affect_port_buff_items_t      affected_items = { 0 };
+    mlnx_buffer_port_change_t         *changes        = NULL;
+    uint32_t                           changes_count  = 0;
     uint32_t                           port_ind;
+    uint32_t                           ii;
     uint32_t                           db_buffer_profile_index;
     mlnx_sai_db_buffer_profile_entry_t buff_db_entry;
     mlnx_sai_buffer_pool_attr_t        sai_pool_attr;
     mlnx_port_config_t                *port;
+    sai_object_id_t                    prev_pool     = SAI_NULL_OBJECT_ID;
+    sai_object_id_t                    rollback_pool = SAI_NULL_OBJECT_ID;
 
     SX_LOG_ENTER();
-    if (!alloc_affected_items(&affected_items)) {
-        SX_LOG_EXIT();
-        return SAI_STATUS_NO_MEMORY;
-    }
+    assert(prev_entry);
+
     if (SAI_STATUS_SUCCESS !=
         (sai_status = mlnx_get_sai_buffer_profile_data(sai_buffer_id, &db_buffer_profile_index, &sai_pool_attr))) {
-        free_affected_items(&affected_items);
         SX_LOG_EXIT();
         return sai_status;
     }
     buff_db_entry = g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index];
+    if (prev_entry->sai_pool != buff_db_entry.sai_pool) {
+        prev_pool     = prev_entry->sai_pool;
+        rollback_pool = buff_db_entry.sai_pool;
+    }
+
+    changes = calloc(MAX_PORTS, sizeof(*changes));
+    if (!changes) {
+        SX_LOG_EXIT();
+        return SAI_STATUS_NO_MEMORY;
+    }
+
     mlnx_port_phy_foreach(port, port_ind) {
+        if (!affected_items.pgs && !alloc_affected_items(&affected_items)) {
+            memset(&affected_items, 0, sizeof(affected_items));
+            sai_status = SAI_STATUS_NO_MEMORY;
+            goto out;
+        }
         sai_status = mlnx_sai_collect_buffer_refs(sai_buffer_id, port_ind, &affected_items);
         if (SAI_STATUS_ITEM_NOT_FOUND == sai_status) {
             continue;
         }
         if (SAI_STATUS_SUCCESS != sai_status) {
-            free_affected_items(&affected_items);
-            SX_LOG_EXIT();
-            return sai_status;
+            goto out;
         }
-        if (SAI_STATUS_SUCCESS !=
-            (sai_status =
-                 mlnx_sai_apply_buffer_settings_to_port(port->logical, buff_db_entry, &affected_items, prev_pool))) {
-            free_affected_items(&affected_items);
-            SX_LOG_EXIT();
-            return sai_status;
+        changes[changes_count].db_port_ind    = port_ind;
+        changes[changes_count].affected_items = affected_items;
+        changes_count++;
+        memset(&affected_items, 0, sizeof(affected_items));
+    }
+
+    SX_LOG_DBG("Buffer profile 0x%" PRIx64 " change affects %u ports\n", sai_buffer_id, changes_count);
+
+    for (ii = 0; ii < changes_count; ii++) {
+        sai_status = mlnx_sai_apply_buffer_settings_to_port(changes[ii].db_port_ind, buff_db_entry,
+                                                            &changes[ii].affected_items, prev_pool);
+        if (SAI_STATUS_SUCCESS == sai_status) {
+            continue;
         }
+
+        SX_LOG_ERR("Failed to apply buffer profile 0x%" PRIx64 " to port_db[%d], rolling back %u ports\n",
+                   sai_buffer_id, changes[ii].db_port_ind, ii + 1);
+        do {
+            rollback_status = mlnx_sai_apply_buffer_settings_to_port(changes[ii].db_port_ind, *prev_entry,
+                                                                     &changes[ii].affected_items, rollback_pool);
+            if (SAI_STATUS_SUCCESS != rollback_status) {
+                SX_LOG_ERR("Failed to roll back buffer profile 0x%" PRIx64 " on port_db[%d]\n",
+                           sai_buffer_id, changes[ii].db_port_ind);
+            }
+        } while (ii-- > 0);
+        goto out;
     }
-    free_affected_items(&affected_items);
+    sai_status = SAI_STATUS_SUCCESS;
+
+out:
+    for (ii = 0; ii < changes_count; ii++) {
+        free_affected_items(&changes[ii].affected_items);
+    }
+    if (affected_items.pgs) {
+        free_affected_items(&affected_items);
+    }
+    free(changes);
     SX_LOG_EXIT();
-    return SAI_STATUS_SUCCESS;
+    return sai_status;
 }
 
 /** reserved buffer size in bytes [sai_uint32_t] */
@@ -3203,26 +3291,31 @@ static sai_status_t mlnx_sai_set_buffer_profile_size_attr(_In_ const sai_object_
                                                           _In_ const sai_attribute_value_t * value,
                                                           void                             * arg)
 {
-    sai_status_t sai_status;
-    uint32_t     db_buffer_profile_index;
+    sai_status_t                       sai_status;
+    uint32_t                           db_buffer_profile_index;
+    mlnx_sai_db_buffer_profile_entry_t prev_entry;
 
     SX_LOG_ENTER();
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_write_lock();
     if (SAI_STATUS_SUCCESS !=
         (sai_status = get_buffer_profile_db_index(key->key.object_id, &db_buffer_profile_index))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
+    prev_entry = g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index];
     g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index].reserved_size = value->u32;
     if (SAI_STATUS_SUCCESS !=
-        (sai_status = mlnx_sai_buffer_apply_buffer_change_to_references(key->key.object_id, SAI_NULL_OBJECT_ID))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        (sai_status = mlnx_sai_buffer_apply_buffer_change_to_references(key->key.object_id, &prev_entry))) {
+        g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index] = prev_entry;
+        sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
-    msync(g_sai_db_ptr, sizeof(*g_sai_db_ptr), MS_SYNC);
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_buffer_db_dirty_mark(&g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index],
+                             sizeof(g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index]));
+    sai_buffer_db_sync_async();
+    sai_db_unlock();
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
@@ -3241,15 +3334,15 @@ static sai_status_t mlnx_sai_get_buffer_profile_dynamic_th_attr(_In_ const sai_o
     uint32_t     db_buffer_profile_index;
 
     SX_LOG_ENTER();
-    cl_plock_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_read_lock();
     if (SAI_STATUS_SUCCESS !=
         (sai_status = get_buffer_profile_db_index(key->key.object_id, &db_buffer_profile_index))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
     value->s8 = g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index].shared_max.max.alpha;
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_unlock();
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
@@ -3262,26 +3355,31 @@ static sai_status_t mlnx_sai_set_buffer_profile_dynamic_th_attr(_In_ const sai_o
                                                                 _In_ const sai_attribute_value_t * value,
                                                                 void                             * arg)
 {
-    sai_status_t sai_status;
-    uint32_t     db_buffer_profile_index;
+    sai_status_t                       sai_status;
+    uint32_t                           db_buffer_profile_index;
+    mlnx_sai_db_buffer_profile_entry_t prev_entry;
 
     SX_LOG_ENTER();
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_write_lock();
     if (SAI_STATUS_SUCCESS !=
         (sai_status = get_buffer_profile_db_index(key->key.object_id, &db_buffer_profile_index))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
+    prev_entry = g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index];
     g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index].shared_max.max.alpha = value->s8;
     if (SAI_STATUS_SUCCESS !=
-        (sai_status = mlnx_sai_buffer_apply_buffer_change_to_references(key->key.object_id, SAI_NULL_OBJECT_ID))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        (sai_status = mlnx_sai_buffer_apply_buffer_change_to_references(key->key.object_id, &prev_entry))) {
+        g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index] = prev_entry;
+        sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
-    msync(g_sai_db_ptr, sizeof(*g_sai_db_ptr), MS_SYNC);
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_buffer_db_dirty_mark(&g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index],
+                             sizeof(g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index]));
+    sai_buffer_db_sync_async();
+    sai_db_unlock();
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
@@ -3298,16 +3396,15 @@ static sai_status_t mlnx_sai_get_buffer_profile_static_th_attr(_In_ const sai_ob
     SX_LOG_ENTER();
     sai_status_t sai_status;
     uint32_t     db_buffer_profile_index;
-    cl_plock_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_read_lock();
     if (SAI_STATUS_SUCCESS !=
         (sai_status = get_buffer_profile_db_index(key->key.object_id, &db_buffer_profile_index))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
     value->u32 = g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index].shared_max.max.static_th;
-    msync(g_sai_db_ptr, sizeof(*g_sai_db_ptr), MS_SYNC);
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_unlock();
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
@@ -3319,25 +3416,30 @@ static sai_status_t mlnx_sai_set_buffer_profile_static_th_attr(_In_ const sai_ob
                                                                _In_ const sai_attribute_value_t * value,
                                                                void                             * arg)
 {
-    sai_status_t sai_status;
-    uint32_t     db_buffer_profile_index;
+    sai_status_t                       sai_status;
+    uint32_t                           db_buffer_profile_index;
+    mlnx_sai_db_buffer_profile_entry_t prev_entry;
 
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_write_lock();
     if (SAI_STATUS_SUCCESS !=
         (sai_status = get_buffer_profile_db_index(key->key.object_id, &db_buffer_profile_index))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
+    prev_entry = g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index];
     g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index].shared_max.max.static_th = value->u32;
     if (SAI_STATUS_SUCCESS !=
-        (sai_status = mlnx_sai_buffer_apply_buffer_change_to_references(key->key.object_id, SAI_NULL_OBJECT_ID))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        (sai_status = mlnx_sai_buffer_apply_buffer_change_to_references(key->key.object_id, &prev_entry))) {
+        g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index] = prev_entry;
+        sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
-    msync(g_sai_db_ptr, sizeof(*g_sai_db_ptr), MS_SYNC);
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_buffer_db_dirty_mark(&g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index],
+                             sizeof(g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index]));
+    sai_buffer_db_sync_async();
+    sai_db_unlock();
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
@@ -3357,15 +3459,15 @@ static sai_status_t mlnx_sai_get_buffer_profile_xoff_attr(_In_ const sai_object_
     uint32_t     db_buffer_profile_index;
 
     SX_LOG_ENTER();
-    cl_plock_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_read_lock();
     if (SAI_STATUS_SUCCESS !=
         (sai_status = get_buffer_profile_db_index(key->key.object_id, &db_buffer_profile_index))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
     value->u32 = g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index].xoff;
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_unlock();
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
@@ -3379,26 +3481,31 @@ static sai_status_t mlnx_sai_set_buffer_profile_xoff_attr(_In_ const sai_object_
                                                           _In_ const sai_attribute_value_t * value,
                                                           void                             * arg)
 {
-    sai_status_t sai_status;
-    uint32_t     db_buffer_profile_index;
+    sai_status_t                       sai_status;
+    uint32_t                           db_buffer_profile_index;
+    mlnx_sai_db_buffer_profile_entry_t prev_entry;
 
     SX_LOG_ENTER();
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_write_lock();
     if (SAI_STATUS_SUCCESS !=
         (sai_status = get_buffer_profile_db_index(key->key.object_id, &db_buffer_profile_index))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
+    prev_entry = g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index];
     g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index].xoff = value->u32;
     if (SAI_STATUS_SUCCESS !=
-        (sai_status = mlnx_sai_buffer_apply_buffer_change_to_references(key->key.object_id, SAI_NULL_OBJECT_ID))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        (sai_status = mlnx_sai_buffer_apply_buffer_change_to_references(key->key.object_id, &prev_entry))) {
+        g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index] = prev_entry;
+        sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
-    msync(g_sai_db_ptr, sizeof(*g_sai_db_ptr), MS_SYNC);
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_buffer_db_dirty_mark(&g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index],
+                             sizeof(g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index]));
+    sai_buffer_db_sync_async();
+    sai_db_unlock();
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
@@ -3419,15 +3526,15 @@ static sai_status_t mlnx_sai_get_buffer_profile_xon_attr(_In_ const sai_object_k
     uint32_t     db_buffer_profile_index;
 
     SX_LOG_ENTER();
-    cl_plock_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_read_lock();
     if (SAI_STATUS_SUCCESS !=
         (sai_status = get_buffer_profile_db_index(key->key.object_id, &db_buffer_profile_index))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
     value->u32 = g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index].xon;
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_unlock();
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
@@ -3442,26 +3549,31 @@ static sai_status_t mlnx_sai_set_buffer_profile_xon_attr(_In_ const sai_object_k
                                                          _In_ const sai_attribute_value_t * value,
                                                          void                             * arg)
 {
-    sai_status_t sai_status;
-    uint32_t     db_buffer_profile_index;
+    sai_status_t                       sai_status;
+    uint32_t                           db_buffer_profile_index;
+    mlnx_sai_db_buffer_profile_entry_t prev_entry;
 
     SX_LOG_ENTER();
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_write_lock();
     if (SAI_STATUS_SUCCESS !=
         (sai_status = get_buffer_profile_db_index(key->key.object_id, &db_buffer_profile_index))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
+    prev_entry = g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index];
     g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index].xon = value->u32; /* TODO: unit conversion? */
     if (SAI_STATUS_SUCCESS !=
-        (sai_status = mlnx_sai_buffer_apply_buffer_change_to_references(key->key.object_id, SAI_NULL_OBJECT_ID))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        (sai_status = mlnx_sai_buffer_apply_buffer_change_to_references(key->key.object_id, &prev_entry))) {
+        g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index] = prev_entry;
+        sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
-    msync(g_sai_db_ptr, sizeof(*g_sai_db_ptr), MS_SYNC);
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_buffer_db_dirty_mark(&g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index],
+                             sizeof(g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index]));
+    sai_buffer_db_sync_async();
+    sai_db_unlock();
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
@@ -3477,15 +3589,15 @@ static sai_status_t mlnx_sai_get_buffer_profile_th_mode(_In_ const sai_object_ke
     uint32_t     db_buffer_profile_index;
 
     SX_LOG_ENTER();
-    cl_plock_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_read_lock();
     if (SAI_STATUS_SUCCESS !=
         (sai_status = get_buffer_profile_db_index(key->key.object_id, &db_buffer_profile_index))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
     value->s32 = g_sai_buffer_db_ptr->buffer_profiles[db_buffer_profile_index].shared_max.mode;
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_unlock();
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
@@ -3658,8 +3770,7 @@ sai_status_t mlnx_sai_buffer_apply_port_buffer_profile_list(_In_ bool
         affected_items.affected_count = 1;
         /* Note: pool_id never changes for port pool buffer, hence last parameter == false */
         if (SAI_STATUS_SUCCESS != (sai_status = mlnx_sai_apply_buffer_settings_to_port(
-                                       g_sai_db_ptr->ports_db[db_port_ind].logical, buffer_entry, &affected_items,
-                                       SAI_NULL_OBJECT_ID))) {
+                                       db_port_ind, buffer_entry, &affected_items, SAI_NULL_OBJECT_ID))) {
             free_affected_items(&affected_items);
             SX_LOG_EXIT();
             return sai_status;
@@ -3715,9 +3826,9 @@ sai_status_t mlnx_buffer_port_profile_list_set(_In_ const sai_object_id_t
         }
     }
 
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_write_lock();
     if (SAI_STATUS_SUCCESS != (sai_status = mlnx_port_idx_by_log_id(log_port, &db_port_ind))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
@@ -3725,7 +3836,7 @@ sai_status_t mlnx_buffer_port_profile_list_set(_In_ const sai_object_id_t
         if (SAI_STATUS_SUCCESS !=
             (sai_status =
                  mlnx_sai_get_port_buffer_index_array(db_port_ind, PORT_BUFF_TYPE_INGRESS, &db_port_buffers))) {
-            cl_plock_release(&g_sai_db_ptr->p_lock);
+            sai_db_unlock();
             return sai_status;
         }
         buff_count = buffer_limits.num_ingress_pools;
@@ -3733,14 +3844,14 @@ sai_status_t mlnx_buffer_port_profile_list_set(_In_ const sai_object_id_t
         if (SAI_STATUS_SUCCESS !=
             (sai_status =
                  mlnx_sai_get_port_buffer_index_array(db_port_ind, PORT_BUFF_TYPE_EGRESS, &db_port_buffers))) {
-            cl_plock_release(&g_sai_db_ptr->p_lock);
+            sai_db_unlock();
             return sai_status;
         }
         buff_count = buffer_limits.num_egress_pools;
     }
     buffer_profiles = calloc(buff_count, sizeof(sai_object_id_t));
     if (NULL == buffer_profiles) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         SX_LOG_EXIT();
         return SAI_STATUS_NO_MEMORY;
     }
@@ -3748,7 +3859,7 @@ sai_status_t mlnx_buffer_port_profile_list_set(_In_ const sai_object_id_t
         (sai_status = mlnx_sai_buffer_validate_port_buffer_list_and_sort_by_pool(value, is_ingress,
                                                                                  buff_count,
                                                                                  buffer_profiles))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         free(buffer_profiles);
         SX_LOG_EXIT();
         return sai_status;
@@ -3757,10 +3868,11 @@ sai_status_t mlnx_buffer_port_profile_list_set(_In_ const sai_object_id_t
     if (SAI_STATUS_SUCCESS == (sai_status = mlnx_sai_buffer_apply_port_buffer_profile_list(is_ingress, db_port_ind,
                                                                                            db_port_buffers, buff_count,
                                                                                            buffer_profiles))) {
-        msync(g_sai_db_ptr, sizeof(*g_sai_db_ptr), MS_SYNC);
+        sai_buffer_db_dirty_mark(db_port_buffers, buff_count * sizeof(*db_port_buffers));
+        sai_buffer_db_sync_async();
     }
     free(buffer_profiles);
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_unlock();
     SX_LOG_EXIT();
     return sai_status;
 }
@@ -3787,7 +3899,7 @@ sai_status_t mlnx_buffer_port_profile_list_get(_In_ const sai_object_id_t      p
         return sai_status;
     }
 
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_write_lock();
 
     if (mlnx_log_port_is_cpu(log_port)) {
         value->objlist.count = 0;
@@ -3829,7 +3941,7 @@ sai_status_t mlnx_buffer_port_profile_list_get(_In_ const sai_object_id_t      p
 
 out:
     SX_LOG_EXIT();
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_unlock();
     if (buffer_profiles) {
         free(buffer_profiles);
     }
@@ -3845,7 +3957,9 @@ sai_status_t mlnx_sai_get_buffer_pool_stats(_In_ sai_object_id_t
     sx_cos_pool_occupancy_statistics_t occupancy_stats;
     mlnx_sai_buffer_pool_attr_t        sai_pool_attr;
     char                               key_str[MAX_KEY_STR_LEN];
+    uint32_t                           sx_pool_id;
     uint32_t                           ii;
+    bool                               pool_allocated;
 
     SX_LOG_ENTER();
     pool_key_to_str(pool_id, key_str);
@@ -3865,19 +3979,31 @@ sai_status_t mlnx_sai_get_buffer_pool_stats(_In_ sai_object_id_t
         SX_LOG_EXIT();
         return SAI_STATUS_INVALID_PARAMETER;
     }
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
-    if (SAI_STATUS_SUCCESS != (sai_status = mlnx_get_sai_pool_data(pool_id, &sai_pool_attr))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+    if (SAI_STATUS_SUCCESS !=
+        (sai_status = mlnx_object_to_type(pool_id, SAI_OBJECT_TYPE_BUFFER_POOL, &sx_pool_id, NULL))) {
         SX_LOG_EXIT();
         return sai_status;
     }
-    cl_plock_release(&g_sai_db_ptr->p_lock);
-    if (SX_STATUS_SUCCESS != (sai_status = sx_api_cos_pool_statistic_get(gh_sdk, SX_ACCESS_CMD_READ,
-                                                                         &sai_pool_attr.sx_pool_id, 1,
-                                                                         &occupancy_stats))) {
-        SX_LOG_ERR("Failed to get pool stat counters - error:%s.\n", SX_STATUS_MSG(sai_status));
-        SX_LOG_EXIT();
-        return sdk_to_sai(sai_status);
+    /* Snapshot is served only for a pool which is still allocated, the rest are checked via SDK */
+    sai_db_read_lock();
+    pool_allocated = mlnx_sai_buffer_pool_is_allocated(sx_pool_id);
+    sai_db_unlock();
+
+    if (!pool_allocated || !mlnx_watermark_pool_get(sx_pool_id, &occupancy_stats)) {
+        sai_db_read_lock();
+        if (SAI_STATUS_SUCCESS != (sai_status = mlnx_get_sai_pool_data(pool_id, &sai_pool_attr))) {
+            sai_db_unlock();
+            SX_LOG_EXIT();
+            return sai_status;
+        }
+        sai_db_unlock();
+        if (SX_STATUS_SUCCESS != (sai_status = sx_api_cos_pool_statistic_get(gh_sdk, SX_ACCESS_CMD_READ,
+                                                                             &sai_pool_attr.sx_pool_id, 1,
+                                                                             &occupancy_stats))) {
+            SX_LOG_ERR("Failed to get pool stat counters - error:%s.\n", SX_STATUS_MSG(sai_status));
+            SX_LOG_EXIT();
+            return sdk_to_sai(sai_status);
+        }
     }
     for (ii = 0; ii < number_of_counters; ii++) {
         switch (counter_ids[ii]) {
@@ -3926,13 +4052,13 @@ sai_status_t mlnx_clear_buffer_pool_stats(_In_ sai_object_id_t               poo
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_read_lock();
     if (SAI_STATUS_SUCCESS != (sai_status = mlnx_get_sai_pool_data(pool_id, &sai_pool_attr))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_unlock();
 
     if (SX_STATUS_SUCCESS != (sai_status = sx_api_cos_pool_statistic_get(gh_sdk, SX_ACCESS_CMD_READ_CLEAR,
                                                                          &sai_pool_attr.sx_pool_id, 1,
@@ -3941,6 +4067,7 @@ sai_status_t mlnx_clear_buffer_pool_stats(_In_ sai_object_id_t               poo
         SX_LOG_EXIT();
         return sdk_to_sai(sai_status);
     }
+    mlnx_counter_collector_invalidate();
 
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
@@ -3959,6 +4086,8 @@ sai_status_t mlnx_sai_get_ingress_priority_group_stats(_In_ sai_object_id_t
     uint32_t                         ii;
     char                             key_str[MAX_KEY_STR_LEN];
     sx_port_cntr_buff_t              pg_cnts;
+    bool                             is_pg_cnts_needed   = false;
+    bool                             is_occupancy_needed = false;
 
     SX_LOG_ENTER();
     pg_key_to_str(ingress_pg_id, key_str);
@@ -3983,25 +4112,48 @@ sai_status_t mlnx_sai_get_ingress_priority_group_stats(_In_ sai_object_id_t
         return sai_status;
     }
 
-    if (SX_STATUS_SUCCESS !=
-        (sai_status = sx_api_port_counter_buff_get(gh_sdk, SX_ACCESS_CMD_READ, g_sai_db_ptr->ports_db[db_port_index].logical, 
-                                                   pg_ind, &pg_cnts))) {
+    for (ii = 0; ii < number_of_counters; ii++) {
+        switch (counter_ids[ii]) {
+        case SAI_INGRESS_PRIORITY_GROUP_STAT_PACKETS:
+        case SAI_INGRESS_PRIORITY_GROUP_STAT_BYTES:
+        case SAI_INGRESS_PRIORITY_GROUP_STAT_DROPPED_PACKETS:
+            is_pg_cnts_needed = true;
+            break;
+
+        case SAI_INGRESS_PRIORITY_GROUP_STAT_CURR_OCCUPANCY_BYTES:
+        case SAI_INGRESS_PRIORITY_GROUP_STAT_WATERMARK_BYTES:
+            is_occupancy_needed = true;
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    if (is_pg_cnts_needed &&
+        !mlnx_counter_pg_get(g_sai_db_ptr->ports_db[db_port_index].logical, pg_ind, &pg_cnts) &&
+        (SX_STATUS_SUCCESS !=
+         (sai_status = sx_api_port_counter_buff_get(gh_sdk, SX_ACCESS_CMD_READ, g_sai_db_ptr->ports_db[db_port_index].logical, 
+                                                    pg_ind, &pg_cnts)))) {
         SX_LOG_ERR("Failed to get port pg counters - %s.\n", SX_STATUS_MSG(sai_status));
         return sdk_to_sai(sai_status);
     }
 
-    memset(&stats_usage, 0, sizeof(stats_usage));
-    stats_usage.port_cnt                                 = 1;
-    stats_usage.log_port_list_p                          = &g_sai_db_ptr->ports_db[db_port_index].logical;
-    stats_usage.sx_port_params.port_params_type          = SX_COS_INGRESS_PORT_PRIORITY_GROUP_ATTR_E;
-    stats_usage.sx_port_params.port_params_cnt           = 1;
-    stats_usage.sx_port_params.port_param.port_pg_list_p = &pg_ind;
+    if (is_occupancy_needed &&
+        !mlnx_watermark_pg_get(g_sai_db_ptr->ports_db[db_port_index].logical, pg_ind, &occupancy_stats)) {
+        memset(&stats_usage, 0, sizeof(stats_usage));
+        stats_usage.port_cnt                                 = 1;
+        stats_usage.log_port_list_p                          = &g_sai_db_ptr->ports_db[db_port_index].logical;
+        stats_usage.sx_port_params.port_params_type          = SX_COS_INGRESS_PORT_PRIORITY_GROUP_ATTR_E;
+        stats_usage.sx_port_params.port_params_cnt           = 1;
+        stats_usage.sx_port_params.port_param.port_pg_list_p = &pg_ind;
 
-    if (SX_STATUS_SUCCESS !=
-        (sai_status = sx_api_cos_port_buff_type_statistic_get(gh_sdk, SX_ACCESS_CMD_READ, &stats_usage, 1,
-                                                              &occupancy_stats, &usage_cnt))) {
-        SX_LOG_ERR("Failed to get PG stat counters - %s.\n", SX_STATUS_MSG(sai_status));
-        return sdk_to_sai(sai_status);
+        if (SX_STATUS_SUCCESS !=
+            (sai_status = sx_api_cos_port_buff_type_statistic_get(gh_sdk, SX_ACCESS_CMD_READ, &stats_usage, 1,
+                                                                  &occupancy_stats, &usage_cnt))) {
+            SX_LOG_ERR("Failed to get PG stat counters - %s.\n", SX_STATUS_MSG(sai_status));
+            return sdk_to_sai(sai_status);
+        }
     }
 
     for (ii = 0; ii < number_of_counters; ii++) {
@@ -4088,6 +4240,7 @@ static sai_status_t mlnx_sai_clear_ingress_priority_group_stats(
         SX_LOG_EXIT();
         return sdk_to_sai(sai_status);
     }
+    mlnx_counter_collector_invalidate();
 
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
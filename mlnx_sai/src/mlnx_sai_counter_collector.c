@@ -0,0 +1,722 @@
+/*
+ *  Copyright (C) 2017. Mellanox Technologies, Ltd. ALL RIGHTS RESERVED.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License") you may
+ *    not use this file except in compliance with the License. You may obtain
+ *    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR
+ *    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+ *    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+ *    FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+ *
+ *    See the Apache Version 2.0 License for specific language governing
+ *    permissions and limitations under the License.
+ *
+ */
+
+#include "sai_windows.h"
+#include "sai.h"
+#include "mlnx_sai.h"
+#include "assert.h"
+
+#undef  __MODULE__
+#define __MODULE__ SAI_COUNTER
+
+static sx_verbosity_level_t LOG_VAR_NAME(__MODULE__) = SX_VERBOSITY_LEVEL_WARNING;
+
+/*
+ *  Counter collector.
+ *  Occupancy and watermark of all the user pools, port PGs and port queues are read on an interval
+ *  from a background thread into one of two snapshots, and the snapshot is published for the stats gets.
+ *  When SAI_SWITCH_ATTR_COUNTER_REFRESH_INTERVAL is set, the port, queue, PG, ACL, RIF and VLAN counters
+ *  are collected into the snapshot as well.
+ *  Readers take no lock, a snapshot being rewritten is detected by its sequence number (odd while written,
+ *  changed after) and the reader then falls back to a direct SDK read.
+ *  A snapshot is also ignored once its generation is behind the collector one, the generation is bumped when
+ *  the counters are cleared so a collection that started before the clear is never served after it.
+ *  The snapshot buffers are kept for the process lifetime once allocated, stop only stops publishing, so a
+ *  reader never sees them freed. Start/stop/interval changes are serialized by the collector mutex.
+ *  The snapshots are process local, the collector runs in the process that created or connected to the switch.
+ */
+#define MLNX_COUNTER_SNAPSHOT_NONE   UINT32_MAX
+#define MLNX_COUNTER_COLLECTOR_STOP_POLL_MSEC  100
+
+typedef struct _mlnx_counter_snapshot_t {
+    volatile uint32_t                   seq;
+    volatile uint32_t                   generation;
+    uint32_t                            ports_count;
+    sx_port_log_id_t                    log_ports[MAX_PORTS];
+    sx_cos_pool_occupancy_statistics_t *pools;
+    /* [port][PGs, then queues] */
+    sx_port_occupancy_statistics_t *port_stats;
+    /* valid only when has_counters is set */
+    bool                       has_counters;
+    sx_port_log_id_t           red_ports[MAX_PORTS];
+    bool                       port_counters_valid[MAX_PORTS];
+    mlnx_port_counters_t      *port_counters;
+    sx_port_traffic_cntr_t    *tc_counters;
+    sx_port_cntr_buff_t       *pg_counters;
+    uint32_t                   acl_counters_count;
+    mlnx_acl_counter_value_t  *acl_counters;
+    uint32_t                   rif_counters_count;
+    mlnx_rif_counter_value_t  *rif_counters;
+    uint32_t                   vlan_counters_count;
+    mlnx_vlan_counter_value_t *vlan_counters;
+} mlnx_counter_snapshot_t;
+
+typedef struct _mlnx_counter_collector_t {
+    cl_thread_t             thread;
+    bool                    is_started;
+    volatile bool           is_stop_asked;
+    volatile uint32_t       interval_msec;
+    volatile bool           with_counters;
+    volatile uint32_t       published;
+    volatile uint32_t       generation;
+    uint32_t                pools_count;
+    uint32_t               *pool_ids;
+    uint32_t                pgs_count;
+    uint32_t               *pgs;
+    uint32_t                tcs_count;
+    uint8_t                *tcs;
+    uint32_t                port_stats_count;
+    uint32_t                acl_counters_max;
+    uint32_t                rif_counters_max;
+    uint32_t                vlan_counters_max;
+    mlnx_counter_snapshot_t snapshots[2];
+} mlnx_counter_collector_t;
+
+static mlnx_counter_collector_t g_counter_collector = { .published = MLNX_COUNTER_SNAPSHOT_NONE };
+static pthread_mutex_t          g_counter_collector_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/* A port that fails to read is left out of the snapshot, its gets go to SDK */
+static bool mlnx_counter_snapshot_port_counters_collect(_In_ sx_api_handle_t             handle,
+                                                        _Inout_ mlnx_counter_snapshot_t *snapshot,
+                                                        _In_ uint32_t                    ii)
+{
+    sx_status_t  sx_status;
+    sai_status_t status;
+    uint32_t     jj;
+
+    status = mlnx_port_counters_read(handle, snapshot->log_ports[ii], snapshot->red_ports[ii], true,
+                                     &snapshot->port_counters[ii]);
+    if (SAI_ERR(status)) {
+        return false;
+    }
+
+    for (jj = 0; jj < g_counter_collector.tcs_count; jj++) {
+        sx_status = sx_api_port_counter_tc_get(handle, SX_ACCESS_CMD_READ, snapshot->log_ports[ii], jj,
+                                               &snapshot->tc_counters[ii * g_counter_collector.tcs_count + jj]);
+        if (SX_ERR(sx_status)) {
+            SX_LOG_ERR("Failed to get port %x tc %u counters - %s.\n", snapshot->log_ports[ii], jj,
+                       SX_STATUS_MSG(sx_status));
+            return false;
+        }
+    }
+
+    for (jj = 0; jj < g_counter_collector.pgs_count; jj++) {
+        sx_status = sx_api_port_counter_buff_get(handle, SX_ACCESS_CMD_READ, snapshot->log_ports[ii], jj,
+                                                 &snapshot->pg_counters[ii * g_counter_collector.pgs_count + jj]);
+        if (SX_ERR(sx_status)) {
+            SX_LOG_ERR("Failed to get port %x pg %u counters - %s.\n", snapshot->log_ports[ii], jj,
+                       SX_STATUS_MSG(sx_status));
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void mlnx_counter_snapshot_counters_collect(_In_ sx_api_handle_t             handle,
+                                                   _Inout_ mlnx_counter_snapshot_t *snapshot)
+{
+    uint32_t ii;
+
+    for (ii = 0; ii < snapshot->ports_count; ii++) {
+        snapshot->port_counters_valid[ii] = mlnx_counter_snapshot_port_counters_collect(handle, snapshot, ii);
+    }
+
+    mlnx_acl_counters_read(handle, snapshot->acl_counters, g_counter_collector.acl_counters_max,
+                           &snapshot->acl_counters_count);
+    mlnx_rif_counters_read(handle, snapshot->rif_counters, g_counter_collector.rif_counters_max,
+                           &snapshot->rif_counters_count);
+    mlnx_vlan_counters_read(handle, snapshot->vlan_counters, g_counter_collector.vlan_counters_max,
+                            &snapshot->vlan_counters_count);
+}
+
+static sai_status_t mlnx_counter_snapshot_collect(_In_ sx_api_handle_t             handle,
+                                                  _Inout_ mlnx_counter_snapshot_t *snapshot)
+{
+    sx_status_t                      sx_status;
+    sx_port_statistic_usage_params_t stats_usage[2];
+    mlnx_port_config_t              *port;
+    uint32_t                         port_ind, ii, usage_cnt;
+
+    snapshot->has_counters = g_counter_collector.with_counters;
+    __sync_synchronize();
+
+    snapshot->ports_count = 0;
+    sai_db_read_lock();
+    mlnx_port_phy_foreach(port, port_ind) {
+        /* In case if port is LAG member then LAG logical id is used for redecn counters */
+        snapshot->red_ports[snapshot->ports_count] = mlnx_port_is_lag_member(port) ? port->lag_id : port->logical;
+        snapshot->log_ports[snapshot->ports_count++] = port->logical;
+    }
+    sai_db_unlock();
+
+    if (g_counter_collector.pools_count) {
+        sx_status = sx_api_cos_pool_statistic_get(handle, SX_ACCESS_CMD_READ, g_counter_collector.pool_ids,
+                                                  g_counter_collector.pools_count, snapshot->pools);
+        if (SX_ERR(sx_status)) {
+            SX_LOG_ERR("Failed to get pool stat counters - %s.\n", SX_STATUS_MSG(sx_status));
+            return sdk_to_sai(sx_status);
+        }
+    }
+
+    /* One read per port for all its PGs and queues */
+    for (ii = 0; ii < snapshot->ports_count; ii++) {
+        memset(stats_usage, 0, sizeof(stats_usage));
+        stats_usage[0].port_cnt                                 = 1;
+        stats_usage[0].log_port_list_p                          = &snapshot->log_ports[ii];
+        stats_usage[0].sx_port_params.port_params_type          = SX_COS_INGRESS_PORT_PRIORITY_GROUP_ATTR_E;
+        stats_usage[0].sx_port_params.port_params_cnt           = g_counter_collector.pgs_count;
+        stats_usage[0].sx_port_params.port_param.port_pg_list_p = g_counter_collector.pgs;
+        stats_usage[1].port_cnt                                 = 1;
+        stats_usage[1].log_port_list_p                          = &snapshot->log_ports[ii];
+        stats_usage[1].sx_port_params.port_params_type          = SX_COS_EGRESS_PORT_TRAFFIC_CLASS_ATTR_E;
+        stats_usage[1].sx_port_params.port_params_cnt           = g_counter_collector.tcs_count;
+        stats_usage[1].sx_port_params.port_param.port_tc_list_p = g_counter_collector.tcs;
+
+        usage_cnt = g_counter_collector.port_stats_count;
+        sx_status = sx_api_cos_port_buff_type_statistic_get(handle, SX_ACCESS_CMD_READ, stats_usage, 2,
+                                                            &snapshot->port_stats[ii *
+                                                                                  g_counter_collector.port_stats_count],
+                                                            &usage_cnt);
+        if (SX_ERR(sx_status)) {
+            SX_LOG_ERR("Failed to get port %x buff statistics - %s.\n", snapshot->log_ports[ii],
+                       SX_STATUS_MSG(sx_status));
+            return sdk_to_sai(sx_status);
+        }
+        if (usage_cnt != g_counter_collector.port_stats_count) {
+            SX_LOG_ERR("Port %x buff statistics returned %u items, expected %u\n", snapshot->log_ports[ii],
+                       usage_cnt, g_counter_collector.port_stats_count);
+            return SAI_STATUS_FAILURE;
+        }
+    }
+
+    if (snapshot->has_counters) {
+        mlnx_counter_snapshot_counters_collect(handle, snapshot);
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static void mlnx_counter_collector_func(void *context)
+{
+    mlnx_counter_snapshot_t *snapshot;
+    sx_api_handle_t          handle;
+    sx_status_t              sx_status;
+    sai_status_t             status;
+    uint32_t                 target, slept;
+
+    sx_status = sx_api_open(sai_log_cb, &handle);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Can't open connection to SDK from counter collector - %s.\n", SX_STATUS_MSG(sx_status));
+        return;
+    }
+
+    while (!g_counter_collector.is_stop_asked) {
+        target   = (0 == g_counter_collector.published) ? 1 : 0;
+        snapshot = &g_counter_collector.snapshots[target];
+
+        snapshot->seq++;
+        __sync_synchronize();
+        snapshot->generation = g_counter_collector.generation;
+        __sync_synchronize();
+        status = mlnx_counter_snapshot_collect(handle, snapshot);
+        __sync_synchronize();
+        snapshot->seq++;
+        __sync_synchronize();
+
+        /* Readers go to SDK until a collection succeeds again, a pass interrupted by a clear is dropped */
+        if (SAI_ERR(status) || (snapshot->generation != g_counter_collector.generation)) {
+            g_counter_collector.published = MLNX_COUNTER_SNAPSHOT_NONE;
+        } else {
+            g_counter_collector.published = target;
+        }
+
+        for (slept = 0; slept < g_counter_collector.interval_msec && !g_counter_collector.is_stop_asked;
+             slept += MLNX_COUNTER_COLLECTOR_STOP_POLL_MSEC) {
+            usleep(MIN(MLNX_COUNTER_COLLECTOR_STOP_POLL_MSEC, g_counter_collector.interval_msec - slept) * 1000);
+        }
+    }
+
+    g_counter_collector.published = MLNX_COUNTER_SNAPSHOT_NONE;
+
+    sx_status = sx_api_close(&handle);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Failed to close SDK handle of counter collector - %s.\n", SX_STATUS_MSG(sx_status));
+    }
+}
+
+/* Buffers are allocated once and kept for the process lifetime, a failed allocation is retried on next start */
+static sai_status_t mlnx_counter_collector_buffers_alloc(void)
+{
+    const mlnx_sai_buffer_resource_limits_t *limits = mlnx_sai_get_buffer_resource_limits();
+    mlnx_counter_snapshot_t                 *snapshot;
+    uint32_t                                 ii;
+
+    g_counter_collector.pools_count      = limits->num_ingress_pools + limits->num_egress_pools;
+    g_counter_collector.pgs_count        = limits->num_port_pg_buff;
+    g_counter_collector.tcs_count        = limits->num_port_queue_buff;
+    g_counter_collector.port_stats_count = g_counter_collector.pgs_count + g_counter_collector.tcs_count;
+
+    if (!g_counter_collector.pool_ids) {
+        g_counter_collector.pool_ids = calloc(g_counter_collector.pools_count, sizeof(*g_counter_collector.pool_ids));
+    }
+    if (!g_counter_collector.pgs) {
+        g_counter_collector.pgs = calloc(g_counter_collector.pgs_count, sizeof(*g_counter_collector.pgs));
+    }
+    if (!g_counter_collector.tcs) {
+        g_counter_collector.tcs = calloc(g_counter_collector.tcs_count, sizeof(*g_counter_collector.tcs));
+    }
+    if (!g_counter_collector.pool_ids || !g_counter_collector.pgs || !g_counter_collector.tcs) {
+        return SAI_STATUS_NO_MEMORY;
+    }
+
+    for (ii = 0; ii < MLNX_SAI_ARRAY_LEN(g_counter_collector.snapshots); ii++) {
+        snapshot = &g_counter_collector.snapshots[ii];
+        if (!snapshot->pools) {
+            snapshot->pools = calloc(g_counter_collector.pools_count, sizeof(*snapshot->pools));
+        }
+        if (!snapshot->port_stats) {
+            snapshot->port_stats = calloc(MAX_PORTS * g_counter_collector.port_stats_count,
+                                          sizeof(*snapshot->port_stats));
+        }
+        if (!snapshot->pools || !snapshot->port_stats) {
+            return SAI_STATUS_NO_MEMORY;
+        }
+    }
+
+    for (ii = 0; ii < limits->num_ingress_pools; ii++) {
+        g_counter_collector.pool_ids[ii] = BASE_INGRESS_USER_SX_POOL_ID + ii;
+    }
+    for (ii = 0; ii < limits->num_egress_pools; ii++) {
+        g_counter_collector.pool_ids[limits->num_ingress_pools + ii] = BASE_EGRESS_USER_SX_POOL_ID + ii;
+    }
+    for (ii = 0; ii < g_counter_collector.pgs_count; ii++) {
+        g_counter_collector.pgs[ii] = ii;
+    }
+    for (ii = 0; ii < g_counter_collector.tcs_count; ii++) {
+        g_counter_collector.tcs[ii] = (uint8_t)ii;
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/* Counters snapshots are allocated only once they're requested, the collector doesn't touch them before */
+static sai_status_t mlnx_counter_collector_counters_alloc(void)
+{
+    mlnx_counter_snapshot_t *snapshot;
+    uint32_t                 ii;
+
+    g_counter_collector.acl_counters_max  = ACL_MAX_COUNTER_NUM;
+    g_counter_collector.rif_counters_max  = MIN(MAX_RIFS, g_resource_limits.router_rifs_max);
+    g_counter_collector.vlan_counters_max = SXD_VID_MAX;
+
+    for (ii = 0; ii < MLNX_SAI_ARRAY_LEN(g_counter_collector.snapshots); ii++) {
+        snapshot = &g_counter_collector.snapshots[ii];
+
+        if (!snapshot->port_counters) {
+            snapshot->port_counters = calloc(MAX_PORTS, sizeof(*snapshot->port_counters));
+        }
+        if (!snapshot->tc_counters) {
+            snapshot->tc_counters = calloc(MAX_PORTS * g_counter_collector.tcs_count,
+                                           sizeof(*snapshot->tc_counters));
+        }
+        if (!snapshot->pg_counters) {
+            snapshot->pg_counters = calloc(MAX_PORTS * g_counter_collector.pgs_count,
+                                           sizeof(*snapshot->pg_counters));
+        }
+        if (!snapshot->acl_counters) {
+            snapshot->acl_counters = calloc(g_counter_collector.acl_counters_max, sizeof(*snapshot->acl_counters));
+        }
+        if (!snapshot->rif_counters) {
+            snapshot->rif_counters = calloc(g_counter_collector.rif_counters_max, sizeof(*snapshot->rif_counters));
+        }
+        if (!snapshot->vlan_counters) {
+            snapshot->vlan_counters = calloc(g_counter_collector.vlan_counters_max,
+                                             sizeof(*snapshot->vlan_counters));
+        }
+        if (!snapshot->port_counters || !snapshot->tc_counters || !snapshot->pg_counters ||
+            !snapshot->acl_counters || !snapshot->rif_counters || !snapshot->vlan_counters) {
+            SX_LOG_ERR("Failed to allocate counter snapshots\n");
+            return SAI_STATUS_NO_MEMORY;
+        }
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/* Starts the collector or changes the interval/counters of the running one */
+sai_status_t mlnx_counter_collector_start(_In_ uint32_t interval_msec, _In_ bool with_counters)
+{
+    sai_status_t status;
+
+    if (0 == interval_msec) {
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    pthread_mutex_lock(&g_counter_collector_mutex);
+
+    /* The counters snapshots are sized by the limits taken here */
+    if (!g_counter_collector.is_started) {
+        status = mlnx_counter_collector_buffers_alloc();
+        if (SAI_ERR(status)) {
+            SX_LOG_ERR("Failed to allocate counter snapshots\n");
+            goto out;
+        }
+    }
+
+    if (with_counters && !g_counter_collector.with_counters) {
+        status = mlnx_counter_collector_counters_alloc();
+        if (SAI_ERR(status)) {
+            goto out;
+        }
+        __sync_synchronize();
+    }
+
+    if (g_counter_collector.is_started) {
+        g_counter_collector.interval_msec = interval_msec;
+        g_counter_collector.with_counters = with_counters;
+        mlnx_counter_collector_invalidate();
+
+        SX_LOG_NTC("Counter collector interval %u msec, counters %s\n", interval_msec,
+                   with_counters ? "enabled" : "disabled");
+        status = SAI_STATUS_SUCCESS;
+        goto out;
+    }
+
+    g_counter_collector.interval_msec = interval_msec;
+    g_counter_collector.with_counters = with_counters;
+    g_counter_collector.is_stop_asked = false;
+
+    if (CL_SUCCESS != cl_thread_init(&g_counter_collector.thread, mlnx_counter_collector_func, NULL, NULL)) {
+        SX_LOG_ERR("Failed to create counter collector thread\n");
+        status = SAI_STATUS_FAILURE;
+        goto out;
+    }
+
+    g_counter_collector.is_started = true;
+    SX_LOG_NTC("Counter collector started, interval %u msec, counters %s\n", interval_msec,
+               with_counters ? "enabled" : "disabled");
+
+out:
+    pthread_mutex_unlock(&g_counter_collector_mutex);
+    return status;
+}
+
+/* Stops publishing, the snapshot buffers stay allocated as lock free readers may still use them */
+void mlnx_counter_collector_stop(void)
+{
+    pthread_mutex_lock(&g_counter_collector_mutex);
+
+    if (g_counter_collector.is_started) {
+        g_counter_collector.is_stop_asked = true;
+        /* cl_thread_destroy() waits for the thread to exit */
+        cl_thread_destroy(&g_counter_collector.thread);
+
+        g_counter_collector.published     = MLNX_COUNTER_SNAPSHOT_NONE;
+        g_counter_collector.with_counters = false;
+        g_counter_collector.is_started    = false;
+        __sync_synchronize();
+    }
+
+    pthread_mutex_unlock(&g_counter_collector_mutex);
+}
+
+static mlnx_counter_snapshot_t* mlnx_counter_snapshot_begin(_Out_ uint32_t *seq)
+{
+    mlnx_counter_snapshot_t *snapshot;
+    uint32_t                 published;
+
+    published = g_counter_collector.published;
+    if (MLNX_COUNTER_SNAPSHOT_NONE == published) {
+        return NULL;
+    }
+
+    snapshot = &g_counter_collector.snapshots[published];
+    *seq     = snapshot->seq;
+    __sync_synchronize();
+
+    if ((*seq & 1) || (snapshot->generation != g_counter_collector.generation)) {
+        return NULL;
+    }
+
+    return snapshot;
+}
+
+static bool mlnx_counter_snapshot_end(_In_ const mlnx_counter_snapshot_t *snapshot, _In_ uint32_t seq)
+{
+    __sync_synchronize();
+    return seq == snapshot->seq;
+}
+
+bool mlnx_watermark_pool_get(_In_ uint32_t sx_pool_id, _Out_ sx_cos_pool_occupancy_statistics_t *stats)
+{
+    mlnx_counter_snapshot_t *snapshot;
+    uint32_t                 seq, ii;
+
+    snapshot = mlnx_counter_snapshot_begin(&seq);
+    if (!snapshot) {
+        return false;
+    }
+
+    for (ii = 0; ii < g_counter_collector.pools_count; ii++) {
+        if (g_counter_collector.pool_ids[ii] == sx_pool_id) {
+            *stats = snapshot->pools[ii];
+            return mlnx_counter_snapshot_end(snapshot, seq);
+        }
+    }
+
+    return false;
+}
+
+static bool mlnx_watermark_port_buff_get(_In_ sx_port_log_id_t                 log_port,
+                                         _In_ uint32_t                         stat_ind,
+                                         _Out_ sx_port_occupancy_statistics_t *stats)
+{
+    mlnx_counter_snapshot_t *snapshot;
+    uint32_t                 seq, ports_count, ii;
+
+    snapshot = mlnx_counter_snapshot_begin(&seq);
+    if (!snapshot) {
+        return false;
+    }
+
+    ports_count = MIN(snapshot->ports_count, MAX_PORTS);
+    for (ii = 0; ii < ports_count; ii++) {
+        if (snapshot->log_ports[ii] == log_port) {
+            *stats = snapshot->port_stats[ii * g_counter_collector.port_stats_count + stat_ind];
+            return mlnx_counter_snapshot_end(snapshot, seq);
+        }
+    }
+
+    return false;
+}
+
+bool mlnx_watermark_pg_get(_In_ sx_port_log_id_t                 log_port,
+                           _In_ uint32_t                         pg,
+                           _Out_ sx_port_occupancy_statistics_t *stats)
+{
+    if (pg >= g_counter_collector.pgs_count) {
+        return false;
+    }
+
+    return mlnx_watermark_port_buff_get(log_port, pg, stats);
+}
+
+bool mlnx_watermark_queue_get(_In_ sx_port_log_id_t                 log_port,
+                              _In_ uint32_t                         queue,
+                              _Out_ sx_port_occupancy_statistics_t *stats)
+{
+    if (queue >= g_counter_collector.tcs_count) {
+        return false;
+    }
+
+    return mlnx_watermark_port_buff_get(log_port, g_counter_collector.pgs_count + queue, stats);
+}
+
+static bool mlnx_counter_snapshot_port_index(_In_ const mlnx_counter_snapshot_t *snapshot,
+                                             _In_ sx_port_log_id_t               log_port,
+                                             _Out_ uint32_t                     *index)
+{
+    uint32_t ports_count, ii;
+
+    if (!snapshot->has_counters) {
+        return false;
+    }
+
+    ports_count = MIN(snapshot->ports_count, MAX_PORTS);
+    for (ii = 0; ii < ports_count; ii++) {
+        if (snapshot->log_ports[ii] == log_port) {
+            *index = ii;
+            return snapshot->port_counters_valid[ii];
+        }
+    }
+
+    return false;
+}
+
+bool mlnx_counter_port_get(_In_ sx_port_log_id_t log_port, _Out_ mlnx_port_counters_t *counters)
+{
+    mlnx_counter_snapshot_t *snapshot;
+    uint32_t                 seq, index;
+
+    snapshot = mlnx_counter_snapshot_begin(&seq);
+    if (!snapshot || !mlnx_counter_snapshot_port_index(snapshot, log_port, &index)) {
+        return false;
+    }
+
+    *counters = snapshot->port_counters[index];
+
+    return mlnx_counter_snapshot_end(snapshot, seq);
+}
+
+bool mlnx_counter_tc_get(_In_ sx_port_log_id_t log_port, _In_ uint32_t tc, _Out_ sx_port_traffic_cntr_t *counters)
+{
+    mlnx_counter_snapshot_t *snapshot;
+    uint32_t                 seq, index;
+
+    if (tc >= g_counter_collector.tcs_count) {
+        return false;
+    }
+
+    snapshot = mlnx_counter_snapshot_begin(&seq);
+    if (!snapshot || !mlnx_counter_snapshot_port_index(snapshot, log_port, &index)) {
+        return false;
+    }
+
+    *counters = snapshot->tc_counters[index * g_counter_collector.tcs_count + tc];
+
+    return mlnx_counter_snapshot_end(snapshot, seq);
+}
+
+bool mlnx_counter_pg_get(_In_ sx_port_log_id_t log_port, _In_ uint32_t pg, _Out_ sx_port_cntr_buff_t *counters)
+{
+    mlnx_counter_snapshot_t *snapshot;
+    uint32_t                 seq, index;
+
+    if (pg >= g_counter_collector.pgs_count) {
+        return false;
+    }
+
+    snapshot = mlnx_counter_snapshot_begin(&seq);
+    if (!snapshot || !mlnx_counter_snapshot_port_index(snapshot, log_port, &index)) {
+        return false;
+    }
+
+    *counters = snapshot->pg_counters[index * g_counter_collector.pgs_count + pg];
+
+    return mlnx_counter_snapshot_end(snapshot, seq);
+}
+
+/* ACL counters are collected sorted by the DB index, the SX counter id tells if the entry was reused since */
+bool mlnx_counter_acl_get(_In_ uint32_t               index,
+                          _In_ sx_flow_counter_id_t   counter_id,
+                          _Out_ sx_flow_counter_set_t *value)
+{
+    mlnx_counter_snapshot_t *snapshot;
+    uint32_t                 seq, count, low, high, mid;
+
+    snapshot = mlnx_counter_snapshot_begin(&seq);
+    if (!snapshot || !snapshot->has_counters) {
+        return false;
+    }
+
+    count = MIN(snapshot->acl_counters_count, g_counter_collector.acl_counters_max);
+    low   = 0;
+    high  = count;
+    while (low < high) {
+        mid = low + (high - low) / 2;
+        if (snapshot->acl_counters[mid].index < index) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    if ((low == count) || (snapshot->acl_counters[low].index != index) ||
+        (snapshot->acl_counters[low].counter_id != counter_id) || !snapshot->acl_counters[low].is_valid) {
+        return false;
+    }
+
+    *value = snapshot->acl_counters[low].value;
+
+    return mlnx_counter_snapshot_end(snapshot, seq);
+}
+
+/* RIF counters are collected sorted by the SDK rif id, the counter id tells if the RIF was recreated since */
+bool mlnx_counter_rif_get(_In_ sx_router_interface_t     rif_id,
+                          _In_ sx_router_counter_id_t    counter_id,
+                          _Out_ sx_router_counter_set_t *value)
+{
+    mlnx_counter_snapshot_t *snapshot;
+    uint32_t                 seq, count, low, high, mid;
+
+    snapshot = mlnx_counter_snapshot_begin(&seq);
+    if (!snapshot || !snapshot->has_counters) {
+        return false;
+    }
+
+    count = MIN(snapshot->rif_counters_count, g_counter_collector.rif_counters_max);
+    low   = 0;
+    high  = count;
+    while (low < high) {
+        mid = low + (high - low) / 2;
+        if (snapshot->rif_counters[mid].rif_id < rif_id) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    if ((low == count) || (snapshot->rif_counters[low].rif_id != rif_id) ||
+        (snapshot->rif_counters[low].counter_id != counter_id) || !snapshot->rif_counters[low].is_valid) {
+        return false;
+    }
+
+    *value = snapshot->rif_counters[low].value;
+
+    return mlnx_counter_snapshot_end(snapshot, seq);
+}
+
+/* VLAN counters are collected sorted by the VLAN id, the counter id tells if it was rebound since */
+bool mlnx_counter_vlan_get(_In_ sx_vlan_id_t           vlan_id,
+                           _In_ sx_flow_counter_id_t   counter_id,
+                           _Out_ sx_flow_counter_set_t *value)
+{
+    mlnx_counter_snapshot_t *snapshot;
+    uint32_t                 seq, count, low, high, mid;
+
+    snapshot = mlnx_counter_snapshot_begin(&seq);
+    if (!snapshot || !snapshot->has_counters) {
+        return false;
+    }
+
+    count = MIN(snapshot->vlan_counters_count, g_counter_collector.vlan_counters_max);
+    low   = 0;
+    high  = count;
+    while (low < high) {
+        mid = low + (high - low) / 2;
+        if (snapshot->vlan_counters[mid].vlan_id < vlan_id) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    if ((low == count) || (snapshot->vlan_counters[low].vlan_id != vlan_id) ||
+        (snapshot->vlan_counters[low].counter_id != counter_id) || !snapshot->vlan_counters[low].is_valid) {
+        return false;
+    }
+
+    *value = snapshot->vlan_counters[low].value;
+
+    return mlnx_counter_snapshot_end(snapshot, seq);
+}
+
+sai_status_t mlnx_counter_log_set(sx_verbosity_level_t level)
+{
+    LOG_VAR_NAME(__MODULE__) = level;
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/* Makes the readers go to SDK until the next collection, called after the counters are cleared */
+void mlnx_counter_collector_invalidate(void)
+{
+    __sync_fetch_and_add(&g_counter_collector.generation, 1);
+    g_counter_collector.published = MLNX_COUNTER_SNAPSHOT_NONE;
+    __sync_synchronize();
+}
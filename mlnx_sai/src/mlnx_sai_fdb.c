@@ -92,7 +92,7 @@ static sai_status_t mlnx_add_or_del_mac(sx_fdb_uc_mac_addr_params_t *mac_entry,
 
     SX_LOG_ENTER();
 
-    status = sx_api_fdb_uc_mac_addr_set(gh_sdk, cmd, DEFAULT_ETH_SWID, mac_entry, &entries_count);
+    status = MLNX_PERF_SDK_CALL(sx_api_fdb_uc_mac_addr_set(gh_sdk, cmd, DEFAULT_ETH_SWID, mac_entry, &entries_count));
     if (SX_ERR(status)) {
         SX_LOG_ERR("Failed to %s %d fdb entries %s.\n", cmd_name, entries_count, SX_STATUS_MSG(status));
         SX_LOG_ERR("[%02x:%02x:%02x:%02x:%02x:%02x], vlan %d, log port 0x%x, entry type %u, action %u, dest type %u\n",
@@ -306,9 +306,9 @@ static void fdb_key_to_str(_In_ const sai_fdb_entry_t* fdb_entry, _Out_ char *ke
  *    SAI_STATUS_SUCCESS on success
  *    Failure status code on error
  */
-static sai_status_t mlnx_create_fdb_entry(_In_ const sai_fdb_entry_t* fdb_entry,
-                                          _In_ uint32_t               attr_count,
-                                          _In_ const sai_attribute_t *attr_list)
+static sai_status_t mlnx_create_fdb_entry_impl(_In_ const sai_fdb_entry_t* fdb_entry,
+                                               _In_ uint32_t               attr_count,
+                                               _In_ const sai_attribute_t *attr_list)
 {
     sai_status_t                 status, ip_status;
     const sai_attribute_value_t *type, *action, *port, *ip_addr;
@@ -450,6 +450,19 @@ out:
     return status;
 }
 
+static sai_status_t mlnx_create_fdb_entry(_In_ const sai_fdb_entry_t* fdb_entry,
+                                          _In_ uint32_t               attr_count,
+                                          _In_ const sai_attribute_t *attr_list)
+{
+    sai_status_t status;
+
+    mlnx_perf_op_begin(SAI_OBJECT_TYPE_FDB_ENTRY, MLNX_PERF_OP_CREATE);
+    status = mlnx_create_fdb_entry_impl(fdb_entry, attr_count, attr_list);
+    mlnx_perf_op_end(status);
+
+    return status;
+}
+
 /*
  * Routine Description:
  *    Remove FDB entry
@@ -461,7 +474,7 @@ out:
  *    SAI_STATUS_SUCCESS on success
  *    Failure status code on error
  */
-static sai_status_t mlnx_remove_fdb_entry(_In_ const sai_fdb_entry_t* fdb_entry)
+static sai_status_t mlnx_remove_fdb_entry_impl(_In_ const sai_fdb_entry_t* fdb_entry)
 {
     sx_fdb_uc_mac_addr_params_t mac_entry;
     sai_status_t                status;
@@ -487,6 +500,17 @@ out:
     return status;
 }
 
+static sai_status_t mlnx_remove_fdb_entry(_In_ const sai_fdb_entry_t* fdb_entry)
+{
+    sai_status_t status;
+
+    mlnx_perf_op_begin(SAI_OBJECT_TYPE_FDB_ENTRY, MLNX_PERF_OP_REMOVE);
+    status = mlnx_remove_fdb_entry_impl(fdb_entry);
+    mlnx_perf_op_end(status);
+
+    return status;
+}
+
 /*
  * Routine Description:
  *    Set fdb entry attribute value
@@ -1006,6 +1030,10 @@ sai_status_t mlnx_fdb_flood_control_set(_In_ sx_vid_t                vlan_id,
             SX_LOG_ERR("Failed to update FDB ucast flood list - %s.\n", SX_STATUS_MSG(sx_status));
             return sdk_to_sai(sx_status);
         }
+
+        if (add && ports_count) {
+            mlnx_fdb_flood_ctrl_type_mark(vlan_id, SX_FLOOD_CONTROL_TYPE_UNICAST_E, true);
+        }
     }
 
     if (g_sai_db_ptr->flood_action_bc == SAI_PACKET_ACTION_DROP) {
@@ -1015,11 +1043,33 @@ sai_status_t mlnx_fdb_flood_control_set(_In_ sx_vid_t                vlan_id,
             SX_LOG_ERR("Failed to update FDB bcast flood list - %s.\n", SX_STATUS_MSG(sx_status));
             return sdk_to_sai(sx_status);
         }
+
+        if (add && ports_count) {
+            mlnx_fdb_flood_ctrl_type_mark(vlan_id, SX_FLOOD_CONTROL_TYPE_BROADCAST_E, true);
+        }
     }
 
     return SAI_STATUS_SUCCESS;
 }
 
+/*
+ * Tracks the VLANs which have a non empty flood list of the type in SDK, so changing
+ * the flood action back to forward only needs to clear these VLANs.
+ */
+void mlnx_fdb_flood_ctrl_type_mark(_In_ sx_vid_t vlan_id, _In_ sx_flood_control_type_t type, _In_ bool is_set)
+{
+    if (is_set) {
+        g_sai_db_ptr->vlans_db[vlan_id - 1].flood_ctrl_types |= (uint8_t)(1 << type);
+    } else {
+        g_sai_db_ptr->vlans_db[vlan_id - 1].flood_ctrl_types &= (uint8_t) ~(1 << type);
+    }
+}
+
+bool mlnx_fdb_flood_ctrl_type_is_set(_In_ sx_vid_t vlan_id, _In_ sx_flood_control_type_t type)
+{
+    return (g_sai_db_ptr->vlans_db[vlan_id - 1].flood_ctrl_types & (1 << type)) != 0;
+}
+
 sai_status_t mlnx_fdb_log_set(sx_verbosity_level_t level)
 {
     LOG_VAR_NAME(__MODULE__) = level;
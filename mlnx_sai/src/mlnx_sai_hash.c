@@ -99,7 +99,8 @@ static sai_status_t mlnx_hash_obj_create(sai_object_id_t* new_object)
 
     g_sai_db_ptr->hash_list[ii].hash_id = *new_object;
 
-    sai_db_sync();
+    sai_db_field_dirty_mark(hash_list[ii]);
+    sai_db_sync_async();
     sai_db_unlock();
     return status;
 }
@@ -129,6 +130,7 @@ static sai_status_t mlnx_hash_obj_native_fields_set(const sai_object_id_t hash_i
     }
 
     g_sai_db_ptr->hash_list[hash_data].field_mask = field_mask;
+    sai_db_field_dirty_mark(hash_list[hash_data]);
     return status;
 }
 
@@ -562,7 +564,81 @@ static sai_status_t mlnx_hash_convert_ecmp_sai_type_to_sx(const sai_attribute_va
     return SAI_STATUS_SUCCESS;
 }
 
-/* get ecmp hash port parameters for first port that is not a lag member
+static int mlnx_hash_ecmp_u32_cmp(const void *a, const void *b)
+{
+    const uint32_t va = *(const uint32_t*)a;
+    const uint32_t vb = *(const uint32_t*)b;
+
+    return (va > vb) - (va < vb);
+}
+
+/* Build the canonical form of ECMP hash config, field lists are sorted so that
+ * the same config always compiles to the same descriptor */
+static void mlnx_hash_ecmp_cfg_compile(_In_ const sx_router_ecmp_port_hash_params_t  *port_hash_param,
+                                       _In_ const sx_router_ecmp_hash_field_enable_t *hash_enable_list,
+                                       _In_ uint32_t                                  enable_count,
+                                       _In_ const sx_router_ecmp_hash_field_t        *hash_field_list,
+                                       _In_ uint32_t                                  field_count,
+                                       _Out_ mlnx_ecmp_hash_cfg_t                    *cfg)
+{
+    assert(enable_count <= FIELDS_ENABLES_NUM);
+    assert(field_count <= FIELDS_NUM);
+    assert(sizeof(sx_router_ecmp_hash_field_enable_t) == sizeof(uint32_t));
+    assert(sizeof(sx_router_ecmp_hash_field_t) == sizeof(uint32_t));
+
+    memset(cfg, 0, sizeof(*cfg));
+
+    cfg->params.ecmp_hash_type = port_hash_param->ecmp_hash_type;
+    cfg->params.seed           = port_hash_param->seed;
+    cfg->params.symmetric_hash = port_hash_param->symmetric_hash;
+
+    memcpy(cfg->enables, hash_enable_list, sizeof(*hash_enable_list) * enable_count);
+    memcpy(cfg->fields, hash_field_list, sizeof(*hash_field_list) * field_count);
+    cfg->enable_count = enable_count;
+    cfg->field_count  = field_count;
+
+    qsort(cfg->enables, enable_count, sizeof(*cfg->enables), mlnx_hash_ecmp_u32_cmp);
+    qsort(cfg->fields, field_count, sizeof(*cfg->fields), mlnx_hash_ecmp_u32_cmp);
+
+    cfg->is_valid = true;
+}
+
+static bool mlnx_hash_ecmp_cfg_equal(_In_ const mlnx_ecmp_hash_cfg_t *a, _In_ const mlnx_ecmp_hash_cfg_t *b)
+{
+    return (a->params.ecmp_hash_type == b->params.ecmp_hash_type) &&
+           (a->params.seed == b->params.seed) &&
+           (a->params.symmetric_hash == b->params.symmetric_hash) &&
+           (a->enable_count == b->enable_count) &&
+           (a->field_count == b->field_count) &&
+           (0 == memcmp(a->enables, b->enables, sizeof(*a->enables) * a->enable_count)) &&
+           (0 == memcmp(a->fields, b->fields, sizeof(*a->fields) * a->field_count));
+}
+
+/* SAI DB lock is needed */
+static sai_status_t mlnx_hash_ecmp_cfg_push(_In_ mlnx_port_config_t *port, _In_ const mlnx_ecmp_hash_cfg_t *cfg)
+{
+    sx_status_t sx_status;
+
+    sx_status = sx_api_router_ecmp_port_hash_params_set(gh_sdk, SX_ACCESS_CMD_SET, port->logical,
+                                                        &cfg->params,
+                                                        cfg->enables, cfg->enable_count,
+                                                        cfg->fields, cfg->field_count);
+    if (SX_STATUS_SUCCESS != sx_status) {
+        SX_LOG_ERR("Failed to set ecmp hash params for %s %x - %s.\n",
+                   mlnx_port_type_str(port),
+                   port->logical,
+                   SX_STATUS_MSG(sx_status));
+        return sdk_to_sai(sx_status);
+    }
+
+    port->ecmp_hash_version = cfg->version;
+    sai_db_dirty_mark(&port->ecmp_hash_version, sizeof(port->ecmp_hash_version));
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/* get operational ecmp hash port parameters.
+ * Taken from the compiled config, if there is no one yet - from the first port that is not a lag member
  * as we support global config so settings for all ports must be the same.
  * if all ports are in lag - get ecmp parameters for first lag. */
 sai_status_t mlnx_hash_get_oper_ecmp_fields(sx_router_ecmp_port_hash_params_t  *port_hash_param,
@@ -571,10 +647,20 @@ sai_status_t mlnx_hash_get_oper_ecmp_fields(sx_router_ecmp_port_hash_params_t  *
                                             sx_router_ecmp_hash_field_t        *hash_field_list,
                                             uint32_t                           *field_count)
 {
-    uint32_t            ii          = 0;
-    sx_port_log_id_t    port_log_id = 0;
-    sx_status_t         status      = SX_STATUS_SUCCESS;
-    mlnx_port_config_t *port;
+    const mlnx_ecmp_hash_cfg_t *cfg         = &g_sai_db_ptr->ecmp_hash_cfg;
+    uint32_t                    ii          = 0;
+    sx_port_log_id_t            port_log_id = 0;
+    sx_status_t                 status      = SX_STATUS_SUCCESS;
+    mlnx_port_config_t         *port;
+
+    if (cfg->is_valid && (*enable_count >= cfg->enable_count) && (*field_count >= cfg->field_count)) {
+        *port_hash_param = cfg->params;
+        memcpy(hash_enable_list, cfg->enables, sizeof(*hash_enable_list) * cfg->enable_count);
+        memcpy(hash_field_list, cfg->fields, sizeof(*hash_field_list) * cfg->field_count);
+        *enable_count = cfg->enable_count;
+        *field_count  = cfg->field_count;
+        return SAI_STATUS_SUCCESS;
+    }
 
     mlnx_port_not_in_lag_foreach(port, ii) {
         port_log_id = port->logical;
@@ -590,81 +676,90 @@ sai_status_t mlnx_hash_get_oper_ecmp_fields(sx_router_ecmp_port_hash_params_t  *
     return sdk_to_sai(status);
 }
 
-/* Get operational ECMP config and apply it for specified port */
+/* Apply the compiled ECMP config for a new port/LAG or a port which left the LAG */
 /* SAI DB lock is needed */
 sai_status_t mlnx_hash_ecmp_cfg_apply_on_port(sx_port_log_id_t port_log_id)
 {
-    sx_access_cmd_t                    cmd = SX_ACCESS_CMD_SET;
     sx_router_ecmp_port_hash_params_t  port_hash_param;
     sx_router_ecmp_hash_field_enable_t hash_enable_list[FIELDS_ENABLES_NUM];
     uint32_t                           enable_count = FIELDS_ENABLES_NUM;
     sx_router_ecmp_hash_field_t        hash_field_list[FIELDS_NUM];
     uint32_t                           field_count = FIELDS_NUM;
-    sx_status_t                        status      = SAI_STATUS_SUCCESS;
-    const mlnx_port_config_t           *port;
-    uint32_t                           ii;
-
-    memset(&port_hash_param, 0, sizeof(port_hash_param));
-    memset(hash_enable_list, 0, sizeof(hash_enable_list));
-    memset(hash_field_list, 0, sizeof(hash_field_list));
-
-    mlnx_port_not_in_lag_foreach(port, ii) {
-        if (port->logical == port_log_id) {
-            continue;
-        }
+    mlnx_ecmp_hash_cfg_t              *cfg         = &g_sai_db_ptr->ecmp_hash_cfg;
+    mlnx_port_config_t                *port;
+    sai_status_t                       status;
 
-        break;
+    status = mlnx_port_by_log_id(port_log_id, &port);
+    if (SAI_ERR(status)) {
+        return status;
     }
 
-    status = sx_api_router_ecmp_port_hash_params_get(gh_sdk, port->logical, &port_hash_param,
-                                                     hash_enable_list, &enable_count,
-                                                     hash_field_list, &field_count);
-    if (SX_ERR(status)) {
-        SX_LOG_ERR("Failed to get ECMP port %x hash params - %s.\n", port->logical, SX_STATUS_MSG(status));
-        return sdk_to_sai(status);
-    }
+    if (!cfg->is_valid) {
+        memset(&port_hash_param, 0, sizeof(port_hash_param));
+        memset(hash_enable_list, 0, sizeof(hash_enable_list));
+        memset(hash_field_list, 0, sizeof(hash_field_list));
 
-    status = sx_api_router_ecmp_port_hash_params_set(gh_sdk, cmd, port_log_id,
-                                                     &port_hash_param,
-                                                     hash_enable_list, enable_count,
-                                                     hash_field_list, field_count);
-    if (SX_ERR(status)) {
-        SX_LOG_ERR("Failed to set ECMP hash params for port %x.\n", port_log_id);
-        return sdk_to_sai(status);
+        status = mlnx_hash_get_oper_ecmp_fields(&port_hash_param, hash_enable_list, &enable_count,
+                                                hash_field_list, &field_count);
+        if (SAI_ERR(status)) {
+            return status;
+        }
+
+        mlnx_hash_ecmp_cfg_compile(&port_hash_param, hash_enable_list, enable_count,
+                                   hash_field_list, field_count, cfg);
+        cfg->version = 1;
+        sai_db_field_dirty_mark(ecmp_hash_cfg);
     }
 
-    return SAI_STATUS_SUCCESS;
+    return mlnx_hash_ecmp_cfg_push(port, cfg);
 }
 
+/* Compile the config and push it to the ports which don't have it yet */
+/* SAI DB write lock is needed */
 sai_status_t mlnx_hash_ecmp_hash_params_apply_to_ports(const sx_router_ecmp_port_hash_params_t  *port_hash_param,
                                                        const sx_router_ecmp_hash_field_enable_t *hash_enable_list,
                                                        uint32_t                                  enable_count,
                                                        const sx_router_ecmp_hash_field_t        *hash_field_list,
                                                        uint32_t                                  field_count)
 {
-    sx_status_t         sx_status;
-    mlnx_port_config_t *port;
-    uint32_t            ii;
+    mlnx_ecmp_hash_cfg_t *cfg = &g_sai_db_ptr->ecmp_hash_cfg;
+    mlnx_ecmp_hash_cfg_t  new_cfg;
+    mlnx_port_config_t   *port;
+    sai_status_t          status;
+    uint32_t              ii, updated = 0;
 
     assert(port_hash_param != NULL);
     assert(hash_enable_list != NULL);
     assert(hash_field_list != NULL);
 
+    mlnx_hash_ecmp_cfg_compile(port_hash_param, hash_enable_list, enable_count,
+                               hash_field_list, field_count, &new_cfg);
+
+    if (!cfg->is_valid || !mlnx_hash_ecmp_cfg_equal(cfg, &new_cfg)) {
+        new_cfg.version = cfg->version + 1;
+        if (0 == new_cfg.version) {
+            new_cfg.version = 1;
+        }
+
+        *cfg = new_cfg;
+        sai_db_field_dirty_mark(ecmp_hash_cfg);
+    }
 
     mlnx_port_not_in_lag_foreach(port, ii) {
-        sx_status = sx_api_router_ecmp_port_hash_params_set(gh_sdk, SX_ACCESS_CMD_SET, port->logical,
-                                                            port_hash_param,
-                                                            hash_enable_list, enable_count,
-                                                            hash_field_list, field_count);
-        if (SX_STATUS_SUCCESS != sx_status) {
-            SX_LOG_ERR("Failed to set ecmp hash params for %s %x - %s.\n",
-                       mlnx_port_type_str(port),
-                       port->logical,
-                       SX_STATUS_MSG(sx_status));
-            return sdk_to_sai(sx_status);
+        if (port->ecmp_hash_version == cfg->version) {
+            continue;
         }
+
+        status = mlnx_hash_ecmp_cfg_push(port, cfg);
+        if (SAI_ERR(status)) {
+            return status;
+        }
+
+        updated++;
     }
 
+    SX_LOG_DBG("ECMP hash config version %u applied to %u ports\n", cfg->version, updated);
+
     return SAI_STATUS_SUCCESS;
 }
 
@@ -684,7 +779,7 @@ sai_status_t mlnx_hash_ecmp_hash_params_apply(const sai_attr_id_t attr_id, const
     memset(hash_enable_list, 0, sizeof(hash_enable_list));
     memset(hash_field_list, 0, sizeof(hash_field_list));
 
-    sai_db_read_lock();
+    sai_db_write_lock();
 
     status = mlnx_hash_get_oper_ecmp_fields(&port_hash_param, hash_enable_list, &enable_count,
                                             hash_field_list, &field_count);
@@ -719,6 +814,7 @@ sai_status_t mlnx_hash_ecmp_hash_params_apply(const sai_attr_id_t attr_id, const
     }
 
 out:
+    sai_db_sync_async();
     sai_db_unlock();
     return status;
 }
@@ -953,9 +1049,10 @@ static sai_status_t mlnx_hash_obj_remove(sai_object_id_t hash_id)
     g_sai_db_ptr->hash_list[hash_data].field_mask     = 0;
     g_sai_db_ptr->hash_list[hash_data].udf_group_mask = MLNX_UDF_GROUP_MASK_EMPTY;
     g_sai_db_ptr->hash_list[hash_data].hash_id        = SAI_NULL_OBJECT_ID;
+    sai_db_field_dirty_mark(hash_list[hash_data]);
 
 out:
-    sai_db_sync();
+    sai_db_sync_async();
     sai_db_unlock();
     return status;
 }
@@ -1033,6 +1130,7 @@ sai_status_t mlnx_hash_initialize()
     attr_value.s32list.list  = def_hash_fields;
 
     memset(g_sai_db_ptr->hash_list, 0, sizeof(g_sai_db_ptr->hash_list));
+    memset(&g_sai_db_ptr->ecmp_hash_cfg, 0, sizeof(g_sai_db_ptr->ecmp_hash_cfg));
 
     /* Create default hash objects */
     /* Default ECMP object */
@@ -1192,7 +1290,7 @@ static sai_status_t mlnx_hash_native_field_list_set(_In_ const sai_object_key_t
     }
 
 out:
-    sai_db_sync();
+    sai_db_sync_async();
     sai_db_unlock();
     return status;
 }
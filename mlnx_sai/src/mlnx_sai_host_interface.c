@@ -602,13 +602,13 @@ static sai_status_t mlnx_create_host_interface(_Out_ sai_object_id_t     * hif_i
         /* TODO : temporary WA for SwitchX. L2 and Router port are created with port MAC. But since we want to use them for
          * routing, we set them with the router MAC to avoid mismatch of the MAC value.
          */
-        cl_plock_acquire(&g_sai_db_ptr->p_lock);
+        sai_db_read_lock();
         snprintf(command,
                  sizeof(command),
                  "ip link set dev %s address %s > /dev/null 2>&1",
                  name->chardata,
                  g_sai_db_ptr->dev_mac);
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
 
         system_err = system(command);
         if (0 != system_err) {
@@ -637,7 +637,7 @@ static sai_status_t mlnx_create_host_interface(_Out_ sai_object_id_t     * hif_i
             return SAI_STATUS_INVALID_ATTRIBUTE_0 + name_index;
         }
 
-        cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+        sai_db_write_lock();
 
         for (ii = 0; ii < MAX_FDS; ii++) {
             if (false == g_sai_db_ptr->fd_db[ii].valid) {
@@ -647,18 +647,19 @@ static sai_status_t mlnx_create_host_interface(_Out_ sai_object_id_t     * hif_i
 
         if (MAX_FDS == ii) {
             SX_LOG_ERR("FDs table full\n");
-            cl_plock_release(&g_sai_db_ptr->p_lock);
+            sai_db_unlock();
             return SAI_STATUS_TABLE_FULL;
         }
 
         if (SX_STATUS_SUCCESS != (status = sx_api_host_ifc_open(gh_sdk, &g_sai_db_ptr->fd_db[ii]))) {
             SX_LOG_ERR("host ifc open fd failed - %s.\n", SX_STATUS_MSG(status));
-            cl_plock_release(&g_sai_db_ptr->p_lock);
+            sai_db_unlock();
             return status;
         }
 
-        msync(g_sai_db_ptr, sizeof(*g_sai_db_ptr), MS_SYNC);
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_field_dirty_mark(fd_db[ii]);
+        sai_db_sync();
+        sai_db_unlock();
         hif_data                = ii;
         mlnx_hif.field.sub_type = SAI_HOSTIF_OBJECT_TYPE_FD;
     } else {
@@ -716,16 +717,17 @@ static sai_status_t mlnx_remove_host_interface(_In_ sai_object_id_t hif_id)
             return SAI_STATUS_INVALID_PARAMETER;
         }
 
-        cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+        sai_db_write_lock();
 
         if (SX_STATUS_SUCCESS != (status = sx_api_host_ifc_close(gh_sdk, &g_sai_db_ptr->fd_db[mlnx_hif.id.u32]))) {
             SX_LOG_ERR("host ifc close fd failed - %s.\n", SX_STATUS_MSG(status));
-            cl_plock_release(&g_sai_db_ptr->p_lock);
+            sai_db_unlock();
             return status;
         }
 
-        msync(g_sai_db_ptr, sizeof(*g_sai_db_ptr), MS_SYNC);
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_field_dirty_mark(fd_db[mlnx_hif.id.u32]);
+        sai_db_sync();
+        sai_db_unlock();
     } else {
         if (NULL == if_indextoname(mlnx_hif.id.u32, ifname)) {
             SX_LOG_ERR("Cannot find ifindex %u\n", mlnx_hif.id.u32);
@@ -1403,19 +1405,19 @@ static sai_status_t mlnx_remove_hostif_trap_group(_In_ sai_object_id_t hostif_tr
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_write_lock();
     if (false == g_sai_db_ptr->trap_group_valid[group_id]) {
         SX_LOG_ERR("Invalid group id %u\n", group_id);
         status = SAI_STATUS_INVALID_PARAMETER;
     } else {
         if (SAI_STATUS_SUCCESS != (status = mlnx_sai_unbind_policer_from_trap_group(hostif_trap_group_id))) {
-            cl_plock_release(&g_sai_db_ptr->p_lock);
+            sai_db_unlock();
             SX_LOG_EXIT();
             return status;
         }
         g_sai_db_ptr->trap_group_valid[group_id] = false;
     }
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_unlock();
     SX_LOG_EXIT();
     return status;
 }
@@ -1574,23 +1576,23 @@ sai_status_t mlnx_create_hostif_trap(_Out_ sai_object_id_t      *hostif_trap_id,
         }
     }
 
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_write_lock();
 
     if (SAI_STATUS_SUCCESS != (status = mlnx_trap_set(index, action->s32, (group) ? group->oid :
                                                       g_sai_db_ptr->default_trap_group))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         return status;
     }
 
     g_sai_db_ptr->traps_db[index].action     = action->s32;
     g_sai_db_ptr->traps_db[index].trap_group = (group) ? group->oid : g_sai_db_ptr->default_trap_group;
 
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_unlock();
 
     if (SAI_STATUS_SUCCESS ==
         find_attrib_in_list(attr_count, attr_list, SAI_HOSTIF_TRAP_ATTR_EXCLUDE_PORT_LIST, &exclude, &exclude_index)) {
         if (SAI_STATUS_SUCCESS != (status = mlnx_trap_filter_set(index, exclude->objlist))) {
-            cl_plock_release(&g_sai_db_ptr->p_lock);
+            sai_db_unlock();
             return status;
         }
     }
@@ -1637,23 +1639,23 @@ sai_status_t mlnx_remove_hostif_trap(_In_ sai_object_id_t hostif_trap_id)
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_write_lock();
     g_sai_db_ptr->traps_db[index].action     = mlnx_traps_info[index].action;
     g_sai_db_ptr->traps_db[index].trap_group = g_sai_db_ptr->default_trap_group;
 
     if (SAI_STATUS_SUCCESS != (status = mlnx_trap_set(index, mlnx_traps_info[index].action,
                                                       g_sai_db_ptr->default_trap_group))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         return status;
     }
 
     exclude.count = 0;
     if (SAI_STATUS_SUCCESS != (status = mlnx_trap_filter_set(index, exclude))) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         return status;
     }
 
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_unlock();
 
     SX_LOG_EXIT();
     return status;
@@ -1780,20 +1782,20 @@ sai_status_t mlnx_create_hostif_user_defined_trap(_Out_ sai_object_id_t      *ho
         }
     }
 
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_write_lock();
 
     if (0 < mlnx_traps_info[index].sdk_traps_num) {
         if (SAI_STATUS_SUCCESS !=
             (status = mlnx_trap_set(index, g_sai_db_ptr->traps_db[index].action, (group) ? group->oid :
                                     g_sai_db_ptr->default_trap_group))) {
-            cl_plock_release(&g_sai_db_ptr->p_lock);
+            sai_db_unlock();
             return status;
         }
     }
 
     g_sai_db_ptr->traps_db[index].trap_group = (group) ? group->oid : g_sai_db_ptr->default_trap_group;
 
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_unlock();
 
     if (SAI_STATUS_SUCCESS !=
         (status =
@@ -1840,19 +1842,19 @@ sai_status_t mlnx_remove_hostif_user_defined_trap(_In_ sai_object_id_t hostif_us
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_write_lock();
     g_sai_db_ptr->traps_db[index].action     = mlnx_traps_info[index].action;
     g_sai_db_ptr->traps_db[index].trap_group = g_sai_db_ptr->default_trap_group;
 
     if (0 < mlnx_traps_info[index].sdk_traps_num) {
         if (SAI_STATUS_SUCCESS != (status = mlnx_trap_set(index, mlnx_traps_info[index].action,
                                                           g_sai_db_ptr->default_trap_group))) {
-            cl_plock_release(&g_sai_db_ptr->p_lock);
+            sai_db_unlock();
             return status;
         }
     }
 
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_unlock();
 
     SX_LOG_EXIT();
     return status;
@@ -1936,9 +1938,9 @@ static sai_status_t mlnx_trap_record_get(_In_ uint32_t         trap_id,
         return status;
     }
 
-    cl_plock_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_read_lock();
     memcpy(trap_record, &g_sai_db_ptr->traps_db[index], sizeof(*trap_record));
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_unlock();
 
     return SAI_STATUS_SUCCESS;
 }
@@ -2122,15 +2124,16 @@ static sai_status_t mlnx_trap_action_set(_In_ const sai_object_key_t      *key,
         return status;
     }
 
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_write_lock();
     if (SAI_STATUS_SUCCESS != (status = mlnx_trap_set(index, value->s32, g_sai_db_ptr->traps_db[index].trap_group))) {
         goto out;
     }
     g_sai_db_ptr->traps_db[index].action = value->s32;
 
 out:
-    msync(g_sai_db_ptr, sizeof(*g_sai_db_ptr), MS_SYNC);
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_field_dirty_mark(traps_db[index]);
+    sai_db_sync_async();
+    sai_db_unlock();
     return status;
 }
 
@@ -2248,15 +2251,16 @@ static sai_status_t mlnx_trap_group_set(_In_ const sai_object_key_t      *key,
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_write_lock();
     if (SAI_STATUS_SUCCESS != (status = mlnx_trap_set(index, g_sai_db_ptr->traps_db[index].action, value->oid))) {
         goto out;
     }
     g_sai_db_ptr->traps_db[index].trap_group = value->oid;
 
 out:
-    msync(g_sai_db_ptr, sizeof(*g_sai_db_ptr), MS_SYNC);
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_field_dirty_mark(traps_db[index]);
+    sai_db_sync_async();
+    sai_db_unlock();
     return status;
 }
 
@@ -2340,15 +2344,16 @@ static sai_status_t mlnx_user_defined_trap_group_set(_In_ const sai_object_key_t
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_write_lock();
     if (SAI_STATUS_SUCCESS != (status = mlnx_trap_set(index, g_sai_db_ptr->traps_db[index].action, value->oid))) {
         goto out;
     }
     g_sai_db_ptr->traps_db[index].trap_group = value->oid;
 
 out:
-    msync(g_sai_db_ptr, sizeof(*g_sai_db_ptr), MS_SYNC);
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_field_dirty_mark(traps_db[index]);
+    sai_db_sync_async();
+    sai_db_unlock();
     return status;
 }
 
@@ -2436,9 +2441,9 @@ static sai_status_t mlnx_recv_hostif_packet(_In_ sai_object_id_t   hif_id,
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    cl_plock_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_read_lock();
     memcpy(&fd, &g_sai_db_ptr->fd_db[mlnx_hif.id.u32], sizeof(fd));
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_unlock();
 
     packet_size = (uint32_t)*buffer_size;
     if (SX_STATUS_SUCCESS != (status = sx_lib_host_ifc_recv(&fd, buffer, &packet_size, &receive_info))) {
@@ -2575,9 +2580,9 @@ static sai_status_t mlnx_send_hostif_packet(_In_ sai_object_id_t  hif_id,
     }
 
     if (SAI_NULL_OBJECT_ID == hif_id) {
-        cl_plock_acquire(&g_sai_db_ptr->p_lock);
+        sai_db_read_lock();
         memcpy(&fd, &g_sai_db_ptr->callback_channel.channel.fd, sizeof(fd));
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
     } else {
         mlnx_object_id_t mlnx_hif = {0};
 
@@ -2591,9 +2596,9 @@ static sai_status_t mlnx_send_hostif_packet(_In_ sai_object_id_t  hif_id,
             return SAI_STATUS_INVALID_PARAMETER;
         }
 
-        cl_plock_acquire(&g_sai_db_ptr->p_lock);
+        sai_db_read_lock();
         memcpy(&fd, &g_sai_db_ptr->fd_db[mlnx_hif.id.u32], sizeof(fd));
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
     }
 
     /* TODO : fill correct cos prio */
@@ -2803,9 +2808,9 @@ sai_status_t mlnx_create_hostif_table_entry(_Out_ sai_object_id_t      *hif_tabl
             SX_LOG_ERR("Can't set non FD host interface type %u\n", mlnx_fd.field.sub_type);
             return SAI_STATUS_INVALID_ATTR_VALUE_0 + fd_index;
         }
-        cl_plock_acquire(&g_sai_db_ptr->p_lock);
+        sai_db_read_lock();
         fd_val = g_sai_db_ptr->fd_db[mlnx_fd.id.u32];
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
     } else {
         if (SAI_STATUS_ITEM_NOT_FOUND !=
             (status =
@@ -129,7 +129,7 @@ sai_status_t sai_api_query(_In_ sai_api_t sai_api_id, _Out_ void** api_method_ta
         return SAI_STATUS_SUCCESS;
 
     case SAI_API_ROUTER_INTERFACE:
-        *(const sai_router_interface_api_t**)api_method_table = &mlnx_router_interface_api;
+        *(const sai_router_interface_api_t**)api_method_table = &mlnx_router_interface_api.api;
         return SAI_STATUS_SUCCESS;
 
     case SAI_API_NEIGHBOR:
@@ -280,6 +280,7 @@ sai_status_t sai_log_set(_In_ sai_api_t sai_api_id, _In_ sai_log_level_t log_lev
     switch (sai_api_id) {
     case SAI_API_SWITCH:
         mlnx_switch_log_set(severity);
+        mlnx_counter_log_set(severity);
         return mlnx_utils_log_set(severity);
 
     case SAI_API_BRIDGE:
@@ -473,6 +474,8 @@ sai_status_t sai_dbg_generate_dump(_In_ const char *dump_file_name)
 
     SAI_dump_udf(file);
 
+    SAI_dump_perf(file);
+
     fclose(file);
 
     return SAI_STATUS_SUCCESS;
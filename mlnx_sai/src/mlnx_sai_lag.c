@@ -28,7 +28,6 @@ typedef enum port_params_ {
         PORT_PARAMS_WRED    = 1 << 1,
         PORT_PARAMS_MIRROR  = 1 << 2,
         PORT_PARAMS_FOR_LAG = PORT_PARAMS_QOS | PORT_PARAMS_WRED | PORT_PARAMS_MIRROR,
-        PORT_PARAMS_FLOOD   = 1 << 3,
         PORT_PARAMS_VLAN    = 1 << 4,
         PORT_PARAMS_PVID    = 1 << 5,
         PORT_PARAMS_SFLOW   = 1 << 6,
@@ -37,6 +36,22 @@ typedef enum port_params_ {
         PORT_PARAMS_EGRESS_BLOCK = 1 << 9,
 } port_params_t;
 
+/* LAG params which are aligned on every port that is added to the LAG */
+typedef struct _mlnx_lag_member_params_t {
+    sx_vlan_frame_types_t frame_types;
+    sx_ingr_filter_mode_t ingr_filter;
+    sx_fdb_learn_mode_t   learn_mode;
+} mlnx_lag_member_params_t;
+
+typedef struct _mlnx_lag_member_bulk_entry_t {
+    mlnx_port_config_t   *lag;
+    mlnx_port_config_t   *port;
+    sai_object_id_t       wred_oid;
+    sx_collector_mode_t   collect_mode;
+    sx_distributor_mode_t dist_mode;
+    bool                  is_prepared;
+} mlnx_lag_member_bulk_entry_t;
+
 static sx_verbosity_level_t LOG_VAR_NAME(__MODULE__) = SX_VERBOSITY_LEVEL_WARNING;
 static sai_status_t mlnx_lag_port_list_get(_In_ const sai_object_key_t   *key,
                                            _Inout_ sai_attribute_value_t *value,
@@ -155,9 +170,6 @@ static sai_status_t mlnx_port_params_clone(mlnx_port_config_t *to, mlnx_port_con
     sai_status_t                 status = SAI_STATUS_SUCCESS;
     uint8_t                      prio;
     uint32_t                     ii;
-    bool                         is_flood_disabled = false;
-
-    is_flood_disabled = mlnx_fdb_is_flood_disabled();
 
     /* QoS */
     if (clone & PORT_PARAMS_QOS) {
@@ -251,6 +263,10 @@ static sai_status_t mlnx_port_params_clone(mlnx_port_config_t *to, mlnx_port_con
         /* Copy for the LAG actually, it needs when one of the profiles (Scheduler, QoS) will be changed
          * so the LAG will be updated with new changes */
         memcpy(&to->sched_hierarchy, &from->sched_hierarchy, sizeof(to->sched_hierarchy));
+        mlnx_sched_hierarchy_child_index_update(to);
+        for (ii = 0; ii < MLNX_QOS_MAP_TYPES_MAX; ii++) {
+            mlnx_qos_map_port_ref_update(to->qos_maps[ii], from->qos_maps[ii], to);
+        }
         memcpy(to->qos_maps, from->qos_maps, sizeof(to->qos_maps));
         from->scheduler_id = to->scheduler_id;
     }
@@ -264,6 +280,7 @@ static sai_status_t mlnx_port_params_clone(mlnx_port_config_t *to, mlnx_port_con
                 goto out;
             }
             to_queue->wred_id = queue_cfg->wred_id;
+            mlnx_wred_port_ref_add(queue_cfg->wred_id, to);
 
             if (ii >= RM_API_COS_TRAFFIC_CLASS_NUM) {
                 continue;
@@ -285,6 +302,7 @@ static sai_status_t mlnx_port_params_clone(mlnx_port_config_t *to, mlnx_port_con
             }
         }
         to->wred_id = from->wred_id;
+        mlnx_wred_port_ref_add(from->wred_id, to);
     }
     /* Mirroring */
     if (clone & PORT_PARAMS_MIRROR) {
@@ -293,44 +311,6 @@ static sai_status_t mlnx_port_params_clone(mlnx_port_config_t *to, mlnx_port_con
             goto out;
         }
     }
-    if ((clone & PORT_PARAMS_FLOOD) && is_flood_disabled && mlnx_port_is_in_bridge(from)) {
-        mlnx_bridge_port_t *bridge_port;
-        uint16_t            fid;
-
-        status = mlnx_bridge_port_by_log(from->logical, &bridge_port);
-        if (SAI_ERR(status)) {
-            SX_LOG_ERR("Failed to lookup bridge port by log port id %x\n", from->logical);
-            goto out;
-        }
-
-        mlnx_vlan_id_foreach(fid) {
-            if (mlnx_vlan_port_is_set(fid, bridge_port)) {
-                sx_status_t sx_status;
-
-                if (g_sai_db_ptr->flood_action_uc == SAI_PACKET_ACTION_DROP) {
-                    sx_status = sx_api_fdb_flood_control_set(gh_sdk, SX_ACCESS_CMD_ADD_PORTS,
-                                                             DEFAULT_ETH_SWID, fid, SX_FLOOD_CONTROL_TYPE_UNICAST_E,
-                                                             1, &to->logical);
-
-                    status = sdk_to_sai(sx_status);
-                }
-                if (SAI_ERR(status)) {
-                    goto out;
-                }
-
-                if (g_sai_db_ptr->flood_action_bc == SAI_PACKET_ACTION_DROP) {
-                    sx_status = sx_api_fdb_flood_control_set(gh_sdk, SX_ACCESS_CMD_ADD_PORTS,
-                                                             DEFAULT_ETH_SWID, fid, SX_FLOOD_CONTROL_TYPE_BROADCAST_E,
-                                                             1, &to->logical);
-
-                    status = sdk_to_sai(sx_status);
-                }
-                if (SAI_ERR(status)) {
-                    goto out;
-                }
-            }
-        }
-    }
     if (clone & PORT_PARAMS_VLAN) {
         sx_vlan_frame_types_t frame_types;
         sx_ingr_filter_mode_t mode;
@@ -496,13 +476,9 @@ static sai_status_t port_reset_vlan_params_from_port(mlnx_port_config_t *port, m
             return SAI_STATUS_NO_MEMORY;
         }
 
-        mlnx_vlan_id_foreach(vid) {
+        mlnx_bridge_port_vlans_foreach(lag_bport, vid) {
             mlnx_bridge_port_t port_bport = { .logical = port->logical };
 
-            if (!mlnx_vlan_port_is_set(vid, lag_bport)) {
-                continue;
-            }
-
             mlnx_fdb_port_event_handle(&port_bport, vid, SAI_PORT_EVENT_DELETE);
 
             vlan_list[ii++].vid = vid;
@@ -522,30 +498,12 @@ static sai_status_t port_reset_vlan_params_from_port(mlnx_port_config_t *port, m
     return sdk_to_sai(sx_status);
 }
 
-static sai_status_t remove_port_from_lag(sx_port_log_id_t lag_id, sx_port_log_id_t port_id)
+/* Restores the port params after the port is removed from the LAG group */
+static sai_status_t mlnx_lag_member_port_restore(mlnx_port_config_t *port, mlnx_port_config_t *lag)
 {
-    sx_status_t         sx_status;
-    sai_status_t        status;
-    mlnx_port_config_t *port;
-    mlnx_port_config_t *lag;
-
-    status = mlnx_port_by_log_id(port_id, &port);
-    if (SAI_ERR(status)) {
-        return status;
-    }
-    status = mlnx_port_by_log_id(lag_id, &lag);
-    if (SAI_ERR(status)) {
-        return status;
-    }
+    sx_status_t  sx_status;
+    sai_status_t status;
 
-    sx_status = sx_api_lag_port_group_set(gh_sdk, SX_ACCESS_CMD_DELETE, DEFAULT_ETH_SWID,
-                                          &lag_id, &port_id, 1);
-    if (SX_ERR(sx_status)) {
-        SX_LOG_ERR("Failed remove port log id %x from LAG log id %x - %s\n", port_id, lag_id,
-                   SX_STATUS_MSG(sx_status));
-        status = sdk_to_sai(sx_status);
-        return status;
-    }
     port->lag_id = 0;
 
     status = port_reset_vlan_params_from_port(port, lag);
@@ -553,12 +511,12 @@ static sai_status_t remove_port_from_lag(sx_port_log_id_t lag_id, sx_port_log_id
         return status;
     }
 
-    sx_status = mlnx_hash_ecmp_cfg_apply_on_port(port_id);
+    sx_status = mlnx_hash_ecmp_cfg_apply_on_port(port->logical);
     if (SX_ERR(sx_status)) {
         return sdk_to_sai(sx_status);
     }
 
-    sx_status = sx_api_fdb_port_learn_mode_set(gh_sdk, port_id, SX_FDB_LEARN_MODE_AUTO_LEARN);
+    sx_status = sx_api_fdb_port_learn_mode_set(gh_sdk, port->logical, SX_FDB_LEARN_MODE_AUTO_LEARN);
     if (SX_ERR(sx_status)) {
         SX_LOG_ERR("Failed to set port learning mode - %s\n", SX_STATUS_MSG(sx_status));
         return sdk_to_sai(sx_status);
@@ -574,6 +532,34 @@ static sai_status_t remove_port_from_lag(sx_port_log_id_t lag_id, sx_port_log_id
     return SAI_STATUS_SUCCESS;
 }
 
+static sai_status_t remove_port_from_lag(sx_port_log_id_t lag_id, sx_port_log_id_t port_id)
+{
+    sx_status_t         sx_status;
+    sai_status_t        status;
+    mlnx_port_config_t *port;
+    mlnx_port_config_t *lag;
+
+    status = mlnx_port_by_log_id(port_id, &port);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+    status = mlnx_port_by_log_id(lag_id, &lag);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    sx_status = sx_api_lag_port_group_set(gh_sdk, SX_ACCESS_CMD_DELETE, DEFAULT_ETH_SWID,
+                                          &lag_id, &port_id, 1);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Failed remove port log id %x from LAG log id %x - %s\n", port_id, lag_id,
+                   SX_STATUS_MSG(sx_status));
+        status = sdk_to_sai(sx_status);
+        return status;
+    }
+
+    return mlnx_lag_member_port_restore(port, lag);
+}
+
 static sai_status_t mlnx_lag_remove_all_ports(sai_object_id_t lag_oid)
 {
     sai_status_t      status;
@@ -741,150 +727,519 @@ static sai_status_t validate_port(mlnx_port_config_t *lag, mlnx_port_config_t *p
     return SAI_STATUS_SUCCESS;
 }
 
-static sai_status_t mlnx_lag_port_list_get(_In_ const sai_object_key_t   *key,
-                                           _Inout_ sai_attribute_value_t *value,
-                                           _In_ uint32_t                  attr_index,
-                                           _Inout_ vendor_cache_t        *cache,
-                                           void                          *arg)
+/* Restores the WRED profiles of the port and its queues which were reset before adding the port to the LAG */
+static sai_status_t mlnx_lag_member_wred_restore(mlnx_port_config_t *port, sai_object_id_t wred_oid)
 {
-    sai_status_t      status;
-    sai_object_id_t   lag_id = key->key.object_id;
-    sx_port_log_id_t  lag_log_port_id;
-    sx_port_log_id_t *log_port_list = NULL;
-    uint32_t          log_port_cnt  = 0;
-    uint32_t          ii;
-    sx_status_t       sx_status;
-
-    SX_LOG_ENTER();
+    mlnx_qos_queue_config_t *queue;
+    sai_object_id_t          queue_id;
+    sai_object_id_t          tmp_oid;
+    sai_status_t             status;
+    uint32_t                 ii;
 
-    if (SAI_STATUS_SUCCESS !=
-        (status = mlnx_object_to_type(lag_id, SAI_OBJECT_TYPE_LAG, &lag_log_port_id, NULL))) {
-        return status;
+    if (wred_oid == SAI_NULL_OBJECT_ID) {
+        return SAI_STATUS_SUCCESS;
     }
 
-    if (SX_STATUS_SUCCESS !=
-        (sx_status = sx_api_lag_port_group_get(gh_sdk, DEFAULT_ETH_SWID,
-                                               lag_log_port_id, NULL, &log_port_cnt))) {
-        return sdk_to_sai(sx_status);
-    }
+    port_queues_foreach(port, queue, ii) {
+        if (ii >= RM_API_COS_TRAFFIC_CLASS_NUM) {
+            continue;
+        }
+        status = mlnx_queue_cfg_lookup(port->logical, ii, &queue);
+        if (SAI_ERR(status)) {
+            return status;
+        }
+        tmp_oid        = queue->wred_id;
+        queue->wred_id = SAI_NULL_OBJECT_ID;
+        status         = mlnx_create_queue_object(port->logical, ii, &queue_id);
+        if (SAI_ERR(status)) {
+            return status;
+        }
 
-    if (value->objlist.count < log_port_cnt) {
-        if (0 == value->objlist.count) {
-            status = MLNX_SAI_STATUS_BUFFER_OVERFLOW_EMPTY_LIST;
-        } else {
-            status = SAI_STATUS_BUFFER_OVERFLOW;
+        status = mlnx_wred_apply(tmp_oid, queue_id);
+        if (SAI_ERR(status)) {
+            return status;
         }
-        SX_LOG((0 == value->objlist.count) ? SX_LOG_NOTICE : SX_LOG_ERROR,
-               "Insufficient list buffer size. Allocated %u needed %u\n",
-               value->objlist.count, log_port_cnt);
-        value->objlist.count = log_port_cnt;
+    }
+
+    port->wred_id = SAI_NULL_OBJECT_ID;
+
+    return mlnx_wred_apply(wred_oid, port->saiport);
+}
+
+/*
+ * Prepares the port to be added to the LAG group. The first member of an empty LAG
+ * is the one the LAG takes its QoS, WRED, mirroring and other params from, the next
+ * members must have the same params.
+ */
+static sai_status_t mlnx_lag_member_port_prepare(mlnx_port_config_t *lag, mlnx_port_config_t *port, bool is_lag_empty)
+{
+    mlnx_qos_queue_config_t *queue;
+    sai_object_id_t          wred_oid = port->wred_id;
+    sai_object_id_t          tmp_oid;
+    sai_object_id_t          queue_id;
+    sai_status_t             status;
+    uint32_t                 ii;
+
+    status = validate_port(lag, port);
+    if (SAI_ERR(status)) {
         return status;
     }
 
-    if (log_port_cnt) {
-        log_port_list = (sx_port_log_id_t*)malloc(sizeof(sx_port_log_id_t) * log_port_cnt);
-        if (NULL == log_port_list) {
-            SX_LOG_ERR("Can't allocate memory\n");
-            return SAI_STATUS_NO_MEMORY;
+    /* Reset WRED from port & queues */
+    port_queues_foreach(port, queue, ii) {
+        if (ii >= RM_API_COS_TRAFFIC_CLASS_NUM) {
+            continue;
         }
 
-        if (SX_STATUS_SUCCESS !=
-            (sx_status = sx_api_lag_port_group_get(gh_sdk, DEFAULT_ETH_SWID,
-                                                   lag_log_port_id, log_port_list, &log_port_cnt))) {
-            free(log_port_list);
-            return sdk_to_sai(sx_status);
+        status = mlnx_queue_cfg_lookup(port->logical, ii, &queue);
+        if (SAI_ERR(status)) {
+            return status;
+        }
+        tmp_oid = queue->wred_id;
+        status  = mlnx_create_queue_object(port->logical, ii, &queue_id);
+        if (SAI_ERR(status)) {
+            return status;
         }
 
-        for (ii = 0; ii < log_port_cnt; ii++) {
-            if (SAI_STATUS_SUCCESS !=
-                (status =
-                     mlnx_create_object(SAI_OBJECT_TYPE_PORT, (uint32_t)log_port_list[ii], NULL,
-                                        &value->objlist.list[ii]))) {
-                free(log_port_list);
-                return status;
-            }
+        status = mlnx_wred_apply(SAI_NULL_OBJECT_ID, queue_id);
+        if (SAI_ERR(status)) {
+            return status;
         }
-        free(log_port_list);
+        queue->wred_id = tmp_oid;
     }
-    value->objlist.count = log_port_cnt;
 
-    SX_LOG_EXIT();
-    return SAI_STATUS_SUCCESS;
-}
+    status = mlnx_wred_apply(SAI_NULL_OBJECT_ID, port->saiport);
+    if (SAI_ERR(status)) {
+        return status;
+    }
 
-static sai_status_t mlnx_lag_member_lag_id_get(_In_ const sai_object_key_t   *key,
-                                               _Inout_ sai_attribute_value_t *value,
-                                               _In_ uint32_t                  attr_index,
-                                               _Inout_ vendor_cache_t        *cache,
-                                               void                          *arg)
-{
-    sai_object_id_t  lag_member_id   = key->key.object_id;
-    mlnx_object_id_t mlnx_lag_member = {0};
-    sx_port_log_id_t lag_log_port_id = 0;
-    sai_status_t     status;
+    /* We need to keep it when port is removing from the LAG, to restore the original WRED profile */
+    port->wred_id = wred_oid;
 
-    status = sai_to_mlnx_object_id(SAI_OBJECT_TYPE_LAG_MEMBER, lag_member_id, &mlnx_lag_member);
+    if (is_lag_empty) {
+        status = mlnx_port_params_clone(lag,
+                                        port,
+                                        PORT_PARAMS_FOR_LAG | PORT_PARAMS_SFLOW | PORT_PARAMS_POLICER |
+                                        PORT_PARAMS_PVID | PORT_PARAMS_EGRESS_BLOCK);
+    } else {
+        status = ports_l1_params_check(lag, port);
+    }
     if (SAI_ERR(status)) {
         return status;
     }
 
-    SX_PORT_TYPE_ID_SET(lag_log_port_id, SX_PORT_TYPE_LAG);
-    SX_PORT_LAG_ID_SET(lag_log_port_id, mlnx_lag_member.ext.lag.lag_id);
-    SX_PORT_SUB_ID_SET(lag_log_port_id, mlnx_lag_member.ext.lag.sub_id);
-
-    status = mlnx_create_object(SAI_OBJECT_TYPE_LAG, lag_log_port_id, NULL, &value->oid);
+    status = mlnx_port_samplepacket_params_clear(port, true);
     if (SAI_ERR(status)) {
         return status;
     }
 
-    return SAI_STATUS_SUCCESS;
-}
+    status = mlnx_port_storm_control_policer_params_clear(port, true);
+    if (SAI_ERR(status)) {
+        return status;
+    }
 
-static sai_status_t mlnx_lag_member_port_id_get(_In_ const sai_object_key_t   *key,
-                                                _Inout_ sai_attribute_value_t *value,
-                                                _In_ uint32_t                  attr_index,
-                                                _Inout_ vendor_cache_t        *cache,
-                                                void                          *arg)
-{
-    sai_status_t     status;
-    sx_port_log_id_t log_port_id;
-    sai_object_id_t  lag_member_id = key->key.object_id;
+    status = mlnx_port_mirror_params_clear(port);
+    if (SAI_ERR(status)) {
+        return status;
+    }
 
-    if (SAI_STATUS_SUCCESS != (status = mlnx_object_to_type(lag_member_id, SAI_OBJECT_TYPE_LAG_MEMBER,
-                                                            &log_port_id, NULL))) {
+    status = mlnx_port_egress_block_clear(port->logical);
+    if (SAI_ERR(status)) {
         return status;
     }
 
-    if (SAI_STATUS_SUCCESS !=
-        (status = mlnx_create_object(SAI_OBJECT_TYPE_PORT, log_port_id, NULL, &value->oid))) {
+    acl_global_lock();
+    status = mlnx_acl_port_lag_event_handle(port, ACL_EVENT_TYPE_LAG_MEMBER_ADD);
+    acl_global_unlock();
+    if (SAI_ERR(status)) {
+        SX_LOG_NTC("Failed to remove Lag member port[%x] from ACLs\n", lag->logical);
         return status;
     }
 
     return SAI_STATUS_SUCCESS;
 }
 
-static sai_status_t mlnx_lag_member_egress_disable_get(_In_ const sai_object_key_t   *key,
-                                                       _Inout_ sai_attribute_value_t *value,
-                                                       _In_ uint32_t                  attr_index,
-                                                       _Inout_ vendor_cache_t        *cache,
-                                                       void                          *arg)
+static sai_status_t mlnx_lag_member_params_get(mlnx_port_config_t *lag, mlnx_lag_member_params_t *params)
 {
-    sai_status_t          status;
-    sx_status_t           sx_status;
-    sx_port_log_id_t      lag_log_port_id = 0;
-    sai_object_id_t       lag_member_id   = key->key.object_id;
-    sx_distributor_mode_t distributor_mode;
-    mlnx_object_id_t      mlnx_lag_member = {0};
+    sx_status_t sx_status;
 
-    status = sai_to_mlnx_object_id(SAI_OBJECT_TYPE_LAG_MEMBER, lag_member_id, &mlnx_lag_member);
-    if (SAI_ERR(status)) {
-        return status;
+    sx_status = sx_api_vlan_port_accptd_frm_types_get(gh_sdk, lag->logical, &params->frame_types);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Failed to get port accepted frame types for LAG %x - %s.\n",
+                   lag->logical, SX_STATUS_MSG(sx_status));
+        return sdk_to_sai(sx_status);
     }
 
-    SX_PORT_TYPE_ID_SET(lag_log_port_id, SX_PORT_TYPE_LAG);
-    SX_PORT_LAG_ID_SET(lag_log_port_id, mlnx_lag_member.ext.lag.lag_id);
-    SX_PORT_SUB_ID_SET(lag_log_port_id, mlnx_lag_member.ext.lag.sub_id);
-
+    sx_status = sx_api_vlan_port_ingr_filter_get(gh_sdk, lag->logical, &params->ingr_filter);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Port ingress filter get for LAG %x failed - %s\n", lag->logical, SX_STATUS_MSG(sx_status));
+        return sdk_to_sai(sx_status);
+    }
+
+    sx_status = sx_api_fdb_port_learn_mode_get(gh_sdk, lag->logical, &params->learn_mode);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Failed to get LAG [%x] learning mode - %s.\n", lag->logical, SX_STATUS_MSG(sx_status));
+        return sdk_to_sai(sx_status);
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static sai_status_t mlnx_lag_member_params_apply(mlnx_port_config_t *port, const mlnx_lag_member_params_t *params)
+{
+    sx_vlan_frame_types_t frame_types = params->frame_types;
+    sx_status_t           sx_status;
+
+    sx_status = sx_api_vlan_port_accptd_frm_types_set(gh_sdk, port->logical, &frame_types);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Failed to set port accepted frame types for port oid %" PRIx64 " - %s.\n",
+                   port->saiport, SX_STATUS_MSG(sx_status));
+        return sdk_to_sai(sx_status);
+    }
+
+    sx_status = sx_api_vlan_port_ingr_filter_set(gh_sdk, port->logical, params->ingr_filter);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Port ingress filter set for port oid %" PRIx64 " failed - %s\n",
+                   port->saiport, SX_STATUS_MSG(sx_status));
+        return sdk_to_sai(sx_status);
+    }
+
+    sx_status = sx_api_fdb_port_learn_mode_set(gh_sdk, port->logical, params->learn_mode);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Failed to set port [%x] learning mode %s - %s.\n", port->logical,
+                   SX_LEARN_MODE_MSG(params->learn_mode), SX_STATUS_MSG(sx_status));
+        return sdk_to_sai(sx_status);
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/*
+ * Aligns the ports with the LAG and adds them to the LAG group. The LAG params are read once
+ * and the flood control lists and the LAG group are updated once for all the ports.
+ */
+static sai_status_t mlnx_lag_members_add(mlnx_port_config_t  *lag,
+                                         mlnx_port_config_t **ports,
+                                         sx_port_log_id_t    *log_ports,
+                                         uint32_t             ports_count)
+{
+    mlnx_lag_member_params_t params;
+    mlnx_bridge_port_t      *bridge_port;
+    sx_status_t              sx_status;
+    sai_status_t             status;
+    uint32_t                 ii;
+    uint16_t                 fid;
+
+    status = mlnx_lag_member_params_get(lag, &params);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    for (ii = 0; ii < ports_count; ii++) {
+        status = mlnx_lag_member_params_apply(ports[ii], &params);
+        if (SAI_ERR(status)) {
+            return status;
+        }
+    }
+
+    if (mlnx_fdb_is_flood_disabled() && mlnx_port_is_in_bridge(lag)) {
+        status = mlnx_bridge_port_by_log(lag->logical, &bridge_port);
+        if (SAI_ERR(status)) {
+            SX_LOG_ERR("Failed to lookup bridge port by log port id %x\n", lag->logical);
+            return status;
+        }
+
+        mlnx_bridge_port_vlans_foreach(bridge_port, fid) {
+            status = mlnx_fdb_flood_control_set(fid, log_ports, ports_count, true);
+            if (SAI_ERR(status)) {
+                return status;
+            }
+        }
+    }
+
+    sx_status = sx_api_lag_port_group_set(gh_sdk, SX_ACCESS_CMD_ADD, DEFAULT_ETH_SWID,
+                                          &lag->logical, log_ports, ports_count);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Failed to add %u ports to LAG %x - %s.\n", ports_count, lag->logical, SX_STATUS_MSG(sx_status));
+        return sdk_to_sai(sx_status);
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static sai_status_t mlnx_lag_member_enable(mlnx_port_config_t   *lag,
+                                           mlnx_port_config_t   *port,
+                                           sx_collector_mode_t   collect_mode,
+                                           sx_distributor_mode_t dist_mode,
+                                           sai_object_id_t      *lag_member_id)
+{
+    mlnx_object_id_t mlnx_lag_member = {0};
+    sx_status_t      sx_status, delete_status;
+    sai_status_t     status;
+    char             key_str[MAX_KEY_STR_LEN];
+
+    sx_status = sx_api_lag_port_collector_set(gh_sdk, lag->logical, port->logical, collect_mode);
+    if (!SX_ERR(sx_status)) {
+        sx_status = sx_api_lag_port_distributor_set(gh_sdk, lag->logical, port->logical, dist_mode);
+    }
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Failed to set collector/distributor mode of port %x in LAG %x - %s\n", port->logical,
+                   lag->logical, SX_STATUS_MSG(sx_status));
+
+        /* Take the port out of the LAG group so the caller can restore it */
+        delete_status = sx_api_lag_port_group_set(gh_sdk, SX_ACCESS_CMD_DELETE, DEFAULT_ETH_SWID,
+                                                  &lag->logical, &port->logical, 1);
+        if (SX_ERR(delete_status)) {
+            SX_LOG_ERR("Failed to remove port %x from LAG %x - %s\n", port->logical, lag->logical,
+                       SX_STATUS_MSG(delete_status));
+        }
+        return sdk_to_sai(sx_status);
+    }
+
+    port->lag_id = lag->logical;
+
+    /* create lag member id */
+    mlnx_lag_member.id.log_port_id = port->logical;
+    mlnx_lag_member.ext.lag.lag_id = SX_PORT_LAG_ID_GET(lag->logical);
+    mlnx_lag_member.ext.lag.sub_id = SX_PORT_SUB_ID_GET(lag->logical);
+
+    status = mlnx_object_id_to_sai(SAI_OBJECT_TYPE_LAG_MEMBER, &mlnx_lag_member, lag_member_id);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    lag_member_key_to_str(*lag_member_id, key_str);
+    SX_LOG_NTC("Created LAG member %s\n", key_str);
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/*
+ * When removing the last member from the LAG, we no longer need to keep on the LAG the settings
+ * that were cloned to it from the first port, and any additional settings. Instead we need to
+ * clear these settings, so it will be possible to add any new member to this LAG.
+ */
+static sai_status_t mlnx_lag_params_clear(mlnx_port_config_t *lag_config)
+{
+    sai_object_id_t          queue_id;
+    mlnx_qos_queue_config_t *queue;
+    sai_status_t             status;
+    uint32_t                 ii;
+
+    status = mlnx_wred_apply(SAI_NULL_OBJECT_ID, lag_config->saiport);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+    port_queues_foreach(lag_config, queue, ii) {
+        if (ii >= RM_API_COS_TRAFFIC_CLASS_NUM) {
+            continue;
+        }
+
+        status = mlnx_queue_cfg_lookup(lag_config->logical, ii, &queue);
+        if (SAI_ERR(status)) {
+            return status;
+        }
+        status = mlnx_create_queue_object(lag_config->logical, ii, &queue_id);
+        if (SAI_ERR(status)) {
+            return status;
+        }
+
+        status = mlnx_wred_apply(SAI_NULL_OBJECT_ID, queue_id);
+        if (SAI_ERR(status)) {
+            return status;
+        }
+    }
+
+    status = mlnx_port_samplepacket_params_clear(lag_config, false);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    status = mlnx_port_storm_control_policer_params_clear(lag_config, false);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    status = mlnx_port_mirror_params_clear(lag_config);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    return mlnx_port_egress_block_clear(lag_config->logical);
+}
+
+/*
+ * Undoes mlnx_lag_member_port_prepare() for a port that is not in the LAG group,
+ * the LAG params cloned from the port are cleared when the LAG was empty.
+ */
+static void mlnx_lag_member_port_rollback(mlnx_port_config_t *lag, mlnx_port_config_t *port, bool is_lag_empty)
+{
+    sai_status_t status;
+
+    acl_global_lock();
+    status = mlnx_acl_port_lag_event_handle(port, ACL_EVENT_TYPE_LAG_MEMBER_DEL);
+    acl_global_unlock();
+    if (SAI_ERR(status)) {
+        SX_LOG_ERR("Failed to restore ACLs of port %x\n", port->logical);
+    }
+
+    status = mlnx_lag_member_port_restore(port, lag);
+    if (SAI_ERR(status)) {
+        SX_LOG_ERR("Failed to restore params of port %x\n", port->logical);
+    }
+
+    if (is_lag_empty) {
+        status = mlnx_lag_params_clear(lag);
+        if (SAI_ERR(status)) {
+            SX_LOG_ERR("Failed to clear params of LAG %x\n", lag->logical);
+        }
+    }
+}
+
+static sai_status_t mlnx_lag_port_list_get(_In_ const sai_object_key_t   *key,
+                                           _Inout_ sai_attribute_value_t *value,
+                                           _In_ uint32_t                  attr_index,
+                                           _Inout_ vendor_cache_t        *cache,
+                                           void                          *arg)
+{
+    sai_status_t      status;
+    sai_object_id_t   lag_id = key->key.object_id;
+    sx_port_log_id_t  lag_log_port_id;
+    sx_port_log_id_t *log_port_list = NULL;
+    uint32_t          log_port_cnt  = 0;
+    uint32_t          ii;
+    sx_status_t       sx_status;
+
+    SX_LOG_ENTER();
+
+    if (SAI_STATUS_SUCCESS !=
+        (status = mlnx_object_to_type(lag_id, SAI_OBJECT_TYPE_LAG, &lag_log_port_id, NULL))) {
+        return status;
+    }
+
+    if (SX_STATUS_SUCCESS !=
+        (sx_status = sx_api_lag_port_group_get(gh_sdk, DEFAULT_ETH_SWID,
+                                               lag_log_port_id, NULL, &log_port_cnt))) {
+        return sdk_to_sai(sx_status);
+    }
+
+    if (value->objlist.count < log_port_cnt) {
+        if (0 == value->objlist.count) {
+            status = MLNX_SAI_STATUS_BUFFER_OVERFLOW_EMPTY_LIST;
+        } else {
+            status = SAI_STATUS_BUFFER_OVERFLOW;
+        }
+        SX_LOG((0 == value->objlist.count) ? SX_LOG_NOTICE : SX_LOG_ERROR,
+               "Insufficient list buffer size. Allocated %u needed %u\n",
+               value->objlist.count, log_port_cnt);
+        value->objlist.count = log_port_cnt;
+        return status;
+    }
+
+    if (log_port_cnt) {
+        log_port_list = (sx_port_log_id_t*)malloc(sizeof(sx_port_log_id_t) * log_port_cnt);
+        if (NULL == log_port_list) {
+            SX_LOG_ERR("Can't allocate memory\n");
+            return SAI_STATUS_NO_MEMORY;
+        }
+
+        if (SX_STATUS_SUCCESS !=
+            (sx_status = sx_api_lag_port_group_get(gh_sdk, DEFAULT_ETH_SWID,
+                                                   lag_log_port_id, log_port_list, &log_port_cnt))) {
+            free(log_port_list);
+            return sdk_to_sai(sx_status);
+        }
+
+        for (ii = 0; ii < log_port_cnt; ii++) {
+            if (SAI_STATUS_SUCCESS !=
+                (status =
+                     mlnx_create_object(SAI_OBJECT_TYPE_PORT, (uint32_t)log_port_list[ii], NULL,
+                                        &value->objlist.list[ii]))) {
+                free(log_port_list);
+                return status;
+            }
+        }
+        free(log_port_list);
+    }
+    value->objlist.count = log_port_cnt;
+
+    SX_LOG_EXIT();
+    return SAI_STATUS_SUCCESS;
+}
+
+static sai_status_t mlnx_lag_member_lag_id_get(_In_ const sai_object_key_t   *key,
+                                               _Inout_ sai_attribute_value_t *value,
+                                               _In_ uint32_t                  attr_index,
+                                               _Inout_ vendor_cache_t        *cache,
+                                               void                          *arg)
+{
+    sai_object_id_t  lag_member_id   = key->key.object_id;
+    mlnx_object_id_t mlnx_lag_member = {0};
+    sx_port_log_id_t lag_log_port_id = 0;
+    sai_status_t     status;
+
+    status = sai_to_mlnx_object_id(SAI_OBJECT_TYPE_LAG_MEMBER, lag_member_id, &mlnx_lag_member);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    SX_PORT_TYPE_ID_SET(lag_log_port_id, SX_PORT_TYPE_LAG);
+    SX_PORT_LAG_ID_SET(lag_log_port_id, mlnx_lag_member.ext.lag.lag_id);
+    SX_PORT_SUB_ID_SET(lag_log_port_id, mlnx_lag_member.ext.lag.sub_id);
+
+    status = mlnx_create_object(SAI_OBJECT_TYPE_LAG, lag_log_port_id, NULL, &value->oid);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static sai_status_t mlnx_lag_member_port_id_get(_In_ const sai_object_key_t   *key,
+                                                _Inout_ sai_attribute_value_t *value,
+                                                _In_ uint32_t                  attr_index,
+                                                _Inout_ vendor_cache_t        *cache,
+                                                void                          *arg)
+{
+    sai_status_t     status;
+    sx_port_log_id_t log_port_id;
+    sai_object_id_t  lag_member_id = key->key.object_id;
+
+    if (SAI_STATUS_SUCCESS != (status = mlnx_object_to_type(lag_member_id, SAI_OBJECT_TYPE_LAG_MEMBER,
+                                                            &log_port_id, NULL))) {
+        return status;
+    }
+
+    if (SAI_STATUS_SUCCESS !=
+        (status = mlnx_create_object(SAI_OBJECT_TYPE_PORT, log_port_id, NULL, &value->oid))) {
+        return status;
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static sai_status_t mlnx_lag_member_egress_disable_get(_In_ const sai_object_key_t   *key,
+                                                       _Inout_ sai_attribute_value_t *value,
+                                                       _In_ uint32_t                  attr_index,
+                                                       _Inout_ vendor_cache_t        *cache,
+                                                       void                          *arg)
+{
+    sai_status_t          status;
+    sx_status_t           sx_status;
+    sx_port_log_id_t      lag_log_port_id = 0;
+    sai_object_id_t       lag_member_id   = key->key.object_id;
+    sx_distributor_mode_t distributor_mode;
+    mlnx_object_id_t      mlnx_lag_member = {0};
+
+    status = sai_to_mlnx_object_id(SAI_OBJECT_TYPE_LAG_MEMBER, lag_member_id, &mlnx_lag_member);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    SX_PORT_TYPE_ID_SET(lag_log_port_id, SX_PORT_TYPE_LAG);
+    SX_PORT_LAG_ID_SET(lag_log_port_id, mlnx_lag_member.ext.lag.lag_id);
+    SX_PORT_SUB_ID_SET(lag_log_port_id, mlnx_lag_member.ext.lag.sub_id);
+
     if (SX_STATUS_SUCCESS !=
         (sx_status =
              sx_api_lag_port_distributor_get(gh_sdk, lag_log_port_id, mlnx_lag_member.id.log_port_id,
@@ -1206,38 +1561,17 @@ static sai_status_t mlnx_get_lag_attribute(_In_ sai_object_id_t     lag_id,
     return sai_get_attributes(&key, key_str, SAI_OBJECT_TYPE_LAG, lag_vendor_attribs, attr_count, attr_list);
 }
 
-static sai_status_t mlnx_create_lag_member(_Out_ sai_object_id_t     * lag_member_id,
-                                           _In_ sai_object_id_t        switch_id,
-                                           _In_ uint32_t               attr_count,
-                                           _In_ const sai_attribute_t *attr_list)
+static sai_status_t mlnx_lag_member_attrs_parse(_In_ uint32_t                 attr_count,
+                                               _In_ const sai_attribute_t   *attr_list,
+                                               _Out_ sx_port_log_id_t       *lag_id,
+                                               _Out_ sx_port_log_id_t       *port_id,
+                                               _Out_ sx_collector_mode_t    *collect_mode,
+                                               _Out_ sx_distributor_mode_t  *dist_mode)
 {
     sai_status_t                 status;
-    sx_status_t                  sx_status;
     const sai_attribute_value_t *attr_lag_id, *attr_port_id, *attr_egress_disable, *attr_ingress_disable;
-    sai_object_id_t              lag_oid, port_oid;
     uint32_t                     index;
     char                         list_str[MAX_LIST_VALUE_STR_LEN];
-    char                         key_str[MAX_KEY_STR_LEN];
-    sx_port_log_id_t             lag_id;
-    sx_port_log_id_t             port_id;
-    uint32_t                     port_cnt        = 0;
-    mlnx_port_config_t          *port            = NULL;
-    mlnx_port_config_t          *lag             = NULL;
-    sx_collector_mode_t          collect_mode    = COLLECTOR_ENABLE;
-    sx_distributor_mode_t        dist_mode       = DISTRIBUTOR_ENABLE;
-    mlnx_object_id_t             mlnx_lag_member = {0};
-    sai_object_id_t              wred_oid        = SAI_NULL_OBJECT_ID;
-    sai_object_id_t              tmp_oid;
-    sai_object_id_t              queue_id;
-    mlnx_qos_queue_config_t     *queue;
-    uint32_t                     ii;
-
-    SX_LOG_ENTER();
-
-    if (NULL == lag_member_id) {
-        SX_LOG_ERR("NULL lag member id param\n");
-        return SAI_STATUS_INVALID_PARAMETER;
-    }
 
     status = check_attribs_metadata(attr_count, attr_list, SAI_OBJECT_TYPE_LAG_MEMBER, lag_member_vendor_attribs,
                                     SAI_COMMON_API_CREATE);
@@ -1259,192 +1593,91 @@ static sai_status_t mlnx_create_lag_member(_Out_ sai_object_id_t     * lag_membe
     }
 
     /* get egress mode */
-    status = find_attrib_in_list(attr_count, attr_list, SAI_LAG_MEMBER_ATTR_EGRESS_DISABLE,
-                                 &attr_egress_disable, &index);
+    *dist_mode = DISTRIBUTOR_ENABLE;
+    status     = find_attrib_in_list(attr_count, attr_list, SAI_LAG_MEMBER_ATTR_EGRESS_DISABLE,
+                                     &attr_egress_disable, &index);
     if (!SAI_ERR(status)) {
-        dist_mode = attr_egress_disable->booldata ? DISTRIBUTOR_DISABLE : DISTRIBUTOR_ENABLE;
+        *dist_mode = attr_egress_disable->booldata ? DISTRIBUTOR_DISABLE : DISTRIBUTOR_ENABLE;
     }
 
     /* get ingress mode */
-    status = find_attrib_in_list(attr_count, attr_list, SAI_LAG_MEMBER_ATTR_INGRESS_DISABLE,
-                                 &attr_ingress_disable, &index);
+    *collect_mode = COLLECTOR_ENABLE;
+    status        = find_attrib_in_list(attr_count, attr_list, SAI_LAG_MEMBER_ATTR_INGRESS_DISABLE,
+                                        &attr_ingress_disable, &index);
     if (!SAI_ERR(status)) {
-        collect_mode = attr_ingress_disable->booldata ? COLLECTOR_DISABLE : COLLECTOR_ENABLE;
+        *collect_mode = attr_ingress_disable->booldata ? COLLECTOR_DISABLE : COLLECTOR_ENABLE;
     }
 
-    lag_oid  = attr_lag_id->oid;
-    port_oid = attr_port_id->oid;
-
-    status = mlnx_object_to_type(lag_oid, SAI_OBJECT_TYPE_LAG, &lag_id, NULL);
+    status = mlnx_object_to_type(attr_lag_id->oid, SAI_OBJECT_TYPE_LAG, lag_id, NULL);
     if (SAI_ERR(status)) {
         return status;
     }
-    status = mlnx_object_to_type(port_oid, SAI_OBJECT_TYPE_PORT, &port_id, NULL);
-    if (SAI_ERR(status)) {
-        return status;
-    }
-
-    sai_db_write_lock();
-    status = mlnx_port_by_log_id(port_id, &port);
-    if (SAI_ERR(status)) {
-        goto out;
-    }
-    status = mlnx_port_by_log_id(lag_id, &lag);
-    if (SAI_ERR(status)) {
-        goto out;
-    }
 
-    wred_oid = port->wred_id;
-
-    status = validate_port(lag, port);
-    if (SAI_ERR(status)) {
-        goto out;
-    }
-
-    /* Reset WRED from port & queues */
-    port_queues_foreach(port, queue, ii) {
-        if (ii >= RM_API_COS_TRAFFIC_CLASS_NUM) {
-            continue;
-        }
-
-        status = mlnx_queue_cfg_lookup(port->logical, ii, &queue);
-        if (SAI_ERR(status)) {
-            goto out;
-        }
-        tmp_oid = queue->wred_id;
-        status  = mlnx_create_queue_object(port->logical, ii, &queue_id);
-        if (SAI_ERR(status)) {
-        }
-
-        status = mlnx_wred_apply(SAI_NULL_OBJECT_ID, queue_id);
-        if (SAI_ERR(status)) {
-            goto out;
-        }
-        queue->wred_id = tmp_oid;
-    }
-
-    status = mlnx_wred_apply(SAI_NULL_OBJECT_ID, port_oid);
-    if (SAI_ERR(status)) {
-        goto out;
-    }
-
-    /* We need to keep it when port is removing from the LAG, to restore the original WRED profile */
-    port->wred_id = wred_oid;
-
-    sx_status = sx_api_lag_port_group_get(gh_sdk, DEFAULT_ETH_SWID, lag->logical, NULL, &port_cnt);
-    if (SAI_ERR(status = sdk_to_sai(sx_status))) {
-        goto out;
-    }
-
-    if (port_cnt) {
-        status = ports_l1_params_check(lag, port);
-        if (SAI_ERR(status)) {
-            goto out;
-        }
-    } else {
-        status = mlnx_port_params_clone(lag,
-                                        port,
-                                        PORT_PARAMS_FOR_LAG | PORT_PARAMS_SFLOW | PORT_PARAMS_POLICER |
-                                        PORT_PARAMS_PVID | PORT_PARAMS_EGRESS_BLOCK);
-        if (SAI_ERR(status)) {
-            goto out;
-        }
-    }
+    return mlnx_object_to_type(attr_port_id->oid, SAI_OBJECT_TYPE_PORT, port_id, NULL);
+}
 
-    status = mlnx_port_params_clone(port, lag, PORT_PARAMS_FLOOD | PORT_PARAMS_VLAN | PORT_PARAMS_LEARN_MODE);
-    if (SAI_ERR(status)) {
-        goto out;
-    }
+static sai_status_t mlnx_create_lag_member(_Out_ sai_object_id_t     * lag_member_id,
+                                           _In_ sai_object_id_t        switch_id,
+                                           _In_ uint32_t               attr_count,
+                                           _In_ const sai_attribute_t *attr_list)
+{
+    sai_status_t          status;
+    sx_status_t           sx_status;
+    sx_port_log_id_t      lag_id;
+    sx_port_log_id_t      port_id;
+    uint32_t              port_cnt     = 0;
+    mlnx_port_config_t   *port         = NULL;
+    mlnx_port_config_t   *lag          = NULL;
+    sx_collector_mode_t   collect_mode = COLLECTOR_ENABLE;
+    sx_distributor_mode_t dist_mode    = DISTRIBUTOR_ENABLE;
+    sai_object_id_t       wred_oid     = SAI_NULL_OBJECT_ID;
 
-    status = mlnx_port_samplepacket_params_clear(port, true);
-    if (SAI_ERR(status)) {
-        goto out;
-    }
+    SX_LOG_ENTER();
 
-    status = mlnx_port_storm_control_policer_params_clear(port, true);
-    if (SAI_ERR(status)) {
-        goto out;
+    if (NULL == lag_member_id) {
+        SX_LOG_ERR("NULL lag member id param\n");
+        return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    status = mlnx_port_mirror_params_clear(port);
+    status = mlnx_lag_member_attrs_parse(attr_count, attr_list, &lag_id, &port_id, &collect_mode, &dist_mode);
     if (SAI_ERR(status)) {
-        goto out;
+        return status;
     }
 
-    status = mlnx_port_egress_block_clear(port->logical);
+    sai_db_write_lock();
+    status = mlnx_port_by_log_id(port_id, &port);
     if (SAI_ERR(status)) {
         goto out;
     }
-
-    acl_global_lock();
-    status = mlnx_acl_port_lag_event_handle(port, ACL_EVENT_TYPE_LAG_MEMBER_ADD);
-    acl_global_unlock();
+    status = mlnx_port_by_log_id(lag_id, &lag);
     if (SAI_ERR(status)) {
-        SX_LOG_NTC("Failed to remove Lag member port[%x] from ACLs\n", lag->logical);
         goto out;
     }
 
-    sx_status = sx_api_lag_port_group_set(gh_sdk, SX_ACCESS_CMD_ADD, DEFAULT_ETH_SWID,
-                                          &lag->logical, &port->logical, 1);
-    if (SAI_ERR(status = sdk_to_sai(sx_status))) {
-        SX_LOG_ERR("Failed to add lag port %s.\n", SX_STATUS_MSG(sx_status));
-        goto out;
-    }
+    wred_oid = port->wred_id;
 
-    sx_status = sx_api_lag_port_collector_set(gh_sdk, lag->logical, port->logical, collect_mode);
-    if (SAI_ERR(status = sdk_to_sai(sx_status))) {
-        goto out;
-    }
-    sx_status = sx_api_lag_port_distributor_set(gh_sdk, lag->logical, port->logical, dist_mode);
+    sx_status = sx_api_lag_port_group_get(gh_sdk, DEFAULT_ETH_SWID, lag->logical, NULL, &port_cnt);
     if (SAI_ERR(status = sdk_to_sai(sx_status))) {
         goto out;
     }
 
-    port->lag_id = lag->logical;
-
-    /* create lag member id */
-    mlnx_lag_member.id.log_port_id = port_id;
-    mlnx_lag_member.ext.lag.lag_id = SX_PORT_LAG_ID_GET(lag_id);
-    mlnx_lag_member.ext.lag.sub_id = SX_PORT_SUB_ID_GET(lag_id);
-
-    status = mlnx_object_id_to_sai(SAI_OBJECT_TYPE_LAG_MEMBER, &mlnx_lag_member, lag_member_id);
-    if (SAI_ERR(status)) {
-        goto out;
-    }
-
-    lag_member_key_to_str(*lag_member_id, key_str);
-    SX_LOG_NTC("Created LAG member %s\n", key_str);
-
-out:
-    if (SAI_ERR(status) && (wred_oid != SAI_NULL_OBJECT_ID)) {
-        port_queues_foreach(port, queue, ii) {
-            if (ii >= RM_API_COS_TRAFFIC_CLASS_NUM) {
-                continue;
-            }
-            status = mlnx_queue_cfg_lookup(port->logical, ii, &queue);
-            if (SAI_ERR(status)) {
-                goto out;
-            }
-            tmp_oid        = queue->wred_id;
-            queue->wred_id = SAI_NULL_OBJECT_ID;
-            status         = mlnx_create_queue_object(port->logical, ii, &queue_id);
-            if (SAI_ERR(status)) {
-            }
-
-            status = mlnx_wred_apply(tmp_oid, queue_id);
-            if (SAI_ERR(status)) {
-                goto out;
-            }
+    status = mlnx_lag_member_port_prepare(lag, port, 0 == port_cnt);
+    if (SAI_ERR(status)) {
+        if (SAI_ERR(mlnx_lag_member_wred_restore(port, wred_oid))) {
+            SX_LOG_ERR("Failed to restore WRED profiles of port %x\n", port->logical);
         }
+        goto out;
+    }
 
-        port->wred_id = SAI_NULL_OBJECT_ID;
-        status        = mlnx_wred_apply(wred_oid, port_oid);
-        if (SAI_ERR(status)) {
-            sai_db_unlock();
-            return status;
-        }
+    status = mlnx_lag_members_add(lag, &port, &port->logical, 1);
+    if (!SAI_ERR(status)) {
+        status = mlnx_lag_member_enable(lag, port, collect_mode, dist_mode, lag_member_id);
+    }
+    if (SAI_ERR(status)) {
+        mlnx_lag_member_port_rollback(lag, port, 0 == port_cnt);
     }
 
+out:
     sai_db_unlock();
     return status;
 }
@@ -1458,7 +1691,6 @@ static sai_status_t mlnx_remove_lag_member(_In_ sai_object_id_t lag_member_id)
     mlnx_port_config_t *port_config;
     mlnx_port_config_t *lag_config;
     sx_status_t         sx_status;
-    sai_object_id_t     lag_oid;
 
     SX_LOG_NTC("Remove SAI LAG member oid %" PRIx64 "\n", (uint64_t)lag_member_id);
 
@@ -1485,7 +1717,6 @@ static sai_status_t mlnx_remove_lag_member(_In_ sai_object_id_t lag_member_id)
     if (SAI_ERR(status)) {
         goto out;
     }
-    lag_oid = lag_config->saiport;
 
     acl_global_lock();
     status = mlnx_acl_port_lag_event_handle(port_config, ACL_EVENT_TYPE_LAG_MEMBER_DEL);
@@ -1502,53 +1733,8 @@ static sai_status_t mlnx_remove_lag_member(_In_ sai_object_id_t lag_member_id)
         goto out;
     }
 
-    /* When removing the last member from the LAG, we no longer need to keep on the LAG the settings
-     *  that were cloned to it from the first port, and any additional settings. Instead we need to
-     *  clear these settings, so it will be possible to add any new member to this LAG. */
     if (members_count == 0) {
-        sai_object_id_t          queue_id;
-        mlnx_qos_queue_config_t *queue;
-        uint32_t                 ii;
-
-        status = mlnx_wred_apply(SAI_NULL_OBJECT_ID, lag_oid);
-        if (SAI_ERR(status)) {
-            goto out;
-        }
-        port_queues_foreach(lag_config, queue, ii) {
-            if (ii >= RM_API_COS_TRAFFIC_CLASS_NUM) {
-                continue;
-            }
-
-            status = mlnx_queue_cfg_lookup(lag_config->logical, ii, &queue);
-            if (SAI_ERR(status)) {
-                goto out;
-            }
-            status = mlnx_create_queue_object(lag_config->logical, ii, &queue_id);
-            if (SAI_ERR(status)) {
-            }
-
-            status = mlnx_wred_apply(SAI_NULL_OBJECT_ID, queue_id);
-            if (SAI_ERR(status)) {
-                goto out;
-            }
-        }
-
-        status = mlnx_port_samplepacket_params_clear(lag_config, false);
-        if (SAI_ERR(status)) {
-            goto out;
-        }
-
-        status = mlnx_port_storm_control_policer_params_clear(lag_config, false);
-        if (SAI_ERR(status)) {
-            goto out;
-        }
-
-        status = mlnx_port_mirror_params_clear(lag_config);
-        if (SAI_ERR(status)) {
-            goto out;
-        }
-
-        status = mlnx_port_egress_block_clear(lag_config->logical);
+        status = mlnx_lag_params_clear(lag_config);
         if (SAI_ERR(status)) {
             goto out;
         }
@@ -1590,6 +1776,128 @@ static sai_status_t mlnx_get_lag_member_attribute(_In_ sai_object_id_t     lag_m
                               attr_list);
 }
 
+/* DB write lock is needed */
+static sai_status_t mlnx_lag_member_bulk_entry_prepare(_In_ uint32_t                          attr_count,
+                                                       _In_ const sai_attribute_t            *attr_list,
+                                                       _Inout_ mlnx_lag_member_bulk_entry_t *entries,
+                                                       _In_ uint32_t                          index)
+{
+    mlnx_lag_member_bulk_entry_t *entry = &entries[index];
+    sx_port_log_id_t              lag_id, port_id;
+    sx_status_t                   sx_status;
+    sai_status_t                  status;
+    uint32_t                      port_cnt = 0;
+    uint32_t                      ii;
+    bool                          is_lag_empty;
+
+    if (!attr_list) {
+        SX_LOG_ERR("attr_list is NULL\n");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    status = mlnx_lag_member_attrs_parse(attr_count, attr_list, &lag_id, &port_id,
+                                         &entry->collect_mode, &entry->dist_mode);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    status = mlnx_port_by_log_id(port_id, &entry->port);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+    status = mlnx_port_by_log_id(lag_id, &entry->lag);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    /* The LAG is not empty anymore if one of the previous entries is going to be added to it */
+    is_lag_empty = true;
+    for (ii = 0; ii < index; ii++) {
+        if (!entries[ii].is_prepared) {
+            continue;
+        }
+
+        if (entries[ii].port == entry->port) {
+            SX_LOG_ERR("Port %x is already added to a LAG in this bulk\n", entry->port->logical);
+            return SAI_STATUS_INVALID_PARAMETER;
+        }
+
+        if (entries[ii].lag == entry->lag) {
+            is_lag_empty = false;
+        }
+    }
+
+    if (is_lag_empty) {
+        sx_status = sx_api_lag_port_group_get(gh_sdk, DEFAULT_ETH_SWID, entry->lag->logical, NULL, &port_cnt);
+        if (SX_ERR(sx_status)) {
+            return sdk_to_sai(sx_status);
+        }
+        is_lag_empty = (0 == port_cnt);
+    }
+
+    entry->wred_oid = entry->port->wred_id;
+
+    status = mlnx_lag_member_port_prepare(entry->lag, entry->port, is_lag_empty);
+    if (SAI_ERR(status)) {
+        if (SAI_ERR(mlnx_lag_member_wred_restore(entry->port, entry->wred_oid))) {
+            SX_LOG_ERR("Failed to restore WRED profiles of port %x\n", entry->port->logical);
+        }
+        return status;
+    }
+
+    entry->is_prepared = true;
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/* DB read lock is needed */
+static sai_status_t mlnx_lag_member_bulk_entry_lookup(_In_ sai_object_id_t                  lag_member_id,
+                                                      _Inout_ mlnx_lag_member_bulk_entry_t *entries,
+                                                      _In_ uint32_t                         index)
+{
+    mlnx_lag_member_bulk_entry_t *entry           = &entries[index];
+    mlnx_object_id_t              mlnx_lag_member = {0};
+    sx_port_log_id_t              lag_log_port_id = 0;
+    sai_status_t                  status;
+    uint32_t                      ii;
+
+    SX_LOG_NTC("Remove SAI LAG member oid %" PRIx64 "\n", (uint64_t)lag_member_id);
+
+    status = sai_to_mlnx_object_id(SAI_OBJECT_TYPE_LAG_MEMBER, lag_member_id, &mlnx_lag_member);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    SX_PORT_TYPE_ID_SET(lag_log_port_id, SX_PORT_TYPE_LAG);
+    SX_PORT_LAG_ID_SET(lag_log_port_id, mlnx_lag_member.ext.lag.lag_id);
+    SX_PORT_SUB_ID_SET(lag_log_port_id, mlnx_lag_member.ext.lag.sub_id);
+
+    status = mlnx_port_by_log_id(mlnx_lag_member.id.log_port_id, &entry->port);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+    status = mlnx_port_by_log_id(lag_log_port_id, &entry->lag);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    if (entry->port->lag_id != entry->lag->logical) {
+        SX_LOG_ERR("Port %x is not a member of LAG %x\n", entry->port->logical, entry->lag->logical);
+        return SAI_STATUS_INVALID_OBJECT_ID;
+    }
+
+    for (ii = 0; ii < index; ii++) {
+        if (entries[ii].is_prepared && (entries[ii].port == entry->port)) {
+            SX_LOG_ERR("LAG member oid %" PRIx64 " is removed twice in this bulk\n", lag_member_id);
+            return SAI_STATUS_INVALID_PARAMETER;
+        }
+    }
+
+    entry->is_prepared = true;
+
+    return SAI_STATUS_SUCCESS;
+}
+
 /**
  * @brief Bulk lag members creation.
  *
@@ -1615,7 +1923,141 @@ sai_status_t mlnx_create_lag_members(_In_ sai_object_id_t         switch_id,
                                      _Out_ sai_object_id_t       *object_id,
                                      _Out_ sai_status_t          *object_statuses)
 {
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    mlnx_lag_member_bulk_entry_t *entries   = NULL;
+    mlnx_port_config_t          **ports     = NULL;
+    sx_port_log_id_t             *log_ports = NULL;
+    mlnx_port_config_t           *lag;
+    sx_status_t                   sx_status;
+    sai_status_t                  status, member_status;
+    uint32_t                      ii, jj, ports_count, members_count;
+    bool                          stop_on_error, failure, is_lag_failed;
+
+    SX_LOG_ENTER();
+
+    if (0 == object_count) {
+        SX_LOG_ERR("object_count is 0\n");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    if (!attr_count) {
+        SX_LOG_ERR("attr_count is NULL\n");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    if (!attrs) {
+        SX_LOG_ERR("attrs is NULL\n");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    if (!object_id) {
+        SX_LOG_ERR("object_id is NULL\n");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    if (!object_statuses) {
+        SX_LOG_ERR("object_statuses is NULL\n");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    if (SAI_BULK_OP_TYPE_INGORE_ERROR < type) {
+        SX_LOG_ERR("Invalid value for sai_bulk_op_type_t - %d\n", type);
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    stop_on_error = (type == SAI_BULK_OP_TYPE_STOP_ON_ERROR);
+
+    entries   = calloc(object_count, sizeof(*entries));
+    ports     = calloc(object_count, sizeof(*ports));
+    log_ports = calloc(object_count, sizeof(*log_ports));
+    if (!entries || !ports || !log_ports) {
+        SX_LOG_ERR("Failed to allocate memory\n");
+        status = SAI_STATUS_NO_MEMORY;
+        goto out_free;
+    }
+
+    failure = false;
+
+    sai_db_write_lock();
+
+    /* Align every port with its LAG first, the LAG takes its params from the first member */
+    for (ii = 0; ii < object_count; ii++) {
+        object_id[ii] = SAI_NULL_OBJECT_ID;
+
+        if (failure && stop_on_error) {
+            object_statuses[ii] = SAI_STATUS_NOT_EXECUTED;
+            continue;
+        }
+
+        status              = mlnx_lag_member_bulk_entry_prepare(attr_count[ii], attrs[ii], entries, ii);
+        object_statuses[ii] = SAI_ERR(status) ? status : SAI_STATUS_NOT_EXECUTED;
+        if (SAI_ERR(status)) {
+            SX_LOG_ERR("Failed to prepare LAG member #%u\n", ii);
+            failure = true;
+        }
+    }
+
+    /* Then add the members of every LAG at once */
+    for (ii = 0; ii < object_count; ii++) {
+        if (!entries[ii].is_prepared) {
+            continue;
+        }
+
+        lag         = entries[ii].lag;
+        ports_count = 0;
+        for (jj = ii; jj < object_count; jj++) {
+            if (entries[jj].is_prepared && (entries[jj].lag == lag)) {
+                ports[ports_count]     = entries[jj].port;
+                log_ports[ports_count] = entries[jj].port->logical;
+                ports_count++;
+            }
+        }
+
+        status = mlnx_lag_members_add(lag, ports, log_ports, ports_count);
+
+        is_lag_failed = false;
+        for (jj = ii; jj < object_count; jj++) {
+            if (!entries[jj].is_prepared || (entries[jj].lag != lag)) {
+                continue;
+            }
+
+            entries[jj].is_prepared = false;
+
+            member_status = status;
+            if (!SAI_ERR(member_status)) {
+                member_status = mlnx_lag_member_enable(lag, entries[jj].port, entries[jj].collect_mode,
+                                                       entries[jj].dist_mode, &object_id[jj]);
+            }
+
+            if (SAI_ERR(member_status)) {
+                failure       = true;
+                is_lag_failed = true;
+                mlnx_lag_member_port_rollback(lag, entries[jj].port, false);
+            }
+
+            object_statuses[jj] = member_status;
+        }
+
+        /* The LAG params are cleared once all the failed ports took theirs back from it */
+        if (is_lag_failed) {
+            sx_status = sx_api_lag_port_group_get(gh_sdk, DEFAULT_ETH_SWID, lag->logical, NULL, &members_count);
+            if (SX_ERR(sx_status)) {
+                SX_LOG_ERR("Failed to get LAG %x members count - %s\n", lag->logical, SX_STATUS_MSG(sx_status));
+            } else if ((0 == members_count) && SAI_ERR(mlnx_lag_params_clear(lag))) {
+                SX_LOG_ERR("Failed to clear params of LAG %x\n", lag->logical);
+            }
+        }
+    }
+
+    sai_db_unlock();
+
+    status = failure ? SAI_STATUS_FAILURE : SAI_STATUS_SUCCESS;
+
+out_free:
+    free(entries);
+    free(ports);
+    free(log_ports);
+    SX_LOG_EXIT();
+    return status;
 }
 
 /**
@@ -1635,7 +2077,139 @@ sai_status_t mlnx_remove_lag_members(_In_ uint32_t               object_count,
                                      _In_ sai_bulk_op_type_t     type,
                                      _Out_ sai_status_t         *object_statuses)
 {
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    mlnx_lag_member_bulk_entry_t *entries   = NULL;
+    sx_port_log_id_t             *log_ports = NULL;
+    mlnx_port_config_t           *lag;
+    sx_status_t                   sx_status;
+    sai_status_t                  status, member_status;
+    uint32_t                      ii, jj, ports_count, members_count;
+    bool                          stop_on_error, failure;
+
+    SX_LOG_ENTER();
+
+    if (0 == object_count) {
+        SX_LOG_ERR("object_count is 0\n");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    if (!object_id) {
+        SX_LOG_ERR("object_id is NULL\n");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    if (!object_statuses) {
+        SX_LOG_ERR("object_statuses is NULL\n");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    if (SAI_BULK_OP_TYPE_INGORE_ERROR < type) {
+        SX_LOG_ERR("Invalid value for sai_bulk_op_type_t - %d\n", type);
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    stop_on_error = (type == SAI_BULK_OP_TYPE_STOP_ON_ERROR);
+
+    entries   = calloc(object_count, sizeof(*entries));
+    log_ports = calloc(object_count, sizeof(*log_ports));
+    if (!entries || !log_ports) {
+        SX_LOG_ERR("Failed to allocate memory\n");
+        status = SAI_STATUS_NO_MEMORY;
+        goto out_free;
+    }
+
+    failure = false;
+
+    sai_db_write_lock();
+
+    for (ii = 0; ii < object_count; ii++) {
+        if (failure && stop_on_error) {
+            object_statuses[ii] = SAI_STATUS_NOT_EXECUTED;
+            continue;
+        }
+
+        status              = mlnx_lag_member_bulk_entry_lookup(object_id[ii], entries, ii);
+        object_statuses[ii] = SAI_ERR(status) ? status : SAI_STATUS_NOT_EXECUTED;
+        if (SAI_ERR(status)) {
+            failure = true;
+        }
+    }
+
+    /* Remove the members of every LAG at once */
+    for (ii = 0; ii < object_count; ii++) {
+        if (!entries[ii].is_prepared) {
+            continue;
+        }
+
+        lag         = entries[ii].lag;
+        ports_count = 0;
+        for (jj = ii; jj < object_count; jj++) {
+            if (entries[jj].is_prepared && (entries[jj].lag == lag)) {
+                log_ports[ports_count++] = entries[jj].port->logical;
+            }
+        }
+
+        sx_status = sx_api_lag_port_group_set(gh_sdk, SX_ACCESS_CMD_DELETE, DEFAULT_ETH_SWID,
+                                              &lag->logical, log_ports, ports_count);
+        if (SX_ERR(sx_status)) {
+            SX_LOG_ERR("Failed to remove %u ports from LAG %x - %s\n", ports_count, lag->logical,
+                       SX_STATUS_MSG(sx_status));
+        }
+        status = sdk_to_sai(sx_status);
+
+        for (jj = ii; jj < object_count; jj++) {
+            if (!entries[jj].is_prepared || (entries[jj].lag != lag)) {
+                continue;
+            }
+
+            entries[jj].is_prepared = false;
+
+            member_status = status;
+            if (!SAI_ERR(member_status)) {
+                member_status = mlnx_lag_member_port_restore(entries[jj].port, lag);
+            }
+
+            if (!SAI_ERR(member_status)) {
+                acl_global_lock();
+                member_status = mlnx_acl_port_lag_event_handle(entries[jj].port, ACL_EVENT_TYPE_LAG_MEMBER_DEL);
+                acl_global_unlock();
+            }
+
+            if (SAI_ERR(member_status)) {
+                failure = true;
+            }
+
+            object_statuses[jj] = member_status;
+        }
+
+        if (SAI_ERR(status)) {
+            continue;
+        }
+
+        sx_status = sx_api_lag_port_group_get(gh_sdk, DEFAULT_ETH_SWID, lag->logical, NULL, &members_count);
+        if (SX_ERR(sx_status)) {
+            SX_LOG_ERR("Failed to get LAG %x members count - %s\n", lag->logical, SX_STATUS_MSG(sx_status));
+            failure = true;
+            continue;
+        }
+
+        if (members_count == 0) {
+            status = mlnx_lag_params_clear(lag);
+            if (SAI_ERR(status)) {
+                SX_LOG_ERR("Failed to clear params of LAG %x\n", lag->logical);
+                failure = true;
+            }
+        }
+    }
+
+    sai_db_unlock();
+
+    status = failure ? SAI_STATUS_FAILURE : SAI_STATUS_SUCCESS;
+
+out_free:
+    free(entries);
+    free(log_ports);
+    SX_LOG_EXIT();
+    return status;
 }
 
 sai_status_t mlnx_lag_log_set(sx_verbosity_level_t level)
@@ -106,9 +106,9 @@ static sai_status_t mlnx_translate_sai_neighbor_entry_to_sdk(_In_ const sai_neig
  *
  * Note: IP address expected in Network Byte Order.
  */
-static sai_status_t mlnx_create_neighbor_entry(_In_ const sai_neighbor_entry_t* neighbor_entry,
-                                               _In_ uint32_t                    attr_count,
-                                               _In_ const sai_attribute_t      *attr_list)
+static sai_status_t mlnx_create_neighbor_entry_impl(_In_ const sai_neighbor_entry_t* neighbor_entry,
+                                                    _In_ uint32_t                    attr_count,
+                                                    _In_ const sai_attribute_t      *attr_list)
 {
     sai_status_t                 status;
     const sai_attribute_value_t *mac, *action, *no_host;
@@ -177,8 +177,8 @@ static sai_status_t mlnx_create_neighbor_entry(_In_ const sai_neighbor_entry_t*
     }
 
     if (SX_STATUS_SUCCESS !=
-        (status = sx_api_router_neigh_set(gh_sdk, SX_ACCESS_CMD_ADD, neigh_data.rif,
-                                          &ipaddr, &neigh_data))) {
+        (status = MLNX_PERF_SDK_CALL(sx_api_router_neigh_set(gh_sdk, SX_ACCESS_CMD_ADD, neigh_data.rif, &ipaddr,
+                                                             &neigh_data)))) {
         SX_LOG_ERR("Failed to create neighbor entry - %s.\n", SX_STATUS_MSG(status));
         return sdk_to_sai(status);
     }
@@ -187,6 +187,19 @@ static sai_status_t mlnx_create_neighbor_entry(_In_ const sai_neighbor_entry_t*
     return SAI_STATUS_SUCCESS;
 }
 
+static sai_status_t mlnx_create_neighbor_entry(_In_ const sai_neighbor_entry_t* neighbor_entry,
+                                               _In_ uint32_t                    attr_count,
+                                               _In_ const sai_attribute_t      *attr_list)
+{
+    sai_status_t status;
+
+    mlnx_perf_op_begin(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, MLNX_PERF_OP_CREATE);
+    status = mlnx_create_neighbor_entry_impl(neighbor_entry, attr_count, attr_list);
+    mlnx_perf_op_end(status);
+
+    return status;
+}
+
 /*
  * Routine Description:
  *    Remove neighbor entry
@@ -200,7 +213,7 @@ static sai_status_t mlnx_create_neighbor_entry(_In_ const sai_neighbor_entry_t*
  *
  * Note: IP address expected in Network Byte Order.
  */
-static sai_status_t mlnx_remove_neighbor_entry(_In_ const sai_neighbor_entry_t* neighbor_entry)
+static sai_status_t mlnx_remove_neighbor_entry_impl(_In_ const sai_neighbor_entry_t* neighbor_entry)
 {
     sai_status_t          status;
     char                  key_str[MAX_KEY_STR_LEN];
@@ -233,7 +246,8 @@ static sai_status_t mlnx_remove_neighbor_entry(_In_ const sai_neighbor_entry_t*
 
     if (SX_STATUS_SUCCESS !=
         (status =
-             sx_api_router_neigh_set(gh_sdk, SX_ACCESS_CMD_DELETE, neigh_data.rif, &ipaddr, &neigh_data))) {
+             MLNX_PERF_SDK_CALL(sx_api_router_neigh_set(gh_sdk, SX_ACCESS_CMD_DELETE, neigh_data.rif, &ipaddr,
+                                                        &neigh_data)))) {
         SX_LOG_ERR("Failed to remove neighbor entry - %s.\n", SX_STATUS_MSG(status));
         return sdk_to_sai(status);
     }
@@ -242,6 +256,17 @@ static sai_status_t mlnx_remove_neighbor_entry(_In_ const sai_neighbor_entry_t*
     return SAI_STATUS_SUCCESS;
 }
 
+static sai_status_t mlnx_remove_neighbor_entry(_In_ const sai_neighbor_entry_t* neighbor_entry)
+{
+    sai_status_t status;
+
+    mlnx_perf_op_begin(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, MLNX_PERF_OP_REMOVE);
+    status = mlnx_remove_neighbor_entry_impl(neighbor_entry);
+    mlnx_perf_op_end(status);
+
+    return status;
+}
+
 /*
  * Routine Description:
  *    Set neighbor attribute value
@@ -443,16 +468,16 @@ static sai_status_t mlnx_modify_neighbor_entry(_In_ const sai_neighbor_entry_t*
     /* To modify a neighbor, we delete and readd it with new data */
     if (SX_STATUS_SUCCESS !=
         (status =
-             sx_api_router_neigh_set(gh_sdk, SX_ACCESS_CMD_DELETE, (sx_router_interface_t)rif_data, &ipaddr,
-                                     &neigh_data))) {
+             MLNX_PERF_SDK_CALL(sx_api_router_neigh_set(gh_sdk, SX_ACCESS_CMD_DELETE, (sx_router_interface_t)rif_data,
+                                                        &ipaddr, &neigh_data)))) {
         SX_LOG_ERR("Failed to remove neighbor entry - %s.\n", SX_STATUS_MSG(status));
         return sdk_to_sai(status);
     }
 
     if (SX_STATUS_SUCCESS !=
         (status =
-             sx_api_router_neigh_set(gh_sdk, SX_ACCESS_CMD_ADD, (sx_router_interface_t)rif_data, &ipaddr,
-                                     new_neigh_data))) {
+             MLNX_PERF_SDK_CALL(sx_api_router_neigh_set(gh_sdk, SX_ACCESS_CMD_ADD, (sx_router_interface_t)rif_data,
+                                                        &ipaddr, new_neigh_data)))) {
         SX_LOG_ERR("Failed to create neighbor entry - %s.\n", SX_STATUS_MSG(status));
         return sdk_to_sai(status);
     }
@@ -569,8 +594,9 @@ static sai_status_t mlnx_remove_all_neighbor_entries(_In_ sai_object_id_t switch
 
     if (SX_STATUS_SUCCESS !=
         (status =
-             sx_api_router_neigh_set(gh_sdk, SX_ACCESS_CMD_DELETE_ALL, g_resource_limits.router_rifs_dontcare, &ipaddr,
-                                     &neigh_data))) {
+             MLNX_PERF_SDK_CALL(sx_api_router_neigh_set(gh_sdk, SX_ACCESS_CMD_DELETE_ALL,
+                                                        g_resource_limits.router_rifs_dontcare, &ipaddr,
+                                                        &neigh_data)))) {
         SX_LOG_ERR("Failed to remove all neighbor entries - %s.\n", SX_STATUS_MSG(status));
         return sdk_to_sai(status);
     }
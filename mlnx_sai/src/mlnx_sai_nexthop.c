@@ -29,6 +29,7 @@ static sai_status_t mlnx_next_hop_attr_get(_In_ const sai_object_key_t   *key,
                                            _In_ uint32_t                  attr_index,
                                            _Inout_ vendor_cache_t        *cache,
                                            void                          *arg);
+static sai_status_t mlnx_nhop_instance_release(_In_ sx_ecmp_id_t sdk_ecmp_id, _In_ uint16_t instance);
 static const sai_vendor_attribute_entry_t next_hop_vendor_attribs[] = {
     { SAI_NEXT_HOP_ATTR_TYPE,
       { true, false, false, true },
@@ -67,6 +68,430 @@ static void next_hop_key_to_str(_In_ sai_object_id_t next_hop_id, _Out_ char *ke
     }
 }
 
+static uint32_t mlnx_nhop_cache_slot(_In_ sx_ecmp_id_t ecmp_id)
+{
+    return ecmp_id % MLNX_NHOP_CACHE_SIZE;
+}
+
+static uint32_t mlnx_nhop_intern_slot(_In_ const sx_next_hop_key_t *key)
+{
+    const uint8_t *bytes = (const uint8_t*)key;
+    uint32_t       hash  = 2166136261U;
+    uint32_t       ii;
+
+    for (ii = 0; ii < sizeof(*key); ii++) {
+        hash = (hash ^ bytes[ii]) * 16777619U;
+    }
+
+    return hash % MLNX_NHOP_CACHE_SIZE;
+}
+
+static uint32_t mlnx_nhop_cache_entry_home(_In_ const void *entry)
+{
+    return mlnx_nhop_cache_slot(((const mlnx_nhop_cache_entry_t*)entry)->ecmp_id);
+}
+
+static uint32_t mlnx_nhop_intern_entry_home(_In_ const void *entry)
+{
+    return mlnx_nhop_intern_slot(&((const mlnx_nhop_intern_entry_t*)entry)->key);
+}
+
+/*
+ * Frees a slot of a linear probing table and shifts back the entries of the probe chain,
+ * so lookups don't stop at the freed slot. Entries must start with the is_used flag.
+ */
+static void mlnx_nhop_table_slot_free(_In_ void     *table,
+                                      _In_ size_t    entry_size,
+                                      _In_ uint32_t  hole,
+                                      _In_ uint32_t (*home_get)(_In_ const void *entry))
+{
+    uint8_t *entries = table;
+    uint32_t next, home;
+    bool     is_movable;
+
+    next = (hole + 1) % MLNX_NHOP_CACHE_SIZE;
+    while (*(bool*)(entries + next * entry_size)) {
+        home = home_get(entries + next * entry_size);
+
+        if (next > hole) {
+            is_movable = (home <= hole) || (home > next);
+        } else {
+            is_movable = (home <= hole) && (home > next);
+        }
+
+        if (is_movable) {
+            memcpy(entries + hole * entry_size, entries + next * entry_size, entry_size);
+            sai_db_dirty_mark(entries + hole * entry_size, entry_size);
+            hole = next;
+        }
+
+        next = (next + 1) % MLNX_NHOP_CACHE_SIZE;
+    }
+
+    memset(entries + hole * entry_size, 0, entry_size);
+    sai_db_dirty_mark(entries + hole * entry_size, entry_size);
+}
+
+/* DB read lock is needed */
+static mlnx_nhop_cache_entry_t * mlnx_nhop_cache_find(_In_ sx_ecmp_id_t ecmp_id, _Out_opt_ uint32_t *index)
+{
+    mlnx_nhop_cache_entry_t *entry;
+    uint32_t                 slot, ii;
+
+    slot = mlnx_nhop_cache_slot(ecmp_id);
+
+    /* Linear probing, the table always keeps a free slot to stop the lookup */
+    for (ii = 0; ii < MLNX_NHOP_CACHE_SIZE; ii++) {
+        entry = &g_sai_db_ptr->nhop_cache.entries[(slot + ii) % MLNX_NHOP_CACHE_SIZE];
+        if (!entry->is_used) {
+            return NULL;
+        }
+
+        if (entry->ecmp_id == ecmp_id) {
+            if (index) {
+                *index = (slot + ii) % MLNX_NHOP_CACHE_SIZE;
+            }
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+/* DB read lock is needed */
+static mlnx_nhop_intern_entry_t * mlnx_nhop_intern_find(_In_ const sx_next_hop_key_t *key, _Out_opt_ uint32_t *index)
+{
+    mlnx_nhop_intern_entry_t *entry;
+    uint32_t                  slot, ii;
+
+    slot = mlnx_nhop_intern_slot(key);
+
+    for (ii = 0; ii < MLNX_NHOP_CACHE_SIZE; ii++) {
+        entry = &g_sai_db_ptr->nhop_cache.intern[(slot + ii) % MLNX_NHOP_CACHE_SIZE];
+        if (!entry->is_used) {
+            return NULL;
+        }
+
+        if (0 == memcmp(&entry->key, key, sizeof(*key))) {
+            if (index) {
+                *index = (slot + ii) % MLNX_NHOP_CACHE_SIZE;
+            }
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+/* DB write lock is needed */
+static void mlnx_nhop_intern_add(_In_ const sx_next_hop_key_t *key, _In_ sx_ecmp_id_t ecmp_id)
+{
+    mlnx_nhop_cache_t        *cache = &g_sai_db_ptr->nhop_cache;
+    mlnx_nhop_intern_entry_t *entry;
+    uint32_t                  slot;
+
+    /* The same next hop may have been created concurrently, keep sharing the first one */
+    if (mlnx_nhop_intern_find(key, NULL)) {
+        return;
+    }
+
+    if (cache->intern_count >= MLNX_NHOP_CACHE_SIZE - 1) {
+        return;
+    }
+
+    slot = mlnx_nhop_intern_slot(key);
+    while (cache->intern[slot].is_used) {
+        slot = (slot + 1) % MLNX_NHOP_CACHE_SIZE;
+    }
+
+    entry          = &cache->intern[slot];
+    entry->is_used = true;
+    entry->ecmp_id = ecmp_id;
+    memcpy(&entry->key, key, sizeof(entry->key));
+    sai_db_dirty_mark(entry, sizeof(*entry));
+
+    cache->intern_count++;
+    sai_db_field_dirty_mark(nhop_cache.intern_count);
+}
+
+/* DB write lock is needed */
+static void mlnx_nhop_intern_del(_In_ const sx_next_hop_key_t *key, _In_ sx_ecmp_id_t ecmp_id)
+{
+    mlnx_nhop_cache_t        *cache = &g_sai_db_ptr->nhop_cache;
+    mlnx_nhop_intern_entry_t *entry;
+    uint32_t                  index;
+
+    entry = mlnx_nhop_intern_find(key, &index);
+    if (!entry || (entry->ecmp_id != ecmp_id)) {
+        return;
+    }
+
+    mlnx_nhop_table_slot_free(cache->intern, sizeof(cache->intern[0]), index, mlnx_nhop_intern_entry_home);
+
+    cache->intern_count--;
+    sai_db_field_dirty_mark(nhop_cache.intern_count);
+}
+
+/* DB write lock is needed */
+void mlnx_nhop_cache_add(_In_ sx_ecmp_id_t ecmp_id, _In_ const sx_next_hop_t *next_hop)
+{
+    mlnx_nhop_cache_t       *cache = &g_sai_db_ptr->nhop_cache;
+    mlnx_nhop_cache_entry_t *entry;
+    uint32_t                 slot;
+
+    assert(next_hop);
+
+    entry = mlnx_nhop_cache_find(ecmp_id, NULL);
+    if (!entry) {
+        if (cache->count >= MLNX_NHOP_CACHE_SIZE - 1) {
+            SX_LOG_NTC("Next hop cache is full, ecmp %u will be read from SDK\n", ecmp_id);
+            return;
+        }
+
+        slot = mlnx_nhop_cache_slot(ecmp_id);
+        while (cache->entries[slot].is_used) {
+            slot = (slot + 1) % MLNX_NHOP_CACHE_SIZE;
+        }
+
+        entry          = &cache->entries[slot];
+        entry->is_used = true;
+        entry->ecmp_id = ecmp_id;
+        cache->count++;
+        sai_db_field_dirty_mark(nhop_cache.count);
+    }
+
+    memcpy(&entry->next_hop, next_hop, sizeof(entry->next_hop));
+    entry->instances     = 1;
+    entry->next_instance = 1;
+    sai_db_dirty_mark(entry, sizeof(*entry));
+
+    if (cache->is_sharing_enabled) {
+        mlnx_nhop_intern_add(&next_hop->next_hop_key, ecmp_id);
+    }
+}
+
+/* DB write lock is needed */
+void mlnx_nhop_cache_del(_In_ sx_ecmp_id_t ecmp_id)
+{
+    mlnx_nhop_cache_t       *cache = &g_sai_db_ptr->nhop_cache;
+    mlnx_nhop_cache_entry_t *entry;
+    uint32_t                 index;
+
+    entry = mlnx_nhop_cache_find(ecmp_id, &index);
+    if (!entry) {
+        return;
+    }
+
+    mlnx_nhop_intern_del(&entry->next_hop.next_hop_key, ecmp_id);
+
+    mlnx_nhop_table_slot_free(cache->entries, sizeof(cache->entries[0]), index, mlnx_nhop_cache_entry_home);
+
+    cache->count--;
+    sai_db_field_dirty_mark(nhop_cache.count);
+}
+
+/*
+ * DB write lock is needed.
+ * Takes a free instance on the container of an identical next hop, returns false if there is none.
+ */
+static bool mlnx_nhop_cache_share(_In_ const sx_next_hop_t *next_hop,
+                                  _Out_ sx_ecmp_id_t       *ecmp_id,
+                                  _Out_ uint16_t           *instance)
+{
+    mlnx_nhop_intern_entry_t *intern;
+    mlnx_nhop_cache_entry_t  *entry;
+    uint32_t                  candidate, ii;
+
+    if (!g_sai_db_ptr->nhop_cache.is_sharing_enabled) {
+        return false;
+    }
+
+    intern = mlnx_nhop_intern_find(&next_hop->next_hop_key, NULL);
+    if (!intern) {
+        return false;
+    }
+
+    entry = mlnx_nhop_cache_find(intern->ecmp_id, NULL);
+    if (!entry) {
+        return false;
+    }
+
+    /* Instance 0 is the creator, the lookup wraps around after the last one and skips the live ones */
+    for (ii = 0; ii < MLNX_NHOP_INSTANCES_MAX - 1; ii++) {
+        candidate = 1 + (entry->next_instance - 1 + ii) % (MLNX_NHOP_INSTANCES_MAX - 1);
+        if (!(entry->instances & (1ULL << candidate))) {
+            break;
+        }
+    }
+
+    if (ii == MLNX_NHOP_INSTANCES_MAX - 1) {
+        SX_LOG_NTC("All %u instances of ecmp %u are in use, creating a new one\n",
+                   MLNX_NHOP_INSTANCES_MAX, entry->ecmp_id);
+        return false;
+    }
+
+    *ecmp_id  = entry->ecmp_id;
+    *instance = (uint16_t)candidate;
+
+    entry->instances    |= 1ULL << candidate;
+    entry->next_instance = (uint16_t)(candidate % (MLNX_NHOP_INSTANCES_MAX - 1) + 1);
+    sai_db_dirty_mark(entry, sizeof(*entry));
+
+    return true;
+}
+
+/*
+ * DB read lock is needed.
+ * Containers that are not cached were never shared, instance 0 is their only object.
+ */
+static bool mlnx_nhop_instance_is_live(_In_ sx_ecmp_id_t ecmp_id, _In_ uint16_t instance)
+{
+    const mlnx_nhop_cache_entry_t *entry;
+
+    entry = mlnx_nhop_cache_find(ecmp_id, NULL);
+    if (!entry) {
+        return 0 == instance;
+    }
+
+    return (instance < MLNX_NHOP_INSTANCES_MAX) && (entry->instances & (1ULL << instance));
+}
+
+/*
+ * DB write lock is needed.
+ * Drops an instance of a shared container, is_in_use is false if it is the last one, it's left to
+ * mlnx_nhop_cache_del() then.
+ */
+static sai_status_t mlnx_nhop_cache_unshare(_In_ sx_ecmp_id_t ecmp_id, _In_ uint16_t instance, _Out_ bool *is_in_use)
+{
+    mlnx_nhop_cache_entry_t *entry;
+
+    *is_in_use = false;
+
+    if (!mlnx_nhop_instance_is_live(ecmp_id, instance)) {
+        SX_LOG_ERR("Next hop instance %u of ecmp %u doesn't exist\n", instance, ecmp_id);
+        return SAI_STATUS_INVALID_OBJECT_ID;
+    }
+
+    entry = mlnx_nhop_cache_find(ecmp_id, NULL);
+    if (!entry || (entry->instances == (1ULL << instance))) {
+        return SAI_STATUS_SUCCESS;
+    }
+
+    entry->instances &= ~(1ULL << instance);
+    sai_db_dirty_mark(entry, sizeof(*entry));
+
+    *is_in_use = true;
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static sai_status_t mlnx_nhop_oid_parse(_In_ sai_object_id_t next_hop_id,
+                                        _Out_ sx_ecmp_id_t   *ecmp_id,
+                                        _Out_ uint16_t       *instance)
+{
+    sai_status_t status;
+    uint8_t      ext_data[EXTENDED_DATA_SIZE];
+
+    status = mlnx_object_to_type(next_hop_id, SAI_OBJECT_TYPE_NEXT_HOP, ecmp_id, ext_data);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    *instance = (uint16_t)(ext_data[0] | (ext_data[1] << 8));
+
+    return SAI_STATUS_SUCCESS;
+}
+
+sai_status_t mlnx_nhop_oid_validate(_In_ sai_object_id_t next_hop_id, _Out_opt_ sx_ecmp_id_t *sdk_ecmp_id)
+{
+    sai_status_t status;
+    sx_ecmp_id_t ecmp_id;
+    uint16_t     instance;
+    bool         is_live;
+
+    status = mlnx_nhop_oid_parse(next_hop_id, &ecmp_id, &instance);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    sai_db_read_lock();
+    is_live = mlnx_nhop_instance_is_live(ecmp_id, instance);
+    sai_db_unlock();
+
+    if (!is_live) {
+        SX_LOG_ERR("Next hop instance %u of ecmp %u doesn't exist\n", instance, ecmp_id);
+        return SAI_STATUS_INVALID_OBJECT_ID;
+    }
+
+    if (sdk_ecmp_id) {
+        *sdk_ecmp_id = ecmp_id;
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+sai_status_t mlnx_nhop_oid_get(_In_ sx_ecmp_id_t ecmp_id, _Out_ sai_object_id_t *next_hop_id)
+{
+    const mlnx_nhop_cache_entry_t *entry;
+    uint16_t                       instance = 0;
+    uint8_t                        ext_data[EXTENDED_DATA_SIZE];
+
+    assert(next_hop_id);
+
+    sai_db_read_lock();
+
+    /* The creator may be gone while other objects still share the container */
+    entry = mlnx_nhop_cache_find(ecmp_id, NULL);
+    if (entry && entry->instances) {
+        while (!(entry->instances & (1ULL << instance))) {
+            instance++;
+        }
+    }
+
+    sai_db_unlock();
+
+    memset(ext_data, 0, sizeof(ext_data));
+    ext_data[0] = instance & 0xff;
+    ext_data[1] = instance >> 8;
+
+    return mlnx_create_object(SAI_OBJECT_TYPE_NEXT_HOP, ecmp_id, ext_data, next_hop_id);
+}
+
+sai_status_t mlnx_nhop_get_by_ecmp_id(_In_ sx_ecmp_id_t ecmp_id, _Out_ sx_next_hop_t *next_hop)
+{
+    const mlnx_nhop_cache_entry_t *entry;
+    uint32_t                       next_hop_cnt = 1;
+    sx_status_t                    sx_status;
+
+    assert(next_hop);
+
+    sai_db_read_lock();
+
+    entry = mlnx_nhop_cache_find(ecmp_id, NULL);
+    if (entry) {
+        memcpy(next_hop, &entry->next_hop, sizeof(*next_hop));
+        sai_db_unlock();
+        return SAI_STATUS_SUCCESS;
+    }
+
+    sai_db_unlock();
+
+    /* Not cached, e.g. the cache was full when the next hop was created */
+    memset(next_hop, 0, sizeof(*next_hop));
+    sx_status = MLNX_PERF_SDK_CALL(sx_api_router_ecmp_get(gh_sdk, ecmp_id, next_hop, &next_hop_cnt));
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Failed to get ecmp - %s id %u\n", SX_STATUS_MSG(sx_status), ecmp_id);
+        return sdk_to_sai(sx_status);
+    }
+
+    if (1 != next_hop_cnt) {
+        SX_LOG_ERR("Invalid next hops count %u for ecmp id %u\n", next_hop_cnt, ecmp_id);
+        return SAI_STATUS_FAILURE;
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
 _Success_(return == SAI_STATUS_SUCCESS)
 static sai_status_t mlnx_translate_sdk_next_hop_entry_to_sai(_In_ const sx_next_hop_t  *next_hop,
                                                              _Out_ sai_next_hop_type_t *type,
@@ -237,10 +662,10 @@ static sai_status_t mlnx_translate_sai_next_hop_to_sdk(_In_ sai_next_hop_type_t
  *
  * Note: IP address expected in Network Byte Order.
  */
-static sai_status_t mlnx_create_next_hop(_Out_ sai_object_id_t      *next_hop_id,
-                                         _In_ sai_object_id_t        switch_id,
-                                         _In_ uint32_t               attr_count,
-                                         _In_ const sai_attribute_t *attr_list)
+static sai_status_t mlnx_create_next_hop_impl(_Out_ sai_object_id_t      *next_hop_id,
+                                              _In_ sai_object_id_t        switch_id,
+                                              _In_ uint32_t               attr_count,
+                                              _In_ const sai_attribute_t *attr_list)
 {
     sai_status_t                 sai_status;
     sx_status_t                  sdk_status;
@@ -256,6 +681,9 @@ static sai_status_t mlnx_create_next_hop(_Out_ sai_object_id_t      *next_hop_id
     uint32_t                     next_hop_cnt;
     bool                         is_tunnel_ipinip = false;
     uint32_t                     tunnel_db_idx    = 0;
+    bool                         is_shared        = false;
+    uint16_t                     instance         = 0;
+    uint8_t                      ext_data[EXTENDED_DATA_SIZE];
 
     SX_LOG_ENTER();
 
@@ -390,18 +818,39 @@ static sai_status_t mlnx_create_next_hop(_Out_ sai_object_id_t      *next_hop_id
             return sai_status;
         }
 
-        next_hop_cnt = 1;
+        sai_db_write_lock();
+        is_shared = mlnx_nhop_cache_share(&sdk_next_hop, &sdk_ecmp_id, &instance);
+        sai_db_sync_async();
+        sai_db_unlock();
 
-        if (SX_STATUS_SUCCESS !=
-            (sdk_status =
-                 sx_api_router_ecmp_set(gh_sdk, SX_ACCESS_CMD_CREATE, &sdk_ecmp_id, &sdk_next_hop, &next_hop_cnt))) {
-            SX_LOG_ERR("Failed to create ecmp - %s.\n", SX_STATUS_MSG(sdk_status));
-            SX_LOG_EXIT();
-            return sdk_to_sai(sdk_status);
+        if (!is_shared) {
+            next_hop_cnt = 1;
+
+            if (SX_STATUS_SUCCESS !=
+                (sdk_status =
+                     MLNX_PERF_SDK_CALL(sx_api_router_ecmp_set(gh_sdk, SX_ACCESS_CMD_CREATE, &sdk_ecmp_id,
+                                                               &sdk_next_hop, &next_hop_cnt)))) {
+                SX_LOG_ERR("Failed to create ecmp - %s.\n", SX_STATUS_MSG(sdk_status));
+                SX_LOG_EXIT();
+                return sdk_to_sai(sdk_status);
+            }
+        }
+
+        /* Objects sharing a container are told apart by the instance in the extended data */
+        memset(ext_data, 0, sizeof(ext_data));
+        ext_data[0] = instance & 0xff;
+        ext_data[1] = instance >> 8;
+
+        if (!is_shared) {
+            sai_db_write_lock();
+            mlnx_nhop_cache_add(sdk_ecmp_id, &sdk_next_hop);
+            sai_db_sync_async();
+            sai_db_unlock();
         }
 
         if (SAI_STATUS_SUCCESS !=
-            (sai_status = mlnx_create_object(SAI_OBJECT_TYPE_NEXT_HOP, sdk_ecmp_id, NULL, next_hop_id))) {
+            (sai_status = mlnx_create_object(SAI_OBJECT_TYPE_NEXT_HOP, sdk_ecmp_id, ext_data, next_hop_id))) {
+            mlnx_nhop_instance_release(sdk_ecmp_id, instance);
             SX_LOG_EXIT();
             return sai_status;
         }
@@ -414,6 +863,52 @@ static sai_status_t mlnx_create_next_hop(_Out_ sai_object_id_t      *next_hop_id
     return SAI_STATUS_SUCCESS;
 }
 
+static sai_status_t mlnx_create_next_hop(_Out_ sai_object_id_t      *next_hop_id,
+                                         _In_ sai_object_id_t        switch_id,
+                                         _In_ uint32_t               attr_count,
+                                         _In_ const sai_attribute_t *attr_list)
+{
+    sai_status_t status;
+
+    mlnx_perf_op_begin(SAI_OBJECT_TYPE_NEXT_HOP, MLNX_PERF_OP_CREATE);
+    status = mlnx_create_next_hop_impl(next_hop_id, switch_id, attr_count, attr_list);
+    mlnx_perf_op_end(status);
+
+    return status;
+}
+
+/* Drops an instance, the container is destroyed with the last one */
+static sai_status_t mlnx_nhop_instance_release(_In_ sx_ecmp_id_t sdk_ecmp_id, _In_ uint16_t instance)
+{
+    sai_status_t status;
+    sx_status_t  sdk_status;
+    uint32_t     next_hop_cnt = 0;
+    bool         is_in_use;
+
+    sai_db_write_lock();
+    status = mlnx_nhop_cache_unshare(sdk_ecmp_id, instance, &is_in_use);
+    sai_db_sync_async();
+    sai_db_unlock();
+
+    if (SAI_ERR(status) || is_in_use) {
+        return status;
+    }
+
+    if (SX_STATUS_SUCCESS !=
+        (sdk_status = MLNX_PERF_SDK_CALL(sx_api_router_ecmp_set(gh_sdk, SX_ACCESS_CMD_DESTROY, &sdk_ecmp_id, NULL,
+                                                                &next_hop_cnt)))) {
+        SX_LOG_ERR("Failed to destroy ecmp - %s.\n", SX_STATUS_MSG(sdk_status));
+        return sdk_to_sai(sdk_status);
+    }
+
+    sai_db_write_lock();
+    mlnx_nhop_cache_del(sdk_ecmp_id);
+    sai_db_sync_async();
+    sai_db_unlock();
+
+    return SAI_STATUS_SUCCESS;
+}
+
 /*
  * Routine Description:
  *    Remove next hop
@@ -425,31 +920,37 @@ static sai_status_t mlnx_create_next_hop(_Out_ sai_object_id_t      *next_hop_id
  *    SAI_STATUS_SUCCESS on success
  *    Failure status code on error
  */
-static sai_status_t mlnx_remove_next_hop(_In_ sai_object_id_t next_hop_id)
+static sai_status_t mlnx_remove_next_hop_impl(_In_ sai_object_id_t next_hop_id)
 {
     sai_status_t status;
     sx_ecmp_id_t sdk_ecmp_id;
     char         key_str[MAX_KEY_STR_LEN];
-    uint32_t     next_hop_cnt = 0;
+    uint16_t     instance;
 
     SX_LOG_ENTER();
 
     next_hop_key_to_str(next_hop_id, key_str);
     SX_LOG_NTC("Remove next hop %s\n", key_str);
 
-    if (SAI_STATUS_SUCCESS !=
-        (status = mlnx_object_to_type(next_hop_id, SAI_OBJECT_TYPE_NEXT_HOP, &sdk_ecmp_id, NULL))) {
+    if (SAI_STATUS_SUCCESS != (status = mlnx_nhop_oid_parse(next_hop_id, &sdk_ecmp_id, &instance))) {
         return status;
     }
 
-    if (SX_STATUS_SUCCESS !=
-        (status = sx_api_router_ecmp_set(gh_sdk, SX_ACCESS_CMD_DESTROY, &sdk_ecmp_id, NULL, &next_hop_cnt))) {
-        SX_LOG_ERR("Failed to destroy ecmp - %s.\n", SX_STATUS_MSG(status));
-        return sdk_to_sai(status);
-    }
+    status = mlnx_nhop_instance_release(sdk_ecmp_id, instance);
 
     SX_LOG_EXIT();
-    return SAI_STATUS_SUCCESS;
+    return status;
+}
+
+static sai_status_t mlnx_remove_next_hop(_In_ sai_object_id_t next_hop_id)
+{
+    sai_status_t status;
+
+    mlnx_perf_op_begin(SAI_OBJECT_TYPE_NEXT_HOP, MLNX_PERF_OP_REMOVE);
+    status = mlnx_remove_next_hop_impl(next_hop_id);
+    mlnx_perf_op_end(status);
+
+    return status;
 }
 
 /*
@@ -468,10 +969,17 @@ static sai_status_t mlnx_set_next_hop_attribute(_In_ sai_object_id_t next_hop_id
 {
     const sai_object_key_t key = { .key.object_id = next_hop_id };
     char                   key_str[MAX_KEY_STR_LEN];
+    sai_status_t           status;
 
     SX_LOG_ENTER();
 
     next_hop_key_to_str(next_hop_id, key_str);
+
+    status = mlnx_nhop_oid_validate(next_hop_id, NULL);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
     return sai_set_attribute(&key, key_str, SAI_OBJECT_TYPE_NEXT_HOP, next_hop_vendor_attribs, attr);
 }
 
@@ -495,10 +1003,17 @@ static sai_status_t mlnx_get_next_hop_attribute(_In_ sai_object_id_t     next_ho
 {
     const sai_object_key_t key = { .key.object_id = next_hop_id };
     char                   key_str[MAX_KEY_STR_LEN];
+    sai_status_t           status;
 
     SX_LOG_ENTER();
 
     next_hop_key_to_str(next_hop_id, key_str);
+
+    status = mlnx_nhop_oid_validate(next_hop_id, NULL);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
     return sai_get_attributes(&key, key_str, SAI_OBJECT_TYPE_NEXT_HOP, next_hop_vendor_attribs, attr_count, attr_list);
 }
 
@@ -514,7 +1029,6 @@ static sai_status_t mlnx_next_hop_attr_get(_In_ const sai_object_key_t   *key,
     sai_status_t        status;
     long                attr = (long)arg;
     sx_next_hop_t       sdk_next_hop;
-    uint32_t            sdk_next_hop_cnt;
     sx_ecmp_id_t        sdk_ecmp_id;
     sai_next_hop_type_t next_hop_type;
     sai_ip_address_t    next_hop_ip;
@@ -535,16 +1049,8 @@ static sai_status_t mlnx_next_hop_attr_get(_In_ const sai_object_key_t   *key,
         return status;
     }
 
-    sdk_next_hop_cnt = 1;
-    if (SX_STATUS_SUCCESS !=
-        (status = sx_api_router_ecmp_get(gh_sdk, sdk_ecmp_id, &sdk_next_hop, &sdk_next_hop_cnt))) {
-        SX_LOG_ERR("Failed to get ecmp - %s.\n", SX_STATUS_MSG(status));
-        return sdk_to_sai(status);
-    }
-
-    if (1 != sdk_next_hop_cnt) {
-        SX_LOG_ERR("Invalid next hosts count %u\n", sdk_next_hop_cnt);
-        return SAI_STATUS_FAILURE;
+    if (SAI_STATUS_SUCCESS != (status = mlnx_nhop_get_by_ecmp_id(sdk_ecmp_id, &sdk_next_hop))) {
+        return status;
     }
 
     if (SAI_STATUS_SUCCESS !=
@@ -107,25 +107,6 @@ static void next_hop_group_key_to_str(_In_ sai_object_id_t next_hop_group_id, _O
     }
 }
 
-static sai_status_t mlnx_sdk_nhop_by_ecmp_id_get(sx_ecmp_id_t sdk_ecmp_id, sx_next_hop_t *sx_next_hop)
-{
-    uint32_t    sdk_next_hop_cnt = 1;
-    sx_status_t status;
-
-    status = sx_api_router_ecmp_get(gh_sdk, sdk_ecmp_id, sx_next_hop, &sdk_next_hop_cnt);
-    if (SX_ERR(status)) {
-        SX_LOG_ERR("Failed to get ecmp - %s id %u\n", SX_STATUS_MSG(status), sdk_ecmp_id);
-        return sdk_to_sai(status);
-    }
-
-    if (1 != sdk_next_hop_cnt) {
-        SX_LOG_ERR("Invalid next hosts count %u for ecmp id %u\n", sdk_next_hop_cnt, sdk_ecmp_id);
-        return SAI_STATUS_FAILURE;
-    }
-
-    return SAI_STATUS_SUCCESS;
-}
-
 static int sx_nhop_equal(sx_next_hop_t *nhop1, sx_next_hop_t *nhop2)
 {
     return !memcmp(&nhop1->next_hop_key, &nhop2->next_hop_key, sizeof(nhop2->next_hop_key));
@@ -156,12 +137,12 @@ static sai_status_t mlnx_translate_sai_next_hop_object(_In_ uint32_t
     sx_ecmp_id_t sdk_ecmp_id;
     sai_status_t status;
 
-    status = mlnx_object_to_type(next_hop_id, SAI_OBJECT_TYPE_NEXT_HOP, &sdk_ecmp_id, NULL);
+    status = mlnx_nhop_oid_validate(next_hop_id, &sdk_ecmp_id);
     if (SAI_ERR(status)) {
         return status;
     }
 
-    status = mlnx_sdk_nhop_by_ecmp_id_get(sdk_ecmp_id, sx_next_hop);
+    status = mlnx_nhop_get_by_ecmp_id(sdk_ecmp_id, sx_next_hop);
     if (SAI_ERR(status)) {
         SX_LOG_ERR("Failed to get nhop ecmp at index %u\n", index);
         return status;
@@ -492,7 +473,7 @@ static sai_status_t mlnx_next_hop_group_member_hop_id_get(_In_ const sai_object_
         goto out;
     }
 
-    status = mlnx_create_object(SAI_OBJECT_TYPE_NEXT_HOP, sx_nhop_id, NULL, &value->oid);
+    status = mlnx_nhop_oid_get(sx_nhop_id, &value->oid);
     if (SAI_ERR(status)) {
         goto out;
     }
@@ -530,7 +511,7 @@ static sai_status_t mlnx_next_hop_group_member_hop_weight_get(_In_ const sai_obj
         goto out;
     }
 
-    status = mlnx_sdk_nhop_by_ecmp_id_get(sx_nhop_id, &next_hop);
+    status = mlnx_nhop_get_by_ecmp_id(sx_nhop_id, &next_hop);
     if (SAI_ERR(status)) {
         goto out;
     }
@@ -573,7 +554,7 @@ static sai_status_t mlnx_next_hop_group_member_hop_weight_set(_In_ const sai_obj
         goto out;
     }
 
-    status = mlnx_sdk_nhop_by_ecmp_id_get(sx_nhop_id, &next_hop);
+    status = mlnx_nhop_get_by_ecmp_id(sx_nhop_id, &next_hop);
     if (SAI_ERR(status)) {
         goto out;
     }
@@ -663,7 +644,7 @@ static sai_status_t mlnx_create_next_hop_group_member(_Out_ sai_object_id_t
         return status;
     }
 
-    status = mlnx_object_to_type(next_hop->oid, SAI_OBJECT_TYPE_NEXT_HOP, &nhop_ecmp_id, NULL);
+    status = mlnx_nhop_oid_validate(next_hop->oid, &nhop_ecmp_id);
     if (SAI_ERR(status)) {
         return status;
     }
@@ -741,7 +722,7 @@ static sai_status_t mlnx_remove_next_hop_group_member(_In_ sai_object_id_t next_
         return sdk_to_sai(status);
     }
 
-    status = mlnx_sdk_nhop_by_ecmp_id_get(sx_nhop_id, &next_hop_remove);
+    status = mlnx_nhop_get_by_ecmp_id(sx_nhop_id, &next_hop_remove);
     if (SAI_ERR(status)) {
         return status;
     }
@@ -51,10 +51,13 @@
 #undef  __MODULE__
 #define __MODULE__ SAI_POLICER
 
-#define policer_db_cl_plock_excl_acquire(lock) \
-    {SX_LOG_DBG("policer_db_cl_plock_excl_acquire\n"); \
-     cl_plock_excl_acquire(lock); }
-#define policer_db_cl_plock_release(lock) {SX_LOG_DBG("policer_db_cl_plock_release\n"); cl_plock_release(lock); }
+#define policer_db_sai_db_read_lock() \
+    {SX_LOG_DBG("policer_db_sai_db_read_lock\n"); \
+     sai_db_read_lock(); }
+#define policer_db_sai_db_write_lock() \
+    {SX_LOG_DBG("policer_db_sai_db_write_lock\n"); \
+     sai_db_write_lock(); }
+#define policer_db_sai_db_unlock() {SX_LOG_DBG("policer_db_sai_db_unlock\n"); sai_db_unlock(); }
 #define IR_UNITS 1000
 
 sai_status_t mlnx_sai_unbind_policer_from_trap_group(_In_ sai_object_id_t sai_object_id);
@@ -193,6 +196,17 @@ sai_status_t db_init_sai_policer_data(_In_ sx_policer_attributes_t* policer_attr
 static sai_status_t db_remove_sai_policer_data(_In_ uint32_t db_policers_entry_index);
 static sai_status_t db_write_sai_policer_attribs(_In_ sai_object_id_t          sai_policer_id,
                                                  _In_ sx_policer_attributes_t* sx_policer_attribs);
+static uint32_t mlnx_policer_port_binding_next(_In_ const mlnx_policer_db_entry_t *policer_entry,
+                                               _In_ sai_object_id_t                sai_policer,
+                                               _In_ uint32_t                       bit,
+                                               _Out_ mlnx_port_config_t          **port_config,
+                                               _Out_ mlnx_port_policer_type       *port_policer_type);
+
+#define mlnx_policer_port_bindings_foreach(policer_entry, sai_policer, bit, port, type) \
+    for (bit = mlnx_policer_port_binding_next(policer_entry, sai_policer, 0, &port, &type); \
+         bit < MLNX_POLICER_PORT_BINDINGS_MAX; \
+         bit = mlnx_policer_port_binding_next(policer_entry, sai_policer, bit + 1, &port, &type))
+
 static const sai_vendor_attribute_entry_t policer_vendor_attribs[] = {
     {
         SAI_POLICER_ATTR_METER_TYPE,
@@ -386,7 +400,7 @@ static sai_status_t sai_policer_get_sx_attribs_internal(_In_ const sai_object_ke
     }
 
     if (lock_db_access) {
-        policer_db_cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+        policer_db_sai_db_write_lock();
     }
 
     if (SAI_STATUS_SUCCESS !=
@@ -398,7 +412,7 @@ static sai_status_t sai_policer_get_sx_attribs_internal(_In_ const sai_object_ke
     }
 
     if (lock_db_access) {
-        policer_db_cl_plock_release(&g_sai_db_ptr->p_lock);
+        policer_db_sai_db_unlock();
     }
 
     SX_LOG_EXIT();
@@ -824,12 +838,11 @@ static sai_status_t sai_policer_commit_changes_to_port_bindings(sai_object_id_t
 {
     sai_status_t                   sai_status;
     sx_status_t                    sx_status;
-    mlnx_port_config_t            *port_config;
-    mlnx_policer_db_entry_t      * policer_entry     = NULL;
-    uint32_t                       storm_control_ind = 0;
+    mlnx_port_config_t            *port_config   = NULL;
+    mlnx_policer_db_entry_t      * policer_entry = NULL;
+    mlnx_port_policer_type         storm_control_ind;
     sx_port_storm_control_params_t storm_ctrl_params;
-    uint32_t                       port_ind;
-    uint32_t                       ii;
+    uint32_t                       binding;
 
     SX_LOG_ENTER();
     if (SAI_STATUS_SUCCESS != (sai_status = db_get_sai_policer_data(sai_policer, &policer_entry))) {
@@ -837,38 +850,34 @@ static sai_status_t sai_policer_commit_changes_to_port_bindings(sai_object_id_t
         return sai_status;
     }
 
-    mlnx_port_foreach(port_config, port_ind) {
-        for (ii = 0; ii < MLNX_PORT_POLICER_TYPE_MAX; ii++) {
-            memset(&storm_ctrl_params, 0, sizeof(storm_ctrl_params));
-            if (sai_policer == port_config->port_policers[ii]) {
-                if (SAI_STATUS_SUCCESS !=
-                    (sai_status =
-                         sai_policer_get_packet_flags_for_policer_type(ii, port_config,
-                                                                       &storm_ctrl_params.packet_types))) {
-                    SX_LOG_EXIT();
-                    return sai_status;
-                }
-                storm_ctrl_params.policer_params = policer_entry->sx_policer_attr;
-                /* We are using the oritinal policer settings saved in the DB.
-                 *  But need to set this flag to false for storm policer API to work.*/
-                storm_ctrl_params.policer_params.is_host_ifc_policer = false;
-                if (SX_STATUS_SUCCESS !=
-                    (sx_status =
-                         storm_policer_functions.sx_api_port_storm_control_set_p(
-                             gh_sdk,
-                             SX_ACCESS_CMD_EDIT,
-                             port_config->logical,
-                             storm_control_ind, &storm_ctrl_params))) {
-                    SX_LOG_ERR(
-                        "Failed to commit policer port storm_binding[%d] changes. sdk message:%s. saipolicer:0x%" PRIx64 "\n",
-                        storm_control_ind,
-                        SX_STATUS_MSG(sx_status),
-                        sai_policer);
-                    SX_LOG_EXIT();
-                    sai_status = sdk_to_sai(sx_status);
-                    return sai_status;
-                }
-            }
+    mlnx_policer_port_bindings_foreach(policer_entry, sai_policer, binding, port_config, storm_control_ind) {
+        memset(&storm_ctrl_params, 0, sizeof(storm_ctrl_params));
+        if (SAI_STATUS_SUCCESS !=
+            (sai_status =
+                 sai_policer_get_packet_flags_for_policer_type(storm_control_ind, port_config,
+                                                               &storm_ctrl_params.packet_types))) {
+            SX_LOG_EXIT();
+            return sai_status;
+        }
+        storm_ctrl_params.policer_params = policer_entry->sx_policer_attr;
+        /* We are using the oritinal policer settings saved in the DB.
+         *  But need to set this flag to false for storm policer API to work.*/
+        storm_ctrl_params.policer_params.is_host_ifc_policer = false;
+        if (SX_STATUS_SUCCESS !=
+            (sx_status =
+                 storm_policer_functions.sx_api_port_storm_control_set_p(
+                     gh_sdk,
+                     SX_ACCESS_CMD_EDIT,
+                     port_config->logical,
+                     storm_control_ind, &storm_ctrl_params))) {
+            SX_LOG_ERR(
+                "Failed to commit policer port storm_binding[%d] changes. sdk message:%s. saipolicer:0x%" PRIx64 "\n",
+                storm_control_ind,
+                SX_STATUS_MSG(sx_status),
+                sai_policer);
+            SX_LOG_EXIT();
+            sai_status = sdk_to_sai(sx_status);
+            return sai_status;
         }
     }
 
@@ -956,19 +965,19 @@ static sai_status_t sai_policer_attr_set(_In_ const sai_object_key_t* key,
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    policer_db_cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    policer_db_sai_db_write_lock();
 
     if (SAI_STATUS_SUCCESS !=
         (sai_status = sai_policer_get_sx_attribs_internal(key, &sx_policer_attribs, false))) {
         SX_LOG_ERR("Failed to obtain attribute value.\n");
-        policer_db_cl_plock_release(&g_sai_db_ptr->p_lock);
+        policer_db_sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
 
     if (SAI_STATUS_SUCCESS !=
         (sai_status = fill_policer_data(false, 1, &sai_attr, &sx_policer_attribs))) {
-        policer_db_cl_plock_release(&g_sai_db_ptr->p_lock);
+        policer_db_sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
@@ -977,7 +986,7 @@ static sai_status_t sai_policer_attr_set(_In_ const sai_object_key_t* key,
         (sai_status = db_write_sai_policer_attribs(key->key.object_id, &(sx_policer_attribs)))) {
         SX_LOG_ERR("Failed to change attribute for policer:0x%" PRIx64 ", attribute: %s.\n", key->key.object_id,
                    attr_name);
-        policer_db_cl_plock_release(&g_sai_db_ptr->p_lock);
+        policer_db_sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
@@ -986,13 +995,13 @@ static sai_status_t sai_policer_attr_set(_In_ const sai_object_key_t* key,
         SX_LOG_ERR("Failed to commiting policer changes for sai_policer:0x%" PRIx64 ", attribute: %s.\n",
                    key->key.object_id,
                    attr_name);
-        policer_db_cl_plock_release(&g_sai_db_ptr->p_lock);
+        policer_db_sai_db_unlock();
         SX_LOG_EXIT();
         return sai_status;
     }
 
-    msync(g_sai_db_ptr, sizeof(*g_sai_db_ptr), MS_SYNC);
-    policer_db_cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_sync_async();
+    policer_db_sai_db_unlock();
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
@@ -1804,6 +1813,7 @@ static sai_status_t db_write_sai_policer_attribs(_In_ sai_object_id_t          s
 
     g_sai_db_ptr->policers_db[db_policers_entry_index].sx_policer_attr          = *sx_policer_attr;
     g_sai_db_ptr->policers_db[db_policers_entry_index].sx_policer_attr.ir_units = SX_POLICER_IR_UNITS_10_POWER_3_E;
+    sai_db_field_dirty_mark(policers_db[db_policers_entry_index]);
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
@@ -1817,9 +1827,81 @@ void db_reset_policer_entry(_In_ uint32_t db_policers_entry_index)
     g_sai_db_ptr->policers_db[db_policers_entry_index].sx_policer_id_acl  = SX_POLICER_ID_INVALID;
     memset(&(g_sai_db_ptr->policers_db[db_policers_entry_index].sx_policer_attr), 0,
            sizeof(g_sai_db_ptr->policers_db[db_policers_entry_index].sx_policer_attr));
+    memset(g_sai_db_ptr->policers_db[db_policers_entry_index].port_bindings, 0,
+           sizeof(g_sai_db_ptr->policers_db[db_policers_entry_index].port_bindings));
+    g_sai_db_ptr->policers_db[db_policers_entry_index].port_bindings_count = 0;
     SX_LOG_EXIT();
 }
 
+/*
+ *  Keeps the policer to port storm slot index in sync with mlnx_port_config_t::port_policers[].
+ *  SAI DB write lock is required.
+ */
+void mlnx_policer_port_binding_update(_In_ sai_object_id_t           sai_policer,
+                                      _In_ const mlnx_port_config_t *port_config,
+                                      _In_ mlnx_port_policer_type    port_policer_type,
+                                      _In_ bool                      is_bound)
+{
+    mlnx_policer_db_entry_t *policer_entry = NULL;
+    uint32_t                 bit;
+
+    assert(port_config);
+    assert(port_policer_type < MLNX_PORT_POLICER_TYPE_MAX);
+
+    if (SAI_NULL_OBJECT_ID == sai_policer) {
+        return;
+    }
+
+    if (SAI_STATUS_SUCCESS != db_get_sai_policer_data(sai_policer, &policer_entry)) {
+        return;
+    }
+
+    bit = port_config->index * MLNX_PORT_POLICER_TYPE_MAX + port_policer_type;
+    assert(bit < MLNX_POLICER_PORT_BINDINGS_MAX);
+
+    if (is_bound == (bool)array_bit_test(policer_entry->port_bindings, bit)) {
+        return;
+    }
+
+    if (is_bound) {
+        array_bit_set(policer_entry->port_bindings, bit);
+        policer_entry->port_bindings_count++;
+    } else {
+        array_bit_clear(policer_entry->port_bindings, bit);
+        policer_entry->port_bindings_count--;
+    }
+
+    sai_db_dirty_mark(policer_entry, sizeof(*policer_entry));
+}
+
+/*
+ *  Next port storm slot bound to the policer, MLNX_POLICER_PORT_BINDINGS_MAX when there are no more.
+ *  Slots whose port no longer references the policer are skipped.
+ */
+static uint32_t mlnx_policer_port_binding_next(_In_ const mlnx_policer_db_entry_t *policer_entry,
+                                               _In_ sai_object_id_t                sai_policer,
+                                               _In_ uint32_t                       bit,
+                                               _Out_ mlnx_port_config_t          **port_config,
+                                               _Out_ mlnx_port_policer_type       *port_policer_type)
+{
+    mlnx_port_config_t *port;
+
+    for (bit = mlnx_bitmap_next_set(policer_entry->port_bindings, MLNX_POLICER_PORT_BINDINGS_MAX, bit);
+         bit < MLNX_POLICER_PORT_BINDINGS_MAX;
+         bit = mlnx_bitmap_next_set(policer_entry->port_bindings, MLNX_POLICER_PORT_BINDINGS_MAX, bit + 1)) {
+        port = &mlnx_ports_db[bit / MLNX_PORT_POLICER_TYPE_MAX];
+
+        if (port->is_present && port->logical &&
+            (sai_policer == port->port_policers[bit % MLNX_PORT_POLICER_TYPE_MAX])) {
+            *port_config       = port;
+            *port_policer_type = bit % MLNX_PORT_POLICER_TYPE_MAX;
+            return bit;
+        }
+    }
+
+    return MLNX_POLICER_PORT_BINDINGS_MAX;
+}
+
 sai_status_t db_init_sai_policer_data(_In_ sx_policer_attributes_t* policer_attr,
                                       _Out_ uint32_t              * db_policers_entry_index_p)
 {
@@ -1839,7 +1921,7 @@ sai_status_t db_init_sai_policer_data(_In_ sx_policer_attributes_t* policer_attr
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    policer_db_cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    policer_db_sai_db_write_lock();
 
     for (ii = 0; ii < MAX_POLICERS; ii++) {
         if (false == g_sai_db_ptr->policers_db[ii].valid) {
@@ -1849,7 +1931,7 @@ sai_status_t db_init_sai_policer_data(_In_ sx_policer_attributes_t* policer_attr
 
     if (MAX_POLICERS == ii) {
         SX_LOG_ERR("Policers table full\n");
-        policer_db_cl_plock_release(&g_sai_db_ptr->p_lock);
+        policer_db_sai_db_unlock();
         SX_LOG_EXIT();
         return SAI_STATUS_TABLE_FULL;
     }
@@ -1860,8 +1942,9 @@ sai_status_t db_init_sai_policer_data(_In_ sx_policer_attributes_t* policer_attr
     g_sai_db_ptr->policers_db[ii].sx_policer_attr.ir_units = SX_POLICER_IR_UNITS_10_POWER_3_E;
     g_sai_db_ptr->policers_db[ii].sx_policer_attr          = *policer_attr;
 
-    msync(g_sai_db_ptr, sizeof(*g_sai_db_ptr), MS_SYNC);
-    policer_db_cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_field_dirty_mark(policers_db[ii]);
+    sai_db_sync_async();
+    policer_db_sai_db_unlock();
 
     *db_policers_entry_index_p = ii;
 
@@ -1985,9 +2068,10 @@ static sai_status_t mlnx_sai_create_policer(_Out_ sai_object_id_t      *policer_
 
 static sai_status_t mlnx_validate_port_policer_for_remove(_In_ sai_object_id_t sai_policer)
 {
-    uint32_t                 port_ind, ii;
+    uint32_t                 binding;
     sai_status_t             status;
-    mlnx_port_config_t      *port_config;
+    mlnx_port_config_t      *port_config     = NULL;
+    mlnx_port_policer_type   policer_type;
     mlnx_policer_db_entry_t* policer_db_data = NULL;
 
     SX_LOG_ENTER();
@@ -2002,12 +2086,16 @@ static sai_status_t mlnx_validate_port_policer_for_remove(_In_ sai_object_id_t s
         return status;
     }
 
-    mlnx_port_foreach(port_config, port_ind) {
-        for (ii = 0; ii < MLNX_PORT_POLICER_TYPE_MAX; ii++) {
-            if (sai_policer == port_config->port_policers[ii]) {
-                return SAI_STATUS_OBJECT_IN_USE;
-            }
-        }
+    if (0 == policer_db_data->port_bindings_count) {
+        SX_LOG_EXIT();
+        return SAI_STATUS_SUCCESS;
+    }
+
+    mlnx_policer_port_bindings_foreach(policer_db_data, sai_policer, binding, port_config, policer_type) {
+        SX_LOG_ERR("Policer:0x%" PRIx64 " is bound to port_db[%d] policer type:%d\n",
+                   sai_policer, port_config->index, policer_type);
+        SX_LOG_EXIT();
+        return SAI_STATUS_OBJECT_IN_USE;
     }
 
     SX_LOG_EXIT();
@@ -2038,7 +2126,7 @@ static sai_status_t mlnx_sai_remove_policer(_In_ sai_object_id_t sai_policer_id)
     policer_key_to_str(sai_policer_id, key_str);
     SX_LOG_NTC("Removing policer %s,:0x%" PRIx64 "\n", key_str, sai_policer_id);
 
-    policer_db_cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    policer_db_sai_db_write_lock();
 
     if (SAI_STATUS_SUCCESS != (sai_status = db_get_sai_policer_data(sai_policer_id, &policer_db_data))) {
         SX_LOG_ERR("Failed to obtain policer db data for sai policer:0x%" PRIx64 "\n", sai_policer_id);
@@ -2094,8 +2182,11 @@ static sai_status_t mlnx_sai_remove_policer(_In_ sai_object_id_t sai_policer_id)
     }
 
 exit:
-    msync(g_sai_db_ptr, sizeof(*g_sai_db_ptr), MS_SYNC);
-    policer_db_cl_plock_release(&g_sai_db_ptr->p_lock);
+    if (policer_db_data) {
+        sai_db_dirty_mark(policer_db_data, sizeof(*policer_db_data));
+    }
+    sai_db_sync_async();
+    policer_db_sai_db_unlock();
     SX_LOG_EXIT();
     return sai_status;
 }
@@ -2141,39 +2232,50 @@ static sai_status_t mlnx_do_policer_stats(_In_ sai_object_id_t           policer
 {
     sai_status_t                sai_status;
     sx_status_t                 sx_status;
-    mlnx_port_config_t         *port_config;
+    mlnx_port_config_t         *port_config   = NULL;
     mlnx_policer_db_entry_t   * policer_entry = NULL;
     sx_policer_counters_t       policer_counters;
     sx_policer_counters_clear_t policer_counters_clear;
-    uint32_t                    packet_type_ind;
+    mlnx_port_policer_type      packet_type_ind;
     uint64_t                    aggregated_counter = 0;
-    uint32_t                    port_ind;
+    uint32_t                    binding;
+    uint32_t                    ii;
 
     SX_LOG_ENTER();
     policer_counters_clear.clear_violation_counter = true;
-    if (number_of_counters != 1) {
-        SX_LOG_ERR("Only 1 counter is supported. policer:0x%" PRIx64 ".\n", policer_id);
-        sai_status = SAI_STATUS_INVALID_PARAMETER;
-        goto exit;
+    if (0 == number_of_counters) {
+        SX_LOG_ERR("0 number of counters array param. policer:0x%" PRIx64 ".\n", policer_id);
+        SX_LOG_EXIT();
+        return SAI_STATUS_INVALID_PARAMETER;
     }
     if (NULL == counter_ids) {
         SX_LOG_ERR("NULL counter_ids. policer:0x%" PRIx64 ".\n", policer_id);
-        sai_status = SAI_STATUS_INVALID_PARAMETER;
-        goto exit;
+        SX_LOG_EXIT();
+        return SAI_STATUS_INVALID_PARAMETER;
     }
-    /* SDK supports only dropped packets. */
-    if (SAI_POLICER_STAT_PACKETS != counter_ids[0]) {
-        SX_LOG_ERR("Only SAI_POLICER_STAT_PACKETS are supported. policer:0x%" PRIx64 ".\n", policer_id);
-        sai_status = SAI_STATUS_ATTR_NOT_SUPPORTED_0;
-        goto exit;
+    /* SDK counts only the packets dropped by the policer, these are the red packets.
+     * Green/yellow packets and byte counts are not exposed by the hardware. */
+    for (ii = 0; ii < number_of_counters; ii++) {
+        switch (counter_ids[ii]) {
+        case SAI_POLICER_STAT_PACKETS:
+        case SAI_POLICER_STAT_RED_PACKETS:
+            break;
+
+        default:
+            SX_LOG_ERR("Policer counter %d at index %u is not supported. policer:0x%" PRIx64 ".\n",
+                       counter_ids[ii], ii, policer_id);
+            SX_LOG_EXIT();
+            return SAI_STATUS_ATTR_NOT_SUPPORTED_0 + ii;
+        }
     }
     if ((!is_clear) && (NULL == counters)) {
         SX_LOG_ERR("NULL out counters array. policer:0x%" PRIx64 ".\n", policer_id);
-        sai_status = SAI_STATUS_INVALID_PARAMETER;
-        goto exit;
+        SX_LOG_EXIT();
+        return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    policer_db_cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    /* Counters are read and cleared in the SDK, the DB is only looked up */
+    policer_db_sai_db_read_lock();
     if (SAI_STATUS_SUCCESS != (sai_status = db_get_sai_policer_data(policer_id, &policer_entry))) {
         goto exit;
     }
@@ -2238,54 +2340,53 @@ static sai_status_t mlnx_do_policer_stats(_In_ sai_object_id_t           policer
         }
     }
 
-    mlnx_port_foreach(port_config, port_ind) {
-        for (packet_type_ind = 0; packet_type_ind < MLNX_PORT_POLICER_TYPE_MAX; packet_type_ind++) {
-            if (policer_id == port_config->port_policers[packet_type_ind]) {
-                if (is_clear) {
-                    if (SX_STATUS_SUCCESS != (sx_status =
-                                                  sx_api_port_storm_control_counters_clear_set(gh_sdk,
-                                                                                               port_config->logical,
-                                                                                               packet_type_ind,
-                                                                                               &policer_counters_clear)))
-                    {
-                        SX_LOG_ERR(
-                            "Failed to clear storm counters for policer:0x%" PRIx64 ", storm control id:%d, port_db ind:%d, log_port:%d, message:%s.\n",
-                            policer_id,
-                            packet_type_ind,
-                            port_config->index,
-                            port_config->logical,
-                            SX_STATUS_MSG(sx_status));
-                        sai_status = sdk_to_sai(sx_status);
-                        goto exit;
-                    }
-                } else {
-                    if (SX_STATUS_SUCCESS != (sx_status =
-                                                  sx_api_port_storm_control_counters_get(gh_sdk,
-                                                                                         port_config->logical,
-                                                                                         packet_type_ind,
-                                                                                         &policer_counters))) {
-                        SX_LOG_ERR(
-                            "Failed to obtain storm counters for policer:0x%" PRIx64 ", storm control id:%d, port_db ind:%d, log_port:%d, message:%s.\n",
-                            policer_id,
-                            packet_type_ind,
-                            port_config->index,
-                            port_config->logical,
-                            SX_STATUS_MSG(sx_status));
-                        sai_status = sdk_to_sai(sx_status);
-                        goto exit;
-                    }
-                    aggregated_counter += policer_counters.violation_counter;
-                }
+    mlnx_policer_port_bindings_foreach(policer_entry, policer_id, binding, port_config, packet_type_ind) {
+        if (is_clear) {
+            if (SX_STATUS_SUCCESS != (sx_status =
+                                          sx_api_port_storm_control_counters_clear_set(gh_sdk,
+                                                                                       port_config->logical,
+                                                                                       packet_type_ind,
+                                                                                       &policer_counters_clear)))
+            {
+                SX_LOG_ERR(
+                    "Failed to clear storm counters for policer:0x%" PRIx64 ", storm control id:%d, port_db ind:%d, log_port:%d, message:%s.\n",
+                    policer_id,
+                    packet_type_ind,
+                    port_config->index,
+                    port_config->logical,
+                    SX_STATUS_MSG(sx_status));
+                sai_status = sdk_to_sai(sx_status);
+                goto exit;
+            }
+        } else {
+            if (SX_STATUS_SUCCESS != (sx_status =
+                                          sx_api_port_storm_control_counters_get(gh_sdk,
+                                                                                 port_config->logical,
+                                                                                 packet_type_ind,
+                                                                                 &policer_counters))) {
+                SX_LOG_ERR(
+                    "Failed to obtain storm counters for policer:0x%" PRIx64 ", storm control id:%d, port_db ind:%d, log_port:%d, message:%s.\n",
+                    policer_id,
+                    packet_type_ind,
+                    port_config->index,
+                    port_config->logical,
+                    SX_STATUS_MSG(sx_status));
+                sai_status = sdk_to_sai(sx_status);
+                goto exit;
             }
+            aggregated_counter += policer_counters.violation_counter;
         }
     }
 
+    /* ACL, trap group and storm policers are gathered once, every requested counter is filled from them */
     if (!is_clear) {
-        counters[0] = aggregated_counter;
+        for (ii = 0; ii < number_of_counters; ii++) {
+            counters[ii] = aggregated_counter;
+        }
     }
 
 exit:
-    policer_db_cl_plock_release(&g_sai_db_ptr->p_lock);
+    policer_db_sai_db_unlock();
     SX_LOG_EXIT();
     return sai_status;
 }
@@ -2522,6 +2623,7 @@ static sai_status_t setup_storm_item(_In_ sai_object_id_t        sai_policer,
         return sai_status;
     }
     port_config->port_policers[port_policer_type] = sai_policer;
+    mlnx_policer_port_binding_update(sai_policer, port_config, port_policer_type, true);
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
@@ -2673,6 +2775,7 @@ sai_status_t mlnx_sai_unbind_policer_from_port(_In_ sai_object_id_t           sa
         return sai_status;
     }
     port_config->port_policers[bind_params->port_policer_type] = SAI_NULL_OBJECT_ID;
+    mlnx_policer_port_binding_update(sai_policer, port_config, bind_params->port_policer_type, false);
 
     /* Need to redistribute storm flags only when non-regular storm item is being removed. */
     if ((SAI_NULL_OBJECT_ID !=
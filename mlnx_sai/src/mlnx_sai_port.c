@@ -1539,9 +1539,9 @@ static sai_status_t mlnx_port_priority_group_list_get(_In_ const sai_object_key_
             sai_status = SAI_STATUS_NO_MEMORY;
             goto out;
         }
-        cl_plock_acquire(&g_sai_db_ptr->p_lock);
+        sai_db_read_lock();
         sai_status = mlnx_port_idx_by_obj_id(key->key.object_id, &db_port_index);
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         if (SAI_STATUS_SUCCESS != sai_status) {
             goto out;
         }
@@ -2539,6 +2539,8 @@ sai_status_t mlnx_port_samplepacket_params_clear(_In_ mlnx_port_config_t *port_c
     assert(port_config);
 
     if (is_soft) {
+        mlnx_samplepacket_port_ref_update(port_config->internal_ingress_samplepacket_obj_idx,
+                                          MLNX_INVALID_SAMPLEPACKET_SESSION, port_config);
         port_config->internal_ingress_samplepacket_obj_idx = MLNX_INVALID_SAMPLEPACKET_SESSION;
     } else {
         status = mlnx_port_samplepacket_session_set_internal(port_config, MLNX_INVALID_SAMPLEPACKET_SESSION);
@@ -2628,6 +2630,8 @@ static sai_status_t mlnx_port_samplepacket_session_set_internal(_In_ mlnx_port_c
         }
     }
 
+    mlnx_samplepacket_port_ref_update(port_config->internal_ingress_samplepacket_obj_idx,
+                                      samplepacket_obj_idx, port_config);
     port_config->internal_ingress_samplepacket_obj_idx = samplepacket_obj_idx;
 
     return SAI_STATUS_SUCCESS;
@@ -2829,7 +2833,10 @@ static sai_status_t db_port_qos_map_id_set(_In_ const sai_object_id_t port_id,
         return status;
     }
 
+    mlnx_qos_map_port_ref_update(port->qos_maps[qos_map_type], qos_map_id, port);
+
     port->qos_maps[qos_map_type] = qos_map_id;
+    sai_db_dirty_mark(&port->qos_maps[qos_map_type], sizeof(port->qos_maps[qos_map_type]));
     return SAI_STATUS_SUCCESS;
 }
 
@@ -3084,6 +3091,27 @@ static sai_status_t mlnx_port_qos_map_assign_tc_color_to_dot1p(sx_port_log_id_t
     return SAI_STATUS_SUCCESS;
 }
 
+/* Keep a copy of the PFC map for re-apply, the slot's port reverse index is preserved */
+static void mlnx_port_qos_map_pfc_save(uint32_t index, const mlnx_qos_map_t *qos_map)
+{
+    mlnx_qos_map_t *saved = &g_sai_db_ptr->qos_maps_db[index];
+    uint32_t        ports_map[MLNX_QOS_MAP_PORT_WORDS];
+    uint32_t        port_refs;
+
+    if (saved != qos_map) {
+        port_refs = saved->port_refs;
+        memcpy(ports_map, saved->ports_map, sizeof(ports_map));
+
+        memcpy(saved, qos_map, sizeof(*qos_map));
+
+        saved->port_refs = port_refs;
+        memcpy(saved->ports_map, ports_map, sizeof(ports_map));
+    }
+
+    saved->is_set = true;
+    sai_db_dirty_mark(saved, sizeof(*saved));
+}
+
 static sai_status_t mlnx_port_qos_map_assign_pfc_to_pg(sx_port_log_id_t port_id, mlnx_qos_map_t *qos_map)
 {
     sx_cos_port_prio_buff_t prio_buff;
@@ -3124,8 +3152,7 @@ static sai_status_t mlnx_port_qos_map_assign_pfc_to_pg(sx_port_log_id_t port_id,
         }
     }
 
-    memcpy(&g_sai_db_ptr->qos_maps_db[MLNX_QOS_MAP_PFC_PG_INDEX], qos_map, sizeof(*qos_map));
-    g_sai_db_ptr->qos_maps_db[MLNX_QOS_MAP_PFC_PG_INDEX].is_set = true;
+    mlnx_port_qos_map_pfc_save(MLNX_QOS_MAP_PFC_PG_INDEX, qos_map);
 
     return status;
 }
@@ -3166,8 +3193,7 @@ static sai_status_t mlnx_port_qos_map_assign_pfc_to_queue(sx_port_log_id_t port_
         }
     }
 
-    memcpy(&g_sai_db_ptr->qos_maps_db[MLNX_QOS_MAP_PFC_QUEUE_INDEX], qos_map, sizeof(*qos_map));
-    g_sai_db_ptr->qos_maps_db[MLNX_QOS_MAP_PFC_QUEUE_INDEX].is_set = true;
+    mlnx_port_qos_map_pfc_save(MLNX_QOS_MAP_PFC_QUEUE_INDEX, qos_map);
 
     return status;
 }
@@ -3369,6 +3395,49 @@ sai_status_t mlnx_port_qos_map_apply(_In_ const sai_object_id_t    port,
     return status;
 }
 
+/*
+ * Routine Description:
+ *   Push only the given (changed) QoS map entries to the port, the map must be
+ *   of a type whose entries are merged into the SDK one by one (db write lock is needed).
+ *
+ * Arguments:
+ *    [in] port - Port or LAG config
+ *    [in] delta - QoS map entries to apply
+ *
+ * Return Values:
+ *    SAI_STATUS_SUCCESS on success
+ *    Failure status code on error
+ */
+sai_status_t mlnx_port_qos_map_delta_apply(_In_ const mlnx_port_config_t *port, _In_ mlnx_qos_map_t *delta)
+{
+    if (!delta->count) {
+        return SAI_STATUS_SUCCESS;
+    }
+
+    switch (delta->type) {
+    case SAI_QOS_MAP_TYPE_DOT1P_TO_TC:
+    case SAI_QOS_MAP_TYPE_DOT1P_TO_COLOR:
+        return mlnx_port_qos_map_assign_dot1p_to_tc_color(port->logical, delta);
+
+    case SAI_QOS_MAP_TYPE_DSCP_TO_TC:
+    case SAI_QOS_MAP_TYPE_DSCP_TO_COLOR:
+        return mlnx_port_qos_map_assign_dscp_to_tc_color(port->logical, delta);
+
+    case SAI_QOS_MAP_TYPE_TC_TO_QUEUE:
+        return mlnx_port_qos_map_assign_tc_to_queue(port->logical, delta);
+
+    case SAI_QOS_MAP_TYPE_TC_AND_COLOR_TO_DSCP:
+        return mlnx_port_qos_map_assign_tc_color_to_dscp(port->logical, delta);
+
+    case SAI_QOS_MAP_TYPE_TC_AND_COLOR_TO_DOT1P:
+        return mlnx_port_qos_map_assign_tc_color_to_dot1p(port->logical, delta);
+
+    default:
+        SX_LOG_ERR("QoS map type (%u) can't be applied incrementally\n", delta->type);
+        return SAI_STATUS_NOT_SUPPORTED;
+    }
+}
+
 /*
  * Routine Description:
  *   Set default traffic class on the port
@@ -3455,7 +3524,7 @@ static sai_status_t mlnx_port_qos_map_id_set(_In_ const sai_object_key_t      *k
         goto out;
     }
 
-    sai_db_sync();
+    sai_db_sync_async();
 
 out:
     sai_db_unlock();
@@ -3909,465 +3978,763 @@ static sai_status_t mlnx_get_port_attribute(_In_ sai_object_id_t     port_id,
     return sai_status;
 }
 
-/*
- * Routine Description:
- *   Get port statistics counters.
- *
- * Arguments:
- *    [in] port_id - port id
- *    [in] number_of_counters - number of counters in the array
- *    [in] counter_ids - specifies the array of counter ids
- *    [out] counters - array of resulting counter values.
- *
- * Return Values:
- *    SAI_STATUS_SUCCESS on success
- *    Failure status code on error
- */
-static sai_status_t mlnx_get_port_stats(_In_ sai_object_id_t        port_id,
-                                        _In_ uint32_t               number_of_counters,
-                                        _In_ const sai_port_stat_t *counter_ids,
-                                        _Out_ uint64_t             *counters)
+/* Reads all the counters the port stats are served from, red_port is LAG logical id for LAG member */
+sai_status_t mlnx_port_counters_read(_In_ sx_api_handle_t        handle,
+                                     _In_ sx_port_log_id_t       log_port,
+                                     _In_ sx_port_log_id_t       red_port,
+                                     _In_ bool                   with_prio,
+                                     _Out_ mlnx_port_counters_t *counters)
 {
-    sai_status_t                  status;
-    sx_port_cntr_rfc_2863_t       cnts_2863;
-    sx_port_cntr_rfc_2819_t       cnts_2819;
-    sx_port_cntr_prio_t           cntr_prio;
-    sx_port_cntr_ieee_802_dot_3_t cntr_802;
-    sx_cos_redecn_port_counters_t redecn_cnts;
-    sx_port_cntr_discard_t        discard_cnts;
-    uint32_t                      ii, port_data;
-    mlnx_port_config_t           *port;
-    sx_port_log_id_t              red_port_id;
-    uint32_t                      iter = 0;
-    char                          key_str[MAX_KEY_STR_LEN];
-
-    SX_LOG_ENTER();
-
-    memset(&redecn_cnts, 0, sizeof(redecn_cnts));
-
-    port_key_to_str(port_id, key_str);
-    SX_LOG_DBG("Get port stats %s\n", key_str);
-
-    if (NULL == counter_ids) {
-        SX_LOG_ERR("NULL counter ids array param\n");
-        return SAI_STATUS_INVALID_PARAMETER;
-    }
-
-    if (NULL == counters) {
-        SX_LOG_ERR("NULL counters array param\n");
-        return SAI_STATUS_INVALID_PARAMETER;
-    }
+    sx_status_t status;
+    uint32_t    prio;
 
-    if (SAI_STATUS_SUCCESS != (status = mlnx_object_to_type(port_id, SAI_OBJECT_TYPE_PORT, &port_data, NULL))) {
-        return status;
-    }
+    memset(counters, 0, sizeof(*counters));
 
     if (SX_STATUS_SUCCESS !=
-        (status = sx_api_port_counter_rfc_2863_get(gh_sdk, SX_ACCESS_CMD_READ, port_data, &cnts_2863))) {
+        (status = MLNX_PERF_SDK_CALL(sx_api_port_counter_rfc_2863_get(handle, SX_ACCESS_CMD_READ, log_port,
+                                                                      &counters->cnts_2863)))) {
         SX_LOG_ERR("Failed to get port rfc 2863 counters - %s.\n", SX_STATUS_MSG(status));
         return sdk_to_sai(status);
     }
 
     if (SX_STATUS_SUCCESS !=
-        (status = sx_api_port_counter_rfc_2819_get(gh_sdk, SX_ACCESS_CMD_READ, port_data, &cnts_2819))) {
+        (status = MLNX_PERF_SDK_CALL(sx_api_port_counter_rfc_2819_get(handle, SX_ACCESS_CMD_READ, log_port,
+                                                                      &counters->cnts_2819)))) {
         SX_LOG_ERR("Failed to get port rfc 2819 counters - %s.\n", SX_STATUS_MSG(status));
         return sdk_to_sai(status);
     }
 
     if (SX_STATUS_SUCCESS !=
-        (status = sx_api_port_counter_ieee_802_dot_3_get(gh_sdk, SX_ACCESS_CMD_READ, port_data, &cntr_802))) {
+        (status = MLNX_PERF_SDK_CALL(sx_api_port_counter_ieee_802_dot_3_get(handle, SX_ACCESS_CMD_READ, log_port,
+                                                                            &counters->cntr_802)))) {
         SX_LOG_ERR("Failed to get port ieee 802 3 counters - %s.\n", SX_STATUS_MSG(status));
         return sdk_to_sai(status);
     }
 
     if (SX_STATUS_SUCCESS !=
-        (status = sx_api_port_counter_discard_get(gh_sdk, SX_ACCESS_CMD_READ, port_data, &discard_cnts))) {
+        (status = MLNX_PERF_SDK_CALL(sx_api_port_counter_discard_get(handle, SX_ACCESS_CMD_READ, log_port,
+                                                                     &counters->discard_cnts)))) {
         SX_LOG_ERR("Failed to get port discard counters - %s.\n", SX_STATUS_MSG(status));
         return sdk_to_sai(status);
     }
 
-    /* In case if port is LAG member then use LAG logical id for redecn counters */
-    sai_db_read_lock();
-    status = mlnx_port_by_log_id(port_data, &port);
-    if (SAI_ERR(status)) {
-        sai_db_unlock();
-        return status;
+    if (SX_STATUS_SUCCESS !=
+        (status = sx_api_cos_redecn_counters_get(handle, SX_ACCESS_CMD_READ, red_port, &counters->redecn_cnts))) {
+        SX_LOG_ERR("Failed to get port redecn counters - %s.\n", SX_STATUS_MSG(status));
+        return sdk_to_sai(status);
     }
-    if (mlnx_port_is_lag_member(port)) {
-        red_port_id = port->lag_id;
-    } else {
-        red_port_id = port_data;
+
+    if (!with_prio) {
+        return SAI_STATUS_SUCCESS;
+    }
+
+    for (prio = 0; prio < MLNX_PORT_COUNTERS_PRIO_NUM; prio++) {
+        if (SX_STATUS_SUCCESS !=
+            (status = sx_api_port_counter_prio_get(handle, SX_ACCESS_CMD_READ, log_port, SX_PORT_PRIO_ID_0 + prio,
+                                                   &counters->prio_cnts[prio]))) {
+            SX_LOG_ERR("Failed to get port prio %d counters - %s.\n", SX_PORT_PRIO_ID_0 + prio,
+                       SX_STATUS_MSG(status));
+            return sdk_to_sai(status);
+        }
+    }
+    counters->has_prio = true;
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static sai_status_t mlnx_port_prio_counters_get(_In_ sx_port_log_id_t            log_port,
+                                                _In_ uint32_t                    prio,
+                                                _In_ const mlnx_port_counters_t *port_cnts,
+                                                _Out_ sx_port_cntr_prio_t       *cntr_prio)
+{
+    sx_status_t status;
+
+    if (port_cnts->has_prio) {
+        *cntr_prio = port_cnts->prio_cnts[prio];
+        return SAI_STATUS_SUCCESS;
     }
-    sai_db_unlock();
 
     if (SX_STATUS_SUCCESS !=
-        (status = sx_api_cos_redecn_counters_get(gh_sdk, SX_ACCESS_CMD_READ, red_port_id, &redecn_cnts))) {
-        SX_LOG_ERR("Failed to get port redecn counters - %s.\n", SX_STATUS_MSG(status));
+        (status = MLNX_PERF_SDK_CALL(sx_api_port_counter_prio_get(gh_sdk, SX_ACCESS_CMD_READ, log_port,
+                                                                  SX_PORT_PRIO_ID_0 + prio, cntr_prio)))) {
+        SX_LOG_ERR("Failed to get port prio %d counters - %s.\n", SX_PORT_PRIO_ID_0 + prio, SX_STATUS_MSG(status));
         return sdk_to_sai(status);
     }
 
-    for (ii = 0; ii < number_of_counters; ii++) {
-        switch (counter_ids[ii]) {
-        case SAI_PORT_STAT_IF_IN_OCTETS:
-            counters[ii] = cnts_2863.if_in_octets;
-            break;
-
-        case SAI_PORT_STAT_IF_IN_UCAST_PKTS:
-            counters[ii] = cnts_2863.if_in_ucast_pkts;
-            break;
+    return SAI_STATUS_SUCCESS;
+}
 
-        case SAI_PORT_STAT_IF_IN_NON_UCAST_PKTS:
-            counters[ii] = cnts_2863.if_in_broadcast_pkts + cnts_2863.if_in_multicast_pkts;
-            break;
+/* Translates a SAI port counter from the SDK counters, the prio counters are read from SDK if not in port_cnts */
+static sai_status_t mlnx_port_stat_value_get(_In_ sx_port_log_id_t            port_data,
+                                             _In_ const mlnx_port_counters_t *port_cnts,
+                                             _In_ sai_port_stat_t             counter_id,
+                                             _Out_ uint64_t                  *value)
+{
+    sai_status_t        status;
+    sx_port_cntr_prio_t cntr_prio;
+    uint32_t            iter = 0;
 
-        case SAI_PORT_STAT_IF_IN_DISCARDS:
-            counters[ii] = cnts_2863.if_in_discards;
-            break;
+    switch (counter_id) {
+    case SAI_PORT_STAT_IF_IN_OCTETS:
+        *value = port_cnts->cnts_2863.if_in_octets;
+        break;
 
-        case SAI_PORT_STAT_IF_IN_ERRORS:
-            counters[ii] = cnts_2863.if_in_errors;
-            break;
+    case SAI_PORT_STAT_IF_IN_UCAST_PKTS:
+        *value = port_cnts->cnts_2863.if_in_ucast_pkts;
+        break;
 
-        case SAI_PORT_STAT_IF_IN_UNKNOWN_PROTOS:
-            counters[ii] = cnts_2863.if_in_unknown_protos;
-            break;
+    case SAI_PORT_STAT_IF_IN_NON_UCAST_PKTS:
+        *value = port_cnts->cnts_2863.if_in_broadcast_pkts + port_cnts->cnts_2863.if_in_multicast_pkts;
+        break;
 
-        case SAI_PORT_STAT_IF_IN_BROADCAST_PKTS:
-            counters[ii] = cnts_2863.if_in_broadcast_pkts;
-            break;
+    case SAI_PORT_STAT_IF_IN_DISCARDS:
+        *value = port_cnts->cnts_2863.if_in_discards;
+        break;
 
-        case SAI_PORT_STAT_IF_IN_MULTICAST_PKTS:
-            counters[ii] = cnts_2863.if_in_multicast_pkts;
-            break;
+    case SAI_PORT_STAT_IF_IN_ERRORS:
+        *value = port_cnts->cnts_2863.if_in_errors;
+        break;
 
-        case SAI_PORT_STAT_IF_OUT_OCTETS:
-            counters[ii] = cnts_2863.if_out_octets;
-            break;
+    case SAI_PORT_STAT_IF_IN_UNKNOWN_PROTOS:
+        *value = port_cnts->cnts_2863.if_in_unknown_protos;
+        break;
 
-        case SAI_PORT_STAT_IF_OUT_UCAST_PKTS:
-            counters[ii] = cnts_2863.if_out_ucast_pkts;
-            break;
+    case SAI_PORT_STAT_IF_IN_BROADCAST_PKTS:
+        *value = port_cnts->cnts_2863.if_in_broadcast_pkts;
+        break;
 
-        case SAI_PORT_STAT_IF_OUT_NON_UCAST_PKTS:
-            counters[ii] = cnts_2863.if_out_broadcast_pkts + cnts_2863.if_out_multicast_pkts;
-            break;
+    case SAI_PORT_STAT_IF_IN_MULTICAST_PKTS:
+        *value = port_cnts->cnts_2863.if_in_multicast_pkts;
+        break;
 
-        case SAI_PORT_STAT_IF_OUT_DISCARDS:
-            counters[ii] = cnts_2863.if_out_discards;
-            break;
+    case SAI_PORT_STAT_IF_OUT_OCTETS:
+        *value = port_cnts->cnts_2863.if_out_octets;
+        break;
 
-        case SAI_PORT_STAT_IF_OUT_ERRORS:
-            counters[ii] = cnts_2863.if_out_errors;
-            break;
+    case SAI_PORT_STAT_IF_OUT_UCAST_PKTS:
+        *value = port_cnts->cnts_2863.if_out_ucast_pkts;
+        break;
 
-        case SAI_PORT_STAT_IF_OUT_BROADCAST_PKTS:
-            counters[ii] = cnts_2863.if_out_broadcast_pkts;
-            break;
+    case SAI_PORT_STAT_IF_OUT_NON_UCAST_PKTS:
+        *value = port_cnts->cnts_2863.if_out_broadcast_pkts + port_cnts->cnts_2863.if_out_multicast_pkts;
+        break;
 
-        case SAI_PORT_STAT_IF_OUT_MULTICAST_PKTS:
-            counters[ii] = cnts_2863.if_out_multicast_pkts;
-            break;
+    case SAI_PORT_STAT_IF_OUT_DISCARDS:
+        *value = port_cnts->cnts_2863.if_out_discards;
+        break;
 
-        case SAI_PORT_STAT_ETHER_STATS_DROP_EVENTS:
-            counters[ii] = cnts_2819.ether_stats_drop_events;
-            break;
+    case SAI_PORT_STAT_IF_OUT_ERRORS:
+        *value = port_cnts->cnts_2863.if_out_errors;
+        break;
 
-        case SAI_PORT_STAT_ETHER_STATS_MULTICAST_PKTS:
-            counters[ii] = cnts_2819.ether_stats_multicast_pkts;
-            break;
+    case SAI_PORT_STAT_IF_OUT_BROADCAST_PKTS:
+        *value = port_cnts->cnts_2863.if_out_broadcast_pkts;
+        break;
 
-        case SAI_PORT_STAT_ETHER_STATS_BROADCAST_PKTS:
-            counters[ii] = cnts_2819.ether_stats_broadcast_pkts;
-            break;
+    case SAI_PORT_STAT_IF_OUT_MULTICAST_PKTS:
+        *value = port_cnts->cnts_2863.if_out_multicast_pkts;
+        break;
 
-        case SAI_PORT_STAT_ETHER_STATS_UNDERSIZE_PKTS:
-            counters[ii] = cnts_2819.ether_stats_undersize_pkts;
-            break;
+    case SAI_PORT_STAT_ETHER_STATS_DROP_EVENTS:
+        *value = port_cnts->cnts_2819.ether_stats_drop_events;
+        break;
 
-        case SAI_PORT_STAT_ETHER_STATS_FRAGMENTS:
-            counters[ii] = cnts_2819.ether_stats_fragments;
-            break;
+    case SAI_PORT_STAT_ETHER_STATS_MULTICAST_PKTS:
+        *value = port_cnts->cnts_2819.ether_stats_multicast_pkts;
+        break;
 
-        case SAI_PORT_STAT_ETHER_STATS_PKTS_64_OCTETS:
-            counters[ii] = cnts_2819.ether_stats_pkts64octets;
-            break;
+    case SAI_PORT_STAT_ETHER_STATS_BROADCAST_PKTS:
+        *value = port_cnts->cnts_2819.ether_stats_broadcast_pkts;
+        break;
 
-        case SAI_PORT_STAT_ETHER_STATS_PKTS_65_TO_127_OCTETS:
-            counters[ii] = cnts_2819.ether_stats_pkts65to127octets;
-            break;
+    case SAI_PORT_STAT_ETHER_STATS_UNDERSIZE_PKTS:
+        *value = port_cnts->cnts_2819.ether_stats_undersize_pkts;
+        break;
 
-        case SAI_PORT_STAT_ETHER_STATS_PKTS_128_TO_255_OCTETS:
-            counters[ii] = cnts_2819.ether_stats_pkts128to255octets;
-            break;
+    case SAI_PORT_STAT_ETHER_STATS_FRAGMENTS:
+        *value = port_cnts->cnts_2819.ether_stats_fragments;
+        break;
 
-        case SAI_PORT_STAT_ETHER_STATS_PKTS_256_TO_511_OCTETS:
-            counters[ii] = cnts_2819.ether_stats_pkts256to511octets;
-            break;
+    case SAI_PORT_STAT_ETHER_STATS_PKTS_64_OCTETS:
+        *value = port_cnts->cnts_2819.ether_stats_pkts64octets;
+        break;
 
-        case SAI_PORT_STAT_ETHER_STATS_PKTS_512_TO_1023_OCTETS:
-            counters[ii] = cnts_2819.ether_stats_pkts512to1023octets;
-            break;
+    case SAI_PORT_STAT_ETHER_STATS_PKTS_65_TO_127_OCTETS:
+        *value = port_cnts->cnts_2819.ether_stats_pkts65to127octets;
+        break;
 
-        case SAI_PORT_STAT_ETHER_STATS_PKTS_1024_TO_1518_OCTETS:
-            counters[ii] = cnts_2819.ether_stats_pkts1024to1518octets;
-            break;
+    case SAI_PORT_STAT_ETHER_STATS_PKTS_128_TO_255_OCTETS:
+        *value = port_cnts->cnts_2819.ether_stats_pkts128to255octets;
+        break;
 
-        case SAI_PORT_STAT_ETHER_STATS_PKTS_1519_TO_2047_OCTETS:
-            counters[ii] = cnts_2819.ether_stats_pkts1519to2047octets;
-            break;
+    case SAI_PORT_STAT_ETHER_STATS_PKTS_256_TO_511_OCTETS:
+        *value = port_cnts->cnts_2819.ether_stats_pkts256to511octets;
+        break;
 
-        case SAI_PORT_STAT_ETHER_STATS_PKTS_2048_TO_4095_OCTETS:
-            counters[ii] = cnts_2819.ether_stats_pkts2048to4095octets;
-            break;
+    case SAI_PORT_STAT_ETHER_STATS_PKTS_512_TO_1023_OCTETS:
+        *value = port_cnts->cnts_2819.ether_stats_pkts512to1023octets;
+        break;
 
-        case SAI_PORT_STAT_ETHER_STATS_OVERSIZE_PKTS:
-            counters[ii] = cnts_2819.ether_stats_oversize_pkts;
-            break;
+    case SAI_PORT_STAT_ETHER_STATS_PKTS_1024_TO_1518_OCTETS:
+        *value = port_cnts->cnts_2819.ether_stats_pkts1024to1518octets;
+        break;
 
-        case SAI_PORT_STAT_ETHER_STATS_JABBERS:
-            counters[ii] = cnts_2819.ether_stats_jabbers;
-            break;
+    case SAI_PORT_STAT_ETHER_STATS_PKTS_1519_TO_2047_OCTETS:
+        *value = port_cnts->cnts_2819.ether_stats_pkts1519to2047octets;
+        break;
 
-        case SAI_PORT_STAT_ETHER_STATS_OCTETS:
-            counters[ii] = cnts_2819.ether_stats_octets;
-            break;
+    case SAI_PORT_STAT_ETHER_STATS_PKTS_2048_TO_4095_OCTETS:
+        *value = port_cnts->cnts_2819.ether_stats_pkts2048to4095octets;
+        break;
 
-        case SAI_PORT_STAT_ETHER_STATS_PKTS:
-            counters[ii] = cnts_2819.ether_stats_pkts;
-            break;
+    case SAI_PORT_STAT_ETHER_STATS_OVERSIZE_PKTS:
+        *value = port_cnts->cnts_2819.ether_stats_oversize_pkts;
+        break;
 
-        case SAI_PORT_STAT_ETHER_STATS_COLLISIONS:
-            counters[ii] = cnts_2819.ether_stats_collisions;
-            break;
+    case SAI_PORT_STAT_ETHER_STATS_JABBERS:
+        *value = port_cnts->cnts_2819.ether_stats_jabbers;
+        break;
 
-        case SAI_PORT_STAT_ETHER_STATS_CRC_ALIGN_ERRORS:
-            counters[ii] = cnts_2819.ether_stats_crc_align_errors;
-            break;
+    case SAI_PORT_STAT_ETHER_STATS_OCTETS:
+        *value = port_cnts->cnts_2819.ether_stats_octets;
+        break;
 
-        case SAI_PORT_STAT_ETHER_STATS_TX_NO_ERRORS:
-            counters[ii] = cntr_802.a_frames_transmitted_ok;
-            break;
+    case SAI_PORT_STAT_ETHER_STATS_PKTS:
+        *value = port_cnts->cnts_2819.ether_stats_pkts;
+        break;
 
-        case SAI_PORT_STAT_ETHER_STATS_RX_NO_ERRORS:
-            counters[ii] = cntr_802.a_frames_received_ok;
-            break;
+    case SAI_PORT_STAT_ETHER_STATS_COLLISIONS:
+        *value = port_cnts->cnts_2819.ether_stats_collisions;
+        break;
 
-        case SAI_PORT_STAT_PAUSE_RX_PKTS:
-            counters[ii] = cntr_802.a_pause_mac_ctrl_frames_received;
-            break;
+    case SAI_PORT_STAT_ETHER_STATS_CRC_ALIGN_ERRORS:
+        *value = port_cnts->cnts_2819.ether_stats_crc_align_errors;
+        break;
 
-        case SAI_PORT_STAT_PAUSE_TX_PKTS:
-            counters[ii] = cntr_802.a_pause_mac_ctrl_frames_transmitted;
-            break;
+    case SAI_PORT_STAT_ETHER_STATS_TX_NO_ERRORS:
+        *value = port_cnts->cntr_802.a_frames_transmitted_ok;
+        break;
 
-        case SAI_PORT_STAT_GREEN_DISCARD_DROPPED_PACKETS:
-        case SAI_PORT_STAT_GREEN_DISCARD_DROPPED_BYTES:
-        case SAI_PORT_STAT_YELLOW_DISCARD_DROPPED_PACKETS:
-        case SAI_PORT_STAT_YELLOW_DISCARD_DROPPED_BYTES:
-        case SAI_PORT_STAT_RED_DISCARD_DROPPED_PACKETS:
-        case SAI_PORT_STAT_RED_DISCARD_DROPPED_BYTES:
-        case SAI_PORT_STAT_DISCARD_DROPPED_BYTES:
-            SX_LOG_ERR("Port counter %d set item %u not supported\n", counter_ids[ii], ii);
-            return SAI_STATUS_ATTR_NOT_SUPPORTED_0;
-
-        case SAI_PORT_STAT_DISCARD_DROPPED_PACKETS:
-            counters[ii] = 0;
-            /* TODO : change to  g_resource_limits.cos_port_ets_traffic_class_max + 1 when sdk is updated to use rm */
-            for (iter = 0; iter < RM_API_COS_TRAFFIC_CLASS_NUM; iter++) {
-                counters[ii] += redecn_cnts.tc_red_dropped_packets[iter];
-            }
-            break;
+    case SAI_PORT_STAT_ETHER_STATS_RX_NO_ERRORS:
+        *value = port_cnts->cntr_802.a_frames_received_ok;
+        break;
 
-        case SAI_PORT_STAT_ECN_MARKED_PACKETS:
-            counters[ii] = redecn_cnts.ecn_marked_packets;
-            break;
+    case SAI_PORT_STAT_PAUSE_RX_PKTS:
+        *value = port_cnts->cntr_802.a_pause_mac_ctrl_frames_received;
+        break;
 
-        case SAI_PORT_STAT_PFC_0_RX_PKTS:
-        case SAI_PORT_STAT_PFC_1_RX_PKTS:
-        case SAI_PORT_STAT_PFC_2_RX_PKTS:
-        case SAI_PORT_STAT_PFC_3_RX_PKTS:
-        case SAI_PORT_STAT_PFC_4_RX_PKTS:
-        case SAI_PORT_STAT_PFC_5_RX_PKTS:
-        case SAI_PORT_STAT_PFC_6_RX_PKTS:
-        case SAI_PORT_STAT_PFC_7_RX_PKTS:
-            if (SX_STATUS_SUCCESS !=
-                (status = sx_api_port_counter_prio_get(gh_sdk, SX_ACCESS_CMD_READ, port_data,
-                                                       /* Extract Prio i from SAI RXi,TXi */
-                                                       SX_PORT_PRIO_ID_0 +
-                                                       (counter_ids[ii] - SAI_PORT_STAT_PFC_0_RX_PKTS) / 2,
-                                                       &cntr_prio))) {
-                SX_LOG_ERR("Failed to get port prio %d counters - %s.\n",
-                           SX_PORT_PRIO_ID_0 + (counter_ids[ii] - SAI_PORT_STAT_PFC_0_RX_PKTS) / 2,
-                           SX_STATUS_MSG(status));
-                return sdk_to_sai(status);
-            }
-            counters[ii] = cntr_prio.rx_pause;
-            break;
+    case SAI_PORT_STAT_PAUSE_TX_PKTS:
+        *value = port_cnts->cntr_802.a_pause_mac_ctrl_frames_transmitted;
+        break;
 
-        case SAI_PORT_STAT_PFC_0_TX_PKTS:
-        case SAI_PORT_STAT_PFC_1_TX_PKTS:
-        case SAI_PORT_STAT_PFC_2_TX_PKTS:
-        case SAI_PORT_STAT_PFC_3_TX_PKTS:
-        case SAI_PORT_STAT_PFC_4_TX_PKTS:
-        case SAI_PORT_STAT_PFC_5_TX_PKTS:
-        case SAI_PORT_STAT_PFC_6_TX_PKTS:
-        case SAI_PORT_STAT_PFC_7_TX_PKTS:
-            if (SX_STATUS_SUCCESS !=
-                (status = sx_api_port_counter_prio_get(gh_sdk, SX_ACCESS_CMD_READ, port_data,
-                                                       SX_PORT_PRIO_ID_0 +
-                                                       (counter_ids[ii] - SAI_PORT_STAT_PFC_0_TX_PKTS) / 2,
-                                                       &cntr_prio))) {
-                SX_LOG_ERR("Failed to get port prio %d counters - %s.\n",
-                           SX_PORT_PRIO_ID_0 + (counter_ids[ii] - SAI_PORT_STAT_PFC_0_TX_PKTS) / 2,
-                           SX_STATUS_MSG(status));
-                return sdk_to_sai(status);
-            }
-            counters[ii] = cntr_prio.tx_pause;
-            break;
+    case SAI_PORT_STAT_GREEN_DISCARD_DROPPED_PACKETS:
+    case SAI_PORT_STAT_GREEN_DISCARD_DROPPED_BYTES:
+    case SAI_PORT_STAT_YELLOW_DISCARD_DROPPED_PACKETS:
+    case SAI_PORT_STAT_YELLOW_DISCARD_DROPPED_BYTES:
+    case SAI_PORT_STAT_RED_DISCARD_DROPPED_PACKETS:
+    case SAI_PORT_STAT_RED_DISCARD_DROPPED_BYTES:
+    case SAI_PORT_STAT_DISCARD_DROPPED_BYTES:
+        return SAI_STATUS_ATTR_NOT_SUPPORTED_0;
+
+    case SAI_PORT_STAT_DISCARD_DROPPED_PACKETS:
+        *value = 0;
+        /* TODO : change to  g_resource_limits.cos_port_ets_traffic_class_max + 1 when sdk is updated to use rm */
+        for (iter = 0; iter < RM_API_COS_TRAFFIC_CLASS_NUM; iter++) {
+            *value += port_cnts->redecn_cnts.tc_red_dropped_packets[iter];
+        }
+        break;
 
-        case SAI_PORT_STAT_PFC_0_RX_PAUSE_DURATION:
-        case SAI_PORT_STAT_PFC_1_RX_PAUSE_DURATION:
-        case SAI_PORT_STAT_PFC_2_RX_PAUSE_DURATION:
-        case SAI_PORT_STAT_PFC_3_RX_PAUSE_DURATION:
-        case SAI_PORT_STAT_PFC_4_RX_PAUSE_DURATION:
-        case SAI_PORT_STAT_PFC_5_RX_PAUSE_DURATION:
-        case SAI_PORT_STAT_PFC_6_RX_PAUSE_DURATION:
-        case SAI_PORT_STAT_PFC_7_RX_PAUSE_DURATION:
-            if (SX_STATUS_SUCCESS !=
-                (status = sx_api_port_counter_prio_get(gh_sdk, SX_ACCESS_CMD_READ, port_data,
-                                                       /* Extract Prio i from SAI RXi,TXi */
-                                                       SX_PORT_PRIO_ID_0 +
-                                                       (counter_ids[ii] - SAI_PORT_STAT_PFC_0_RX_PAUSE_DURATION) / 2,
-                                                       &cntr_prio))) {
-                SX_LOG_ERR("Failed to get port prio %d counters - %s.\n",
-                           SX_PORT_PRIO_ID_0 + (counter_ids[ii] - SAI_PORT_STAT_PFC_0_RX_PAUSE_DURATION) / 2,
-                           SX_STATUS_MSG(status));
-                return sdk_to_sai(status);
-            }
-            counters[ii] = cntr_prio.rx_pause_duration;
-            break;
+    case SAI_PORT_STAT_ECN_MARKED_PACKETS:
+        *value = port_cnts->redecn_cnts.ecn_marked_packets;
+        break;
 
-        case SAI_PORT_STAT_PFC_0_TX_PAUSE_DURATION:
-        case SAI_PORT_STAT_PFC_1_TX_PAUSE_DURATION:
-        case SAI_PORT_STAT_PFC_2_TX_PAUSE_DURATION:
-        case SAI_PORT_STAT_PFC_3_TX_PAUSE_DURATION:
-        case SAI_PORT_STAT_PFC_4_TX_PAUSE_DURATION:
-        case SAI_PORT_STAT_PFC_5_TX_PAUSE_DURATION:
-        case SAI_PORT_STAT_PFC_6_TX_PAUSE_DURATION:
-        case SAI_PORT_STAT_PFC_7_TX_PAUSE_DURATION:
-            if (SX_STATUS_SUCCESS !=
-                (status = sx_api_port_counter_prio_get(gh_sdk, SX_ACCESS_CMD_READ, port_data,
-                                                       SX_PORT_PRIO_ID_0 +
-                                                       (counter_ids[ii] - SAI_PORT_STAT_PFC_0_TX_PAUSE_DURATION) / 2,
-                                                       &cntr_prio))) {
-                SX_LOG_ERR("Failed to get port prio %d counters - %s.\n",
-                           SX_PORT_PRIO_ID_0 + (counter_ids[ii] - SAI_PORT_STAT_PFC_0_TX_PAUSE_DURATION) / 2,
-                           SX_STATUS_MSG(status));
-                return sdk_to_sai(status);
-            }
-            counters[ii] = cntr_prio.tx_pause_duration;
-            break;
+    case SAI_PORT_STAT_PFC_0_RX_PKTS:
+    case SAI_PORT_STAT_PFC_1_RX_PKTS:
+    case SAI_PORT_STAT_PFC_2_RX_PKTS:
+    case SAI_PORT_STAT_PFC_3_RX_PKTS:
+    case SAI_PORT_STAT_PFC_4_RX_PKTS:
+    case SAI_PORT_STAT_PFC_5_RX_PKTS:
+    case SAI_PORT_STAT_PFC_6_RX_PKTS:
+    case SAI_PORT_STAT_PFC_7_RX_PKTS:
+        /* Extract Prio i from SAI RXi,TXi */
+        status = mlnx_port_prio_counters_get(port_data, (counter_id - SAI_PORT_STAT_PFC_0_RX_PKTS) / 2,
+                                             port_cnts, &cntr_prio);
+        if (SAI_ERR(status)) {
+            return status;
+        }
+        *value = cntr_prio.rx_pause;
+        break;
 
-        case SAI_PORT_STAT_IF_IN_VLAN_DISCARDS:
-            counters[ii] = discard_cnts.ingress_vlan_membership;
-            break;
+    case SAI_PORT_STAT_PFC_0_TX_PKTS:
+    case SAI_PORT_STAT_PFC_1_TX_PKTS:
+    case SAI_PORT_STAT_PFC_2_TX_PKTS:
+    case SAI_PORT_STAT_PFC_3_TX_PKTS:
+    case SAI_PORT_STAT_PFC_4_TX_PKTS:
+    case SAI_PORT_STAT_PFC_5_TX_PKTS:
+    case SAI_PORT_STAT_PFC_6_TX_PKTS:
+    case SAI_PORT_STAT_PFC_7_TX_PKTS:
+        /* Extract Prio i from SAI RXi,TXi */
+        status = mlnx_port_prio_counters_get(port_data, (counter_id - SAI_PORT_STAT_PFC_0_TX_PKTS) / 2,
+                                             port_cnts, &cntr_prio);
+        if (SAI_ERR(status)) {
+            return status;
+        }
+        *value = cntr_prio.tx_pause;
+        break;
 
-        case SAI_PORT_STAT_IF_OUT_QLEN:
-        case SAI_PORT_STAT_ETHER_STATS_PKTS_4096_TO_9216_OCTETS:
-        case SAI_PORT_STAT_ETHER_STATS_PKTS_9217_TO_16383_OCTETS:
-        case SAI_PORT_STAT_ETHER_RX_OVERSIZE_PKTS:
-        case SAI_PORT_STAT_ETHER_TX_OVERSIZE_PKTS:
-        case SAI_PORT_STAT_IP_IN_RECEIVES:
-        case SAI_PORT_STAT_IP_IN_OCTETS:
-        case SAI_PORT_STAT_IP_IN_UCAST_PKTS:
-        case SAI_PORT_STAT_IP_IN_NON_UCAST_PKTS:
-        case SAI_PORT_STAT_IP_IN_DISCARDS:
-        case SAI_PORT_STAT_IP_OUT_OCTETS:
-        case SAI_PORT_STAT_IP_OUT_UCAST_PKTS:
-        case SAI_PORT_STAT_IP_OUT_NON_UCAST_PKTS:
-        case SAI_PORT_STAT_IP_OUT_DISCARDS:
-        case SAI_PORT_STAT_IPV6_IN_RECEIVES:
-        case SAI_PORT_STAT_IPV6_IN_OCTETS:
-        case SAI_PORT_STAT_IPV6_IN_UCAST_PKTS:
-        case SAI_PORT_STAT_IPV6_IN_NON_UCAST_PKTS:
-        case SAI_PORT_STAT_IPV6_IN_MCAST_PKTS:
-        case SAI_PORT_STAT_IPV6_IN_DISCARDS:
-        case SAI_PORT_STAT_IPV6_OUT_OCTETS:
-        case SAI_PORT_STAT_IPV6_OUT_UCAST_PKTS:
-        case SAI_PORT_STAT_IPV6_OUT_NON_UCAST_PKTS:
-        case SAI_PORT_STAT_IPV6_OUT_MCAST_PKTS:
-        case SAI_PORT_STAT_IPV6_OUT_DISCARDS:
-        case SAI_PORT_STAT_ETHER_IN_PKTS_64_OCTETS:
-        case SAI_PORT_STAT_ETHER_IN_PKTS_65_TO_127_OCTETS:
-        case SAI_PORT_STAT_ETHER_IN_PKTS_128_TO_255_OCTETS:
-        case SAI_PORT_STAT_ETHER_IN_PKTS_256_TO_511_OCTETS:
-        case SAI_PORT_STAT_ETHER_IN_PKTS_512_TO_1023_OCTETS:
-        case SAI_PORT_STAT_ETHER_IN_PKTS_1024_TO_1518_OCTETS:
-        case SAI_PORT_STAT_ETHER_IN_PKTS_1519_TO_2047_OCTETS:
-        case SAI_PORT_STAT_ETHER_IN_PKTS_2048_TO_4095_OCTETS:
-        case SAI_PORT_STAT_ETHER_IN_PKTS_4096_TO_9216_OCTETS:
-        case SAI_PORT_STAT_ETHER_IN_PKTS_9217_TO_16383_OCTETS:
-        case SAI_PORT_STAT_ETHER_OUT_PKTS_64_OCTETS:
-        case SAI_PORT_STAT_ETHER_OUT_PKTS_65_TO_127_OCTETS:
-        case SAI_PORT_STAT_ETHER_OUT_PKTS_128_TO_255_OCTETS:
-        case SAI_PORT_STAT_ETHER_OUT_PKTS_256_TO_511_OCTETS:
-        case SAI_PORT_STAT_ETHER_OUT_PKTS_512_TO_1023_OCTETS:
-        case SAI_PORT_STAT_ETHER_OUT_PKTS_1024_TO_1518_OCTETS:
-        case SAI_PORT_STAT_ETHER_OUT_PKTS_1519_TO_2047_OCTETS:
-        case SAI_PORT_STAT_ETHER_OUT_PKTS_2048_TO_4095_OCTETS:
-        case SAI_PORT_STAT_ETHER_OUT_PKTS_4096_TO_9216_OCTETS:
-        case SAI_PORT_STAT_ETHER_OUT_PKTS_9217_TO_16383_OCTETS:
-        case SAI_PORT_STAT_IN_CURR_OCCUPANCY_BYTES:
-        case SAI_PORT_STAT_IN_WATERMARK_BYTES:
-        case SAI_PORT_STAT_IN_SHARED_CURR_OCCUPANCY_BYTES:
-        case SAI_PORT_STAT_IN_SHARED_WATERMARK_BYTES:
-        case SAI_PORT_STAT_OUT_CURR_OCCUPANCY_BYTES:
-        case SAI_PORT_STAT_OUT_WATERMARK_BYTES:
-        case SAI_PORT_STAT_OUT_SHARED_CURR_OCCUPANCY_BYTES:
-        case SAI_PORT_STAT_OUT_SHARED_WATERMARK_BYTES:
-        case SAI_PORT_STAT_PFC_0_ON2OFF_RX_PKTS:
-        case SAI_PORT_STAT_PFC_1_ON2OFF_RX_PKTS:
-        case SAI_PORT_STAT_PFC_2_ON2OFF_RX_PKTS:
-        case SAI_PORT_STAT_PFC_3_ON2OFF_RX_PKTS:
-        case SAI_PORT_STAT_PFC_4_ON2OFF_RX_PKTS:
-        case SAI_PORT_STAT_PFC_5_ON2OFF_RX_PKTS:
-        case SAI_PORT_STAT_PFC_6_ON2OFF_RX_PKTS:
-        case SAI_PORT_STAT_PFC_7_ON2OFF_RX_PKTS:
-        case SAI_PORT_STAT_EEE_TX_EVENT_COUNT:
-        case SAI_PORT_STAT_EEE_RX_EVENT_COUNT:
-        case SAI_PORT_STAT_EEE_TX_DURATION:
-        case SAI_PORT_STAT_EEE_RX_DURATION:
-            SX_LOG_ERR("Port counter %d set item %u not implemented\n", counter_ids[ii], ii);
-            return SAI_STATUS_NOT_IMPLEMENTED;
+    case SAI_PORT_STAT_PFC_0_RX_PAUSE_DURATION:
+    case SAI_PORT_STAT_PFC_1_RX_PAUSE_DURATION:
+    case SAI_PORT_STAT_PFC_2_RX_PAUSE_DURATION:
+    case SAI_PORT_STAT_PFC_3_RX_PAUSE_DURATION:
+    case SAI_PORT_STAT_PFC_4_RX_PAUSE_DURATION:
+    case SAI_PORT_STAT_PFC_5_RX_PAUSE_DURATION:
+    case SAI_PORT_STAT_PFC_6_RX_PAUSE_DURATION:
+    case SAI_PORT_STAT_PFC_7_RX_PAUSE_DURATION:
+        /* Extract Prio i from SAI RXi,TXi */
+        status = mlnx_port_prio_counters_get(port_data, (counter_id - SAI_PORT_STAT_PFC_0_RX_PAUSE_DURATION) / 2,
+                                             port_cnts, &cntr_prio);
+        if (SAI_ERR(status)) {
+            return status;
+        }
+        *value = cntr_prio.rx_pause_duration;
+        break;
 
-        default:
-            SX_LOG_ERR("Invalid port counter %d\n", counter_ids[ii]);
-            return SAI_STATUS_INVALID_PARAMETER;
+    case SAI_PORT_STAT_PFC_0_TX_PAUSE_DURATION:
+    case SAI_PORT_STAT_PFC_1_TX_PAUSE_DURATION:
+    case SAI_PORT_STAT_PFC_2_TX_PAUSE_DURATION:
+    case SAI_PORT_STAT_PFC_3_TX_PAUSE_DURATION:
+    case SAI_PORT_STAT_PFC_4_TX_PAUSE_DURATION:
+    case SAI_PORT_STAT_PFC_5_TX_PAUSE_DURATION:
+    case SAI_PORT_STAT_PFC_6_TX_PAUSE_DURATION:
+    case SAI_PORT_STAT_PFC_7_TX_PAUSE_DURATION:
+        /* Extract Prio i from SAI RXi,TXi */
+        status = mlnx_port_prio_counters_get(port_data, (counter_id - SAI_PORT_STAT_PFC_0_TX_PAUSE_DURATION) / 2,
+                                             port_cnts, &cntr_prio);
+        if (SAI_ERR(status)) {
+            return status;
         }
+        *value = cntr_prio.tx_pause_duration;
+        break;
+
+    case SAI_PORT_STAT_IF_IN_VLAN_DISCARDS:
+        *value = port_cnts->discard_cnts.ingress_vlan_membership;
+        break;
+
+    case SAI_PORT_STAT_IF_OUT_QLEN:
+    case SAI_PORT_STAT_ETHER_STATS_PKTS_4096_TO_9216_OCTETS:
+    case SAI_PORT_STAT_ETHER_STATS_PKTS_9217_TO_16383_OCTETS:
+    case SAI_PORT_STAT_ETHER_RX_OVERSIZE_PKTS:
+    case SAI_PORT_STAT_ETHER_TX_OVERSIZE_PKTS:
+    case SAI_PORT_STAT_IP_IN_RECEIVES:
+    case SAI_PORT_STAT_IP_IN_OCTETS:
+    case SAI_PORT_STAT_IP_IN_UCAST_PKTS:
+    case SAI_PORT_STAT_IP_IN_NON_UCAST_PKTS:
+    case SAI_PORT_STAT_IP_IN_DISCARDS:
+    case SAI_PORT_STAT_IP_OUT_OCTETS:
+    case SAI_PORT_STAT_IP_OUT_UCAST_PKTS:
+    case SAI_PORT_STAT_IP_OUT_NON_UCAST_PKTS:
+    case SAI_PORT_STAT_IP_OUT_DISCARDS:
+    case SAI_PORT_STAT_IPV6_IN_RECEIVES:
+    case SAI_PORT_STAT_IPV6_IN_OCTETS:
+    case SAI_PORT_STAT_IPV6_IN_UCAST_PKTS:
+    case SAI_PORT_STAT_IPV6_IN_NON_UCAST_PKTS:
+    case SAI_PORT_STAT_IPV6_IN_MCAST_PKTS:
+    case SAI_PORT_STAT_IPV6_IN_DISCARDS:
+    case SAI_PORT_STAT_IPV6_OUT_OCTETS:
+    case SAI_PORT_STAT_IPV6_OUT_UCAST_PKTS:
+    case SAI_PORT_STAT_IPV6_OUT_NON_UCAST_PKTS:
+    case SAI_PORT_STAT_IPV6_OUT_MCAST_PKTS:
+    case SAI_PORT_STAT_IPV6_OUT_DISCARDS:
+    case SAI_PORT_STAT_ETHER_IN_PKTS_64_OCTETS:
+    case SAI_PORT_STAT_ETHER_IN_PKTS_65_TO_127_OCTETS:
+    case SAI_PORT_STAT_ETHER_IN_PKTS_128_TO_255_OCTETS:
+    case SAI_PORT_STAT_ETHER_IN_PKTS_256_TO_511_OCTETS:
+    case SAI_PORT_STAT_ETHER_IN_PKTS_512_TO_1023_OCTETS:
+    case SAI_PORT_STAT_ETHER_IN_PKTS_1024_TO_1518_OCTETS:
+    case SAI_PORT_STAT_ETHER_IN_PKTS_1519_TO_2047_OCTETS:
+    case SAI_PORT_STAT_ETHER_IN_PKTS_2048_TO_4095_OCTETS:
+    case SAI_PORT_STAT_ETHER_IN_PKTS_4096_TO_9216_OCTETS:
+    case SAI_PORT_STAT_ETHER_IN_PKTS_9217_TO_16383_OCTETS:
+    case SAI_PORT_STAT_ETHER_OUT_PKTS_64_OCTETS:
+    case SAI_PORT_STAT_ETHER_OUT_PKTS_65_TO_127_OCTETS:
+    case SAI_PORT_STAT_ETHER_OUT_PKTS_128_TO_255_OCTETS:
+    case SAI_PORT_STAT_ETHER_OUT_PKTS_256_TO_511_OCTETS:
+    case SAI_PORT_STAT_ETHER_OUT_PKTS_512_TO_1023_OCTETS:
+    case SAI_PORT_STAT_ETHER_OUT_PKTS_1024_TO_1518_OCTETS:
+    case SAI_PORT_STAT_ETHER_OUT_PKTS_1519_TO_2047_OCTETS:
+    case SAI_PORT_STAT_ETHER_OUT_PKTS_2048_TO_4095_OCTETS:
+    case SAI_PORT_STAT_ETHER_OUT_PKTS_4096_TO_9216_OCTETS:
+    case SAI_PORT_STAT_ETHER_OUT_PKTS_9217_TO_16383_OCTETS:
+    case SAI_PORT_STAT_IN_CURR_OCCUPANCY_BYTES:
+    case SAI_PORT_STAT_IN_WATERMARK_BYTES:
+    case SAI_PORT_STAT_IN_SHARED_CURR_OCCUPANCY_BYTES:
+    case SAI_PORT_STAT_IN_SHARED_WATERMARK_BYTES:
+    case SAI_PORT_STAT_OUT_CURR_OCCUPANCY_BYTES:
+    case SAI_PORT_STAT_OUT_WATERMARK_BYTES:
+    case SAI_PORT_STAT_OUT_SHARED_CURR_OCCUPANCY_BYTES:
+    case SAI_PORT_STAT_OUT_SHARED_WATERMARK_BYTES:
+    case SAI_PORT_STAT_PFC_0_ON2OFF_RX_PKTS:
+    case SAI_PORT_STAT_PFC_1_ON2OFF_RX_PKTS:
+    case SAI_PORT_STAT_PFC_2_ON2OFF_RX_PKTS:
+    case SAI_PORT_STAT_PFC_3_ON2OFF_RX_PKTS:
+    case SAI_PORT_STAT_PFC_4_ON2OFF_RX_PKTS:
+    case SAI_PORT_STAT_PFC_5_ON2OFF_RX_PKTS:
+    case SAI_PORT_STAT_PFC_6_ON2OFF_RX_PKTS:
+    case SAI_PORT_STAT_PFC_7_ON2OFF_RX_PKTS:
+    case SAI_PORT_STAT_EEE_TX_EVENT_COUNT:
+    case SAI_PORT_STAT_EEE_RX_EVENT_COUNT:
+    case SAI_PORT_STAT_EEE_TX_DURATION:
+    case SAI_PORT_STAT_EEE_RX_DURATION:
+        return SAI_STATUS_NOT_IMPLEMENTED;
+
+    default:
+        return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
 }
 
-/*
- * Routine Description:
- *   Clear port statistics counters.
- *
- * Arguments:
- *    [in] port_id - port id
- *    [in] number_of_counters - number of counters in the array
- *    [in] counter_ids - specifies the array of counter ids
- *
- * Return Values:
- *    SAI_STATUS_SUCCESS on success
- *    Failure status code on error
- */
-static sai_status_t mlnx_clear_port_stats(_In_ sai_object_id_t        port_id,
-                                          _In_ uint32_t               number_of_counters,
+/* Reads the counters the port stats are served from, from the counter snapshot unless is_hw_read */
+static sai_status_t mlnx_port_stats_counters_get(_In_ sx_port_log_id_t       port_data,
+                                                 _In_ bool                   is_hw_read,
+                                                 _In_ bool                   with_prio,
+                                                 _Out_ mlnx_port_counters_t *port_cnts)
+{
+    sai_status_t        status;
+    mlnx_port_config_t *port;
+    sx_port_log_id_t    red_port_id;
+
+    /* Served from the counter snapshot when the counter refresh interval is set */
+    if (!is_hw_read && mlnx_counter_port_get(port_data, port_cnts)) {
+        return SAI_STATUS_SUCCESS;
+    }
+
+    /* In case if port is LAG member then use LAG logical id for redecn counters */
+    sai_db_read_lock();
+    status = mlnx_port_by_log_id(port_data, &port);
+    if (SAI_ERR(status)) {
+        sai_db_unlock();
+        return status;
+    }
+    if (mlnx_port_is_lag_member(port)) {
+        red_port_id = port->lag_id;
+    } else {
+        red_port_id = port_data;
+    }
+    sai_db_unlock();
+
+    return mlnx_port_counters_read(gh_sdk, port_data, red_port_id, with_prio, port_cnts);
+}
+
+/*
+ * Routine Description:
+ *   Get port statistics counters.
+ *
+ * Arguments:
+ *    [in] port_id - port id
+ *    [in] number_of_counters - number of counters in the array
+ *    [in] counter_ids - specifies the array of counter ids
+ *    [in] is_hw_read - read HW even if the counter snapshot is on
+ *    [out] counters - array of resulting counter values.
+ *
+ * Return Values:
+ *    SAI_STATUS_SUCCESS on success
+ *    Failure status code on error
+ */
+static sai_status_t mlnx_get_port_stats_impl(_In_ sai_object_id_t        port_id,
+                                             _In_ uint32_t               number_of_counters,
+                                             _In_ const sai_port_stat_t *counter_ids,
+                                             _In_ bool                   is_hw_read,
+                                             _Out_ uint64_t             *counters)
+{
+    sai_status_t         status;
+    mlnx_port_counters_t port_cnts;
+    uint32_t             ii, port_data;
+    char                 key_str[MAX_KEY_STR_LEN];
+
+    SX_LOG_ENTER();
+
+    port_key_to_str(port_id, key_str);
+    SX_LOG_DBG("Get port stats %s\n", key_str);
+
+    if (NULL == counter_ids) {
+        SX_LOG_ERR("NULL counter ids array param\n");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    if (NULL == counters) {
+        SX_LOG_ERR("NULL counters array param\n");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    if (SAI_STATUS_SUCCESS != (status = mlnx_object_to_type(port_id, SAI_OBJECT_TYPE_PORT, &port_data, NULL))) {
+        return status;
+    }
+
+    status = mlnx_port_stats_counters_get(port_data, is_hw_read, false, &port_cnts);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    for (ii = 0; ii < number_of_counters; ii++) {
+        status = mlnx_port_stat_value_get(port_data, &port_cnts, counter_ids[ii], &counters[ii]);
+        if (SAI_ERR(status)) {
+            SX_LOG_ERR("Failed to get port counter %d item %u\n", counter_ids[ii], ii);
+            return status;
+        }
+    }
+
+    SX_LOG_EXIT();
+    return SAI_STATUS_SUCCESS;
+}
+
+/*
+ * Counters are cleared in the DB only, HW counters keep counting for the other consumers (e.g. LAG, debug).
+ * On capture the current HW values become the baseline, otherwise the values are made relative to it.
+ * A clear of all the port counters replaces the whole baseline and port add resets it, both bump the port
+ * stats epoch. Values read in an older epoch are returned as 0 and are not captured.
+ * A value lower than the baseline is clamped to 0.
+ * Gauges (queue length, occupancy and watermarks) are not counters and are never baselined.
+ */
+static bool mlnx_port_stat_is_gauge(_In_ sai_port_stat_t counter_id)
+{
+    switch (counter_id) {
+    case SAI_PORT_STAT_IF_OUT_QLEN:
+    case SAI_PORT_STAT_IN_CURR_OCCUPANCY_BYTES:
+    case SAI_PORT_STAT_IN_WATERMARK_BYTES:
+    case SAI_PORT_STAT_IN_SHARED_CURR_OCCUPANCY_BYTES:
+    case SAI_PORT_STAT_IN_SHARED_WATERMARK_BYTES:
+    case SAI_PORT_STAT_OUT_CURR_OCCUPANCY_BYTES:
+    case SAI_PORT_STAT_OUT_WATERMARK_BYTES:
+    case SAI_PORT_STAT_OUT_SHARED_CURR_OCCUPANCY_BYTES:
+    case SAI_PORT_STAT_OUT_SHARED_WATERMARK_BYTES:
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+static sai_status_t mlnx_port_stats_epoch_get(_In_ sai_object_id_t port_id, _Out_ uint32_t *epoch)
+{
+    mlnx_port_config_t *port;
+    sai_status_t        status;
+    uint32_t            port_data;
+
+    status = mlnx_object_to_type(port_id, SAI_OBJECT_TYPE_PORT, &port_data, NULL);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    sai_db_read_lock();
+
+    status = mlnx_port_by_log_id(port_data, &port);
+    if (SAI_ERR(status)) {
+        goto out;
+    }
+
+    if (port->index >= MAX_PORTS) {
+        SX_LOG_ERR("Port %x index %u is out of the stats DB range\n", port_data, port->index);
+        status = SAI_STATUS_FAILURE;
+        goto out;
+    }
+
+    *epoch = g_sai_db_ptr->port_stats_epoch[port->index];
+
+out:
+    sai_db_unlock();
+    return status;
+}
+
+/* Replaces the whole port baseline and starts a new port stats epoch */
+static sai_status_t mlnx_port_stats_baseline_set(_In_ uint32_t port_data, _In_ const uint64_t *values)
+{
+    mlnx_port_config_t *port;
+    sai_status_t        status;
+
+    sai_db_write_lock();
+
+    status = mlnx_port_by_log_id(port_data, &port);
+    if (SAI_ERR(status)) {
+        goto out;
+    }
+
+    if (port->index >= MAX_PORTS) {
+        SX_LOG_ERR("Port %x index %u is out of the stats DB range\n", port_data, port->index);
+        status = SAI_STATUS_FAILURE;
+        goto out;
+    }
+
+    memcpy(g_sai_db_ptr->port_stats_baseline[port->index], values,
+           sizeof(g_sai_db_ptr->port_stats_baseline[port->index]));
+    sai_db_field_dirty_mark(port_stats_baseline[port->index]);
+    g_sai_db_ptr->port_stats_epoch[port->index]++;
+    sai_db_field_dirty_mark(port_stats_epoch[port->index]);
+
+    sai_db_sync_async();
+
+out:
+    sai_db_unlock();
+    return status;
+}
+
+static sai_status_t mlnx_port_stats_baseline_apply(_In_ sai_object_id_t        port_id,
+                                                   _In_ uint32_t               number_of_counters,
+                                                   _In_ const sai_port_stat_t *counter_ids,
+                                                   _Inout_ uint64_t           *counters,
+                                                   _In_ bool                   is_capture,
+                                                   _In_ uint32_t               epoch)
+{
+    mlnx_port_config_t *port;
+    sai_status_t        status;
+    uint64_t           *baseline;
+    uint32_t            port_data, ii;
+    bool                is_reset;
+
+    status = mlnx_object_to_type(port_id, SAI_OBJECT_TYPE_PORT, &port_data, NULL);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    if (is_capture) {
+        sai_db_write_lock();
+    } else {
+        sai_db_read_lock();
+    }
+
+    status = mlnx_port_by_log_id(port_data, &port);
+    if (SAI_ERR(status)) {
+        goto out;
+    }
+
+    if (port->index >= MAX_PORTS) {
+        SX_LOG_ERR("Port %x index %u is out of the stats DB range\n", port_data, port->index);
+        status = SAI_STATUS_FAILURE;
+        goto out;
+    }
+
+    baseline = g_sai_db_ptr->port_stats_baseline[port->index];
+
+    /* HW values were read before the baseline was replaced */
+    is_reset = (epoch != g_sai_db_ptr->port_stats_epoch[port->index]);
+    if (is_reset) {
+        SX_LOG_DBG("Port %x counters were cleared during the read\n", port_data);
+    }
+
+    for (ii = 0; ii < number_of_counters; ii++) {
+        if (mlnx_port_stat_is_gauge(counter_ids[ii])) {
+            continue;
+        }
+
+        if (is_capture) {
+            /* The clear of all the counters already took a newer baseline */
+            if (!is_reset) {
+                baseline[counter_ids[ii]] = counters[ii];
+            }
+        } else if (is_reset || (counters[ii] < baseline[counter_ids[ii]])) {
+            counters[ii] = 0;
+        } else {
+            counters[ii] -= baseline[counter_ids[ii]];
+        }
+    }
+
+    if (is_capture && !is_reset) {
+        sai_db_field_dirty_mark(port_stats_baseline[port->index]);
+        sai_db_sync_async();
+    }
+
+out:
+    sai_db_unlock();
+    return status;
+}
+
+static sai_status_t mlnx_get_port_stats(_In_ sai_object_id_t        port_id,
+                                        _In_ uint32_t               number_of_counters,
+                                        _In_ const sai_port_stat_t *counter_ids,
+                                        _Out_ uint64_t             *counters)
+{
+    sai_status_t status;
+    uint32_t     epoch = 0;
+
+    mlnx_perf_op_begin(SAI_OBJECT_TYPE_PORT, MLNX_PERF_OP_STATS);
+    status = mlnx_port_stats_epoch_get(port_id, &epoch);
+    if (!SAI_ERR(status)) {
+        status = mlnx_get_port_stats_impl(port_id, number_of_counters, counter_ids, false, counters);
+    }
+    if (!SAI_ERR(status)) {
+        status = mlnx_port_stats_baseline_apply(port_id, number_of_counters, counter_ids, counters, false, epoch);
+    }
+    mlnx_perf_op_end(status);
+
+    return status;
+}
+
+/*
+ * Routine Description:
+ *   Clear port statistics counters.
+ *
+ * Arguments:
+ *    [in] port_id - port id
+ *    [in] number_of_counters - number of counters in the array
+ *    [in] counter_ids - specifies the array of counter ids
+ *
+ * Return Values:
+ *    SAI_STATUS_SUCCESS on success
+ *    Failure status code on error
+ */
+static sai_status_t mlnx_clear_port_stats(_In_ sai_object_id_t        port_id,
+                                          _In_ uint32_t               number_of_counters,
                                           _In_ const sai_port_stat_t *counter_ids)
 {
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    sai_status_t status;
+    uint64_t    *counters;
+    uint32_t     ii, epoch = 0;
+    char         key_str[MAX_KEY_STR_LEN];
+
+    SX_LOG_ENTER();
+
+    port_key_to_str(port_id, key_str);
+    SX_LOG_NTC("Clear port stats %s\n", key_str);
+
+    if (NULL == counter_ids) {
+        SX_LOG_ERR("NULL counter ids array param\n");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    for (ii = 0; ii < number_of_counters; ii++) {
+        if ((uint32_t)counter_ids[ii] >= MLNX_PORT_STATS_NUM) {
+            SX_LOG_ERR("Invalid port counter %d\n", counter_ids[ii]);
+            return SAI_STATUS_INVALID_PARAMETER;
+        }
+
+        if (mlnx_port_stat_is_gauge(counter_ids[ii])) {
+            SX_LOG_NTC("Port counter %d is a gauge, it is not cleared\n", counter_ids[ii]);
+        }
+    }
+
+    if (0 == number_of_counters) {
+        return SAI_STATUS_SUCCESS;
+    }
+
+    counters = calloc(number_of_counters, sizeof(*counters));
+    if (!counters) {
+        SX_LOG_ERR("Failed to allocate memory\n");
+        return SAI_STATUS_NO_MEMORY;
+    }
+
+    /* Snapshot values might be behind HW, take the baseline from HW */
+    status = mlnx_port_stats_epoch_get(port_id, &epoch);
+    if (!SAI_ERR(status)) {
+        status = mlnx_get_port_stats_impl(port_id, number_of_counters, counter_ids, true, counters);
+    }
+    if (!SAI_ERR(status)) {
+        status = mlnx_port_stats_baseline_apply(port_id, number_of_counters, counter_ids, counters, true, epoch);
+    }
+
+    free(counters);
+
+    SX_LOG_EXIT();
+    return status;
 }
 
 /*
@@ -4383,9 +4750,11 @@ static sai_status_t mlnx_clear_port_stats(_In_ sai_object_id_t        port_id,
  */
 static sai_status_t mlnx_clear_port_all_stats(_In_ sai_object_id_t port_id)
 {
-    sai_status_t status;
-    uint32_t     port_data;
-    char         key_str[MAX_KEY_STR_LEN];
+    sai_status_t         status;
+    mlnx_port_counters_t port_cnts;
+    uint64_t             baseline[MLNX_PORT_STATS_NUM];
+    uint32_t             port_data, id;
+    char                 key_str[MAX_KEY_STR_LEN];
 
     SX_LOG_ENTER();
 
@@ -4396,14 +4765,29 @@ static sai_status_t mlnx_clear_port_all_stats(_In_ sai_object_id_t port_id)
         return status;
     }
 
-    if (SX_STATUS_SUCCESS !=
-        (status = sx_api_port_counter_clear_set(gh_sdk, port_data, false, SX_PORT_CNTR_GRP_ALL))) {
-        SX_LOG_ERR("Failed to clear all port counters - %s.\n", SX_STATUS_MSG(status));
-        return sdk_to_sai(status);
+    /* Snapshot values might be behind HW, take the baseline from HW */
+    status = mlnx_port_stats_counters_get(port_data, true, true, &port_cnts);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    memset(baseline, 0, sizeof(baseline));
+
+    for (id = 0; id < MLNX_PORT_STATS_NUM; id++) {
+        if (mlnx_port_stat_is_gauge(id)) {
+            continue;
+        }
+
+        /* Counters that are not supported are never returned, their baseline stays 0 */
+        if (SAI_ERR(mlnx_port_stat_value_get(port_data, &port_cnts, id, &baseline[id]))) {
+            baseline[id] = 0;
+        }
     }
 
+    status = mlnx_port_stats_baseline_set(port_data, baseline);
+
     SX_LOG_EXIT();
-    return SAI_STATUS_SUCCESS;
+    return status;
 }
 
 sai_status_t mlnx_port_log_set(sx_verbosity_level_t level)
@@ -4680,6 +5064,8 @@ sai_status_t mlnx_port_storm_control_policer_params_clear(_In_ mlnx_port_config_
          policer_type < MLNX_PORT_POLICER_TYPE_MAX;
          policer_type++) {
         if (is_soft) {
+            mlnx_policer_port_binding_update(port_config->port_policers[policer_type], port_config, policer_type,
+                                             false);
             port_config->port_policers[policer_type] = SAI_NULL_OBJECT_ID;
         } else {
             bind_params.port_policer_type = policer_type;
@@ -5279,7 +5665,7 @@ static sai_status_t mlnx_port_speed_convert_bitmap_to_capability(const sx_port_s
     return SAI_STATUS_SUCCESS;
 }
 
-sai_status_t mlnx_port_speed_bitmap_apply(_In_ const mlnx_port_config_t *port)
+sai_status_t mlnx_port_speed_bitmap_apply(_In_ sx_api_handle_t handle, _In_ const mlnx_port_config_t *port)
 {
     sai_status_t               status;
     sx_status_t                sx_status;
@@ -5293,7 +5679,7 @@ sai_status_t mlnx_port_speed_bitmap_apply(_In_ const mlnx_port_config_t *port)
         return status;
     }
 
-    sx_status = sx_api_port_speed_admin_set(gh_sdk, port->logical, &speed);
+    sx_status = sx_api_port_speed_admin_set(handle, port->logical, &speed);
     if (SX_ERR(sx_status)) {
         SX_LOG_ERR("Failed to set port speed - %s.\n", SX_STATUS_MSG(sx_status));
         return sdk_to_sai(sx_status);
@@ -5302,88 +5688,103 @@ sai_status_t mlnx_port_speed_bitmap_apply(_In_ const mlnx_port_config_t *port)
     return SAI_STATUS_SUCCESS;
 }
 
-sai_status_t mlnx_port_config_init(mlnx_port_config_t *port)
+/*
+ * SDK part of the port init, doesn't access the SAI DB so can be called with a
+ * separate SDK handle from a different thread (e.g. parallel port bring-up).
+ */
+sai_status_t mlnx_port_config_init_sdk(_In_ sx_api_handle_t handle, _In_ const mlnx_port_config_t *port)
 {
-    sx_port_admin_state_t      state = SX_PORT_ADMIN_STATUS_DOWN;
-    sx_port_speed_capability_t admin_speed;
-    sai_status_t               status;
+    sx_port_admin_state_t state = SX_PORT_ADMIN_STATUS_DOWN;
+    sai_status_t          status;
 
     assert(port != NULL);
 
     if (mlnx_port_is_lag(port)) {
-        state             = SX_PORT_ADMIN_STATUS_UP;
-        port->admin_state = true;
+        state = SX_PORT_ADMIN_STATUS_UP;
     }
 
-    memset(&admin_speed, 0, sizeof(admin_speed));
-
-    port->start_queues_index = port->index * (MAX_ETS_TC + 1);
-
     /* Configure regular (network) port type only */
     if (mlnx_port_is_phy(port)) {
-        status = sx_api_port_swid_bind_set(gh_sdk, port->logical, DEFAULT_ETH_SWID);
+        status = sx_api_port_swid_bind_set(handle, port->logical, DEFAULT_ETH_SWID);
         if (SX_ERR(status)) {
             SX_LOG_ERR("Port swid bind %x failed - %s\n", port->logical, SX_STATUS_MSG(status));
             return sdk_to_sai(status);
         }
 
-        status = sx_api_port_init_set(gh_sdk, port->logical);
+        status = sx_api_port_init_set(handle, port->logical);
         if (SX_ERR(status)) {
             SX_LOG_ERR("Port init set %x failed - %s\n", port->logical, SX_STATUS_MSG(status));
             return sdk_to_sai(status);
         }
 
-        status = sx_api_port_phys_loopback_set(gh_sdk, port->logical, SX_PORT_PHYS_LOOPBACK_DISABLE);
+        status = sx_api_port_phys_loopback_set(handle, port->logical, SX_PORT_PHYS_LOOPBACK_DISABLE);
         if (SX_ERR(status)) {
             SX_LOG_ERR("Port phys loopback set %x failed - %s\n", port->logical, SX_STATUS_MSG(status));
             return sdk_to_sai(status);
         }
     }
 
-    status = mlnx_stp_port_state_set_impl(port->logical, SX_MSTP_INST_PORT_STATE_FORWARDING, mlnx_stp_get_default_stp());
-    if (SX_ERR(status)) {
-       return status;
-    }
-
-    status = sx_api_port_state_set(gh_sdk, port->logical, state);
+    status = sx_api_port_state_set(handle, port->logical, state);
     if (SX_ERR(status)) {
         SX_LOG_ERR("Port state set %x failed - %s\n", port->logical, SX_STATUS_MSG(status));
         return sdk_to_sai(status);
     }
 
-    status = sx_api_vlan_port_pvid_set(gh_sdk, SX_ACCESS_CMD_ADD, port->logical, DEFAULT_VLAN);
+    status = sx_api_vlan_port_pvid_set(handle, SX_ACCESS_CMD_ADD, port->logical, DEFAULT_VLAN);
     if (SX_ERR(status)) {
         SX_LOG_ERR("port pvid set %x failed - %s\n", port->logical, SX_STATUS_MSG(status));
         return sdk_to_sai(status);
     }
 
-    status = sx_api_vlan_port_ingr_filter_set(gh_sdk, port->logical, SX_INGR_FILTER_ENABLE);
+    status = sx_api_vlan_port_ingr_filter_set(handle, port->logical, SX_INGR_FILTER_ENABLE);
     if (SX_ERR(status)) {
         SX_LOG_ERR("Port ingress filter set %x failed - %s\n", port->logical, SX_STATUS_MSG(status));
         return sdk_to_sai(status);
     }
 
-    port->internal_ingress_samplepacket_obj_idx = MLNX_INVALID_SAMPLEPACKET_SESSION;
-    port->internal_egress_samplepacket_obj_idx  = MLNX_INVALID_SAMPLEPACKET_SESSION;
-
-    port->is_present = true;
-
     if (!mlnx_port_is_virt(port)) {
-        uint32_t ii;
-
-        status = sx_api_cos_port_trust_set(gh_sdk, port->logical, SX_COS_TRUST_LEVEL_PORT);
+        status = sx_api_cos_port_trust_set(handle, port->logical, SX_COS_TRUST_LEVEL_PORT);
         if (SX_ERR(status)) {
             SX_LOG_ERR("Port trust level set %x failed - %s\n", port->logical, SX_STATUS_MSG(status));
             return sdk_to_sai(status);
         }
 
-        status = sx_api_port_global_fc_enable_set(gh_sdk, port->logical,
+        status = sx_api_port_global_fc_enable_set(handle, port->logical,
                                                   SX_PORT_FLOW_CTRL_MODE_TX_DIS_RX_DIS);
         if (SX_ERR(status)) {
             SX_LOG_ERR("Failed to init port global flow control - %s\n", SX_STATUS_MSG(status));
             return sdk_to_sai(status);
         }
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
 
+/* DB write lock is needed */
+sai_status_t mlnx_port_config_commit(mlnx_port_config_t *port)
+{
+    sai_status_t status;
+    uint32_t     ii;
+
+    assert(port != NULL);
+
+    if (mlnx_port_is_lag(port)) {
+        port->admin_state = true;
+    }
+
+    port->start_queues_index = port->index * (MAX_ETS_TC + 1);
+
+    status = mlnx_stp_port_state_set_impl(port->logical, SX_MSTP_INST_PORT_STATE_FORWARDING, mlnx_stp_get_default_stp());
+    if (SX_ERR(status)) {
+       return status;
+    }
+
+    port->internal_ingress_samplepacket_obj_idx = MLNX_INVALID_SAMPLEPACKET_SESSION;
+    port->internal_egress_samplepacket_obj_idx  = MLNX_INVALID_SAMPLEPACKET_SESSION;
+
+    port->is_present = true;
+
+    if (!mlnx_port_is_virt(port)) {
         for (ii = 0; ii < MLNX_QOS_MAP_TYPES_MAX; ii++) {
             status = mlnx_port_qos_map_apply(port->saiport, SAI_NULL_OBJECT_ID, ii);
             if (SAI_ERR(status)) {
@@ -5401,6 +5802,18 @@ sai_status_t mlnx_port_config_init(mlnx_port_config_t *port)
     return SAI_STATUS_SUCCESS;
 }
 
+sai_status_t mlnx_port_config_init(mlnx_port_config_t *port)
+{
+    sai_status_t status;
+
+    status = mlnx_port_config_init_sdk(gh_sdk, port);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    return mlnx_port_config_commit(port);
+}
+
 sai_status_t mlnx_port_add(mlnx_port_config_t *port)
 {
     sai_status_t status;
@@ -5410,6 +5823,14 @@ sai_status_t mlnx_port_add(mlnx_port_config_t *port)
         return status;
     }
 
+    if (port->index < MAX_PORTS) {
+        memset(g_sai_db_ptr->port_stats_baseline[port->index], 0,
+               sizeof(g_sai_db_ptr->port_stats_baseline[port->index]));
+        sai_db_field_dirty_mark(port_stats_baseline[port->index]);
+        g_sai_db_ptr->port_stats_epoch[port->index]++;
+        sai_db_field_dirty_mark(port_stats_epoch[port->index]);
+    }
+
     status = mlnx_acl_port_lag_event_handle(port, ACL_EVENT_TYPE_PORT_LAG_ADD);
     if (SAI_ERR(status)) {
         return status;
@@ -5510,10 +5931,16 @@ sai_status_t mlnx_port_config_uninit(mlnx_port_config_t *port)
         uint32_t                 ii;
 
         /* Reset QoS */
+        for (ii = 0; ii < MLNX_QOS_MAP_TYPES_MAX; ii++) {
+            mlnx_qos_map_port_ref_update(port->qos_maps[ii], 0, port);
+        }
+
         memset(&port->sched_hierarchy, 0, sizeof(port->sched_hierarchy));
         memset(port->qos_maps, 0, sizeof(port->qos_maps));
         port->scheduler_id = SAI_NULL_OBJECT_ID;
 
+        mlnx_samplepacket_port_ref_update(port->internal_ingress_samplepacket_obj_idx,
+                                          MLNX_INVALID_SAMPLEPACKET_SESSION, port);
         port->internal_ingress_samplepacket_obj_idx = MLNX_INVALID_SAMPLEPACKET_SESSION;
         port->internal_egress_samplepacket_obj_idx  = MLNX_INVALID_SAMPLEPACKET_SESSION;
 
@@ -89,6 +89,7 @@ static sai_status_t db_qos_map_alloc(uint32_t *id)
         if (!qos_map->is_used) {
             *id              = ii;
             qos_map->is_used = true;
+            sai_db_dirty_mark(qos_map, sizeof(*qos_map));
             return SAI_STATUS_SUCCESS;
         }
     }
@@ -107,9 +108,185 @@ static sai_status_t db_qos_map_free(uint32_t id)
     }
 
     memset(db_qos_map_get(id), 0, sizeof(mlnx_qos_map_t));
+    sai_db_dirty_mark(db_qos_map_get(id), sizeof(mlnx_qos_map_t));
     return SAI_STATUS_SUCCESS;
 }
 
+#define qos_map_bound_ports_foreach(qos_map, port, idx) \
+    for (idx = mlnx_bitmap_next_set((qos_map)->ports_map, MAX_PORTS * 2, 0); \
+         idx < (MAX_PORTS * 2) && (port = &mlnx_ports_db[idx]); \
+         idx = mlnx_bitmap_next_set((qos_map)->ports_map, MAX_PORTS * 2, idx + 1))
+
+/* db write lock is needed */
+static void db_qos_map_port_ref_set(uint32_t id, const mlnx_port_config_t *port, bool is_bound)
+{
+    mlnx_qos_map_t *qos_map;
+    uint32_t        idx = mlnx_port_idx_get(port);
+    uint32_t        bit = 1u << (idx % 32);
+
+    if (!id || (id > MAX_QOS_MAPS)) {
+        return;
+    }
+
+    qos_map = db_qos_map_get(id);
+
+    if (is_bound && !(qos_map->ports_map[idx / 32] & bit)) {
+        qos_map->ports_map[idx / 32] |= bit;
+        qos_map->port_refs++;
+    } else if (!is_bound && (qos_map->ports_map[idx / 32] & bit)) {
+        qos_map->ports_map[idx / 32] &= ~bit;
+        qos_map->port_refs--;
+    } else {
+        return;
+    }
+
+    sai_db_dirty_mark(qos_map, sizeof(*qos_map));
+}
+
+/*
+ * Moves port's binding from old_id to new_id QoS map (0 means no map),
+ * must be called whenever port->qos_maps[] is changed (db write lock is needed).
+ */
+void mlnx_qos_map_port_ref_update(_In_ uint32_t old_id, _In_ uint32_t new_id, _In_ const mlnx_port_config_t *port)
+{
+    if (old_id == new_id) {
+        return;
+    }
+
+    db_qos_map_port_ref_set(old_id, port, false);
+    db_qos_map_port_ref_set(new_id, port, true);
+}
+
+/* Only these types are merged entry by entry into the SDK, the rest have side effects */
+static bool qos_map_type_is_incremental(sai_qos_map_type_t type)
+{
+    switch (type) {
+    case SAI_QOS_MAP_TYPE_DOT1P_TO_TC:
+    case SAI_QOS_MAP_TYPE_DOT1P_TO_COLOR:
+    case SAI_QOS_MAP_TYPE_DSCP_TO_TC:
+    case SAI_QOS_MAP_TYPE_DSCP_TO_COLOR:
+    case SAI_QOS_MAP_TYPE_TC_TO_QUEUE:
+    case SAI_QOS_MAP_TYPE_TC_AND_COLOR_TO_DSCP:
+    case SAI_QOS_MAP_TYPE_TC_AND_COLOR_TO_DOT1P:
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+static bool qos_map_entry_key_eq(const mlnx_qos_map_t *a, uint32_t ii, const mlnx_qos_map_t *b, uint32_t jj)
+{
+    switch (a->type) {
+    case SAI_QOS_MAP_TYPE_DOT1P_TO_TC:
+    case SAI_QOS_MAP_TYPE_DOT1P_TO_COLOR:
+        return a->from.pcp_dei[ii].pcp == b->from.pcp_dei[jj].pcp;
+
+    case SAI_QOS_MAP_TYPE_DSCP_TO_TC:
+    case SAI_QOS_MAP_TYPE_DSCP_TO_COLOR:
+        return a->from.dscp[ii] == b->from.dscp[jj];
+
+    case SAI_QOS_MAP_TYPE_TC_TO_QUEUE:
+        return a->from.prio_color[ii].priority == b->from.prio_color[jj].priority;
+
+    case SAI_QOS_MAP_TYPE_TC_AND_COLOR_TO_DSCP:
+    case SAI_QOS_MAP_TYPE_TC_AND_COLOR_TO_DOT1P:
+        return (a->from.prio_color[ii].priority == b->from.prio_color[jj].priority) &&
+               (a->from.prio_color[ii].color == b->from.prio_color[jj].color);
+
+    default:
+        return false;
+    }
+}
+
+static bool qos_map_entry_value_eq(const mlnx_qos_map_t *a, uint32_t ii, const mlnx_qos_map_t *b, uint32_t jj)
+{
+    switch (a->type) {
+    case SAI_QOS_MAP_TYPE_DOT1P_TO_TC:
+    case SAI_QOS_MAP_TYPE_DSCP_TO_TC:
+        return a->to.prio_color[ii].priority == b->to.prio_color[jj].priority;
+
+    case SAI_QOS_MAP_TYPE_DOT1P_TO_COLOR:
+    case SAI_QOS_MAP_TYPE_DSCP_TO_COLOR:
+        return a->to.prio_color[ii].color == b->to.prio_color[jj].color;
+
+    case SAI_QOS_MAP_TYPE_TC_TO_QUEUE:
+        return a->to.queue[ii] == b->to.queue[jj];
+
+    case SAI_QOS_MAP_TYPE_TC_AND_COLOR_TO_DSCP:
+        return a->to.dscp[ii] == b->to.dscp[jj];
+
+    case SAI_QOS_MAP_TYPE_TC_AND_COLOR_TO_DOT1P:
+        return (a->to.pcp_dei[ii].pcp == b->to.pcp_dei[jj].pcp) &&
+               (a->to.pcp_dei[ii].dei == b->to.pcp_dei[jj].dei);
+
+    default:
+        return false;
+    }
+}
+
+static void qos_map_entry_copy(mlnx_qos_map_t *dst, uint32_t kk, const mlnx_qos_map_t *src, uint32_t ii)
+{
+    switch (src->type) {
+    case SAI_QOS_MAP_TYPE_DOT1P_TO_TC:
+    case SAI_QOS_MAP_TYPE_DOT1P_TO_COLOR:
+        dst->from.pcp_dei[kk]  = src->from.pcp_dei[ii];
+        dst->to.prio_color[kk] = src->to.prio_color[ii];
+        break;
+
+    case SAI_QOS_MAP_TYPE_DSCP_TO_TC:
+    case SAI_QOS_MAP_TYPE_DSCP_TO_COLOR:
+        dst->from.dscp[kk]     = src->from.dscp[ii];
+        dst->to.prio_color[kk] = src->to.prio_color[ii];
+        break;
+
+    case SAI_QOS_MAP_TYPE_TC_TO_QUEUE:
+        dst->from.prio_color[kk] = src->from.prio_color[ii];
+        dst->to.queue[kk]        = src->to.queue[ii];
+        break;
+
+    case SAI_QOS_MAP_TYPE_TC_AND_COLOR_TO_DSCP:
+        dst->from.prio_color[kk] = src->from.prio_color[ii];
+        dst->to.dscp[kk]         = src->to.dscp[ii];
+        break;
+
+    case SAI_QOS_MAP_TYPE_TC_AND_COLOR_TO_DOT1P:
+        dst->from.prio_color[kk] = src->from.prio_color[ii];
+        dst->to.pcp_dei[kk]      = src->to.pcp_dei[ii];
+        break;
+
+    default:
+        break;
+    }
+}
+
+/*
+ * Builds the entries of new_map which are absent or have a different value in old_map.
+ * Keys dropped from the list are not reset, same as on a full apply.
+ */
+static void qos_map_delta_build(const mlnx_qos_map_t *old_map, const mlnx_qos_map_t *new_map, mlnx_qos_map_t *delta)
+{
+    uint32_t ii, jj;
+
+    delta->type  = new_map->type;
+    delta->count = 0;
+
+    for (ii = 0; ii < new_map->count; ii++) {
+        for (jj = 0; jj < old_map->count; jj++) {
+            if (qos_map_entry_key_eq(new_map, ii, old_map, jj)) {
+                break;
+            }
+        }
+
+        if ((jj < old_map->count) && qos_map_entry_value_eq(new_map, ii, old_map, jj)) {
+            continue;
+        }
+
+        qos_map_entry_copy(delta, delta->count, new_map, ii);
+        delta->count++;
+    }
+}
+
 static void qos_map_param_err(const char *name, uint32_t param, uint32_t ii)
 {
     SX_LOG_ERR("Invalid %s value in QoS map list: [%u]=%u\n", name, ii, param);
@@ -447,6 +624,8 @@ static sai_status_t db_qos_map_fill_params(mlnx_qos_map_t *qos_map, const sai_qo
 {
     sai_status_t status;
 
+    sai_db_dirty_mark(qos_map, sizeof(*qos_map));
+
     if (!qos_params) {
         return mlnx_qos_map_set_default(qos_map);
     }
@@ -655,6 +834,9 @@ static sai_status_t mlnx_qos_map_list_set(_In_ const sai_object_key_t      *key,
 {
     mlnx_port_config_t *port;
     mlnx_qos_map_t     *qos_map;
+    mlnx_qos_map_t      old_map;
+    mlnx_qos_map_t      delta;
+    bool                is_incremental;
     uint32_t            qos_map_idx;
     sai_status_t        status;
     uint32_t            port_idx;
@@ -674,18 +856,38 @@ static sai_status_t mlnx_qos_map_list_set(_In_ const sai_object_key_t      *key,
         goto out;
     }
 
+    memcpy(&old_map, qos_map, sizeof(old_map));
+
     status = db_qos_map_fill_params(qos_map, &value->qosmap);
     if (status != SAI_STATUS_SUCCESS) {
         SX_LOG_ERR("Error while fill QoS params\n");
         goto out;
     }
 
-    mlnx_port_not_in_lag_foreach(port, port_idx) {
-        if (port->qos_maps[qos_map->type] != qos_map_idx) {
+    if (!qos_map->port_refs) {
+        goto out;
+    }
+
+    is_incremental = qos_map_type_is_incremental(qos_map->type);
+    if (is_incremental) {
+        qos_map_delta_build(&old_map, qos_map, &delta);
+        if (!delta.count) {
+            SX_LOG_NTC("QoS map %" PRIx64 " entries are not changed\n", key->key.object_id);
+            goto out;
+        }
+    }
+
+    qos_map_bound_ports_foreach(qos_map, port, port_idx) {
+        /* LAG members get the map via LAG */
+        if (!port->is_present || (port->qos_maps[qos_map->type] != qos_map_idx) || port->lag_id) {
             continue;
         }
 
-        status = mlnx_port_qos_map_apply(port->saiport, key->key.object_id, qos_map->type);
+        if (is_incremental) {
+            status = mlnx_port_qos_map_delta_apply(port, &delta);
+        } else {
+            status = mlnx_port_qos_map_apply(port->saiport, key->key.object_id, qos_map->type);
+        }
         if (status != SAI_STATUS_SUCCESS) {
             SX_LOG_ERR("Failed to update port %" PRIx64 " with new QoS map\n", port->saiport);
             goto out;
@@ -695,7 +897,7 @@ static sai_status_t mlnx_qos_map_list_set(_In_ const sai_object_key_t      *key,
     }
 
 out:
-    sai_db_sync();
+    sai_db_sync_async();
     sai_db_unlock();
     SX_LOG_EXIT();
     return status;
@@ -792,7 +994,7 @@ static sai_status_t mlnx_create_qos_map(_Out_ sai_object_id_t     * qos_map_id,
     SX_LOG_NTC("Created qos map id %" PRIx64 ", %s\n", *qos_map_id, value_str);
 
 out:
-    sai_db_sync();
+    sai_db_sync_async();
     sai_db_unlock();
     SX_LOG_EXIT();
     return status;
@@ -835,8 +1037,8 @@ static sai_status_t mlnx_remove_qos_map(_In_ sai_object_id_t qos_map_id)
         goto out;
     }
 
-    mlnx_port_foreach(port, port_idx) {
-        if (port->qos_maps[qos_map->type] == del_id) {
+    qos_map_bound_ports_foreach(qos_map, port, port_idx) {
+        if (port->is_present && (port->qos_maps[qos_map->type] == del_id)) {
             status = SAI_STATUS_OBJECT_IN_USE;
             SX_LOG_ERR("QoS map is already in use by port %" PRIx64 "\n", port->saiport);
             goto out;
@@ -847,7 +1049,7 @@ static sai_status_t mlnx_remove_qos_map(_In_ sai_object_id_t qos_map_id)
     if (status != SAI_STATUS_SUCCESS) {
         SX_LOG_ERR("Failed to remove qos map id=%u\n", del_id);
     } else {
-        sai_db_sync();
+        sai_db_sync_async();
     }
 
 out:
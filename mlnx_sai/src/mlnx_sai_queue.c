@@ -475,6 +475,8 @@ static sai_status_t mlnx_get_queue_statistics(_In_ sai_object_id_t         queue
     sx_port_occupancy_statistics_t   occupancy_stats;
     uint32_t                         usage_cnt = 1;
     sx_port_traffic_cntr_t           tc_cnts;
+    bool                             is_tc_cnts_needed   = false;
+    bool                             is_occupancy_needed = false;
 
     SX_LOG_ENTER();
 
@@ -502,24 +504,46 @@ static sai_status_t mlnx_get_queue_statistics(_In_ sai_object_id_t         queue
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    if (SX_STATUS_SUCCESS !=
-        (status = sx_api_port_counter_tc_get(gh_sdk, SX_ACCESS_CMD_READ, port_num, queue_num, &tc_cnts))) {
+    for (ii = 0; ii < number_of_counters; ii++) {
+        switch (counter_ids[ii]) {
+        case SAI_QUEUE_STAT_PACKETS:
+        case SAI_QUEUE_STAT_BYTES:
+        case SAI_QUEUE_STAT_DROPPED_PACKETS:
+        case SAI_QUEUE_STAT_DISCARD_DROPPED_PACKETS:
+            is_tc_cnts_needed = true;
+            break;
+
+        case SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES:
+        case SAI_QUEUE_STAT_WATERMARK_BYTES:
+            is_occupancy_needed = true;
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    if (is_tc_cnts_needed && !mlnx_counter_tc_get(port_num, queue_num, &tc_cnts) &&
+        (SX_STATUS_SUCCESS !=
+         (status = sx_api_port_counter_tc_get(gh_sdk, SX_ACCESS_CMD_READ, port_num, queue_num, &tc_cnts)))) {
         SX_LOG_ERR("Failed to get port tc counters - %s.\n", SX_STATUS_MSG(status));
         return sdk_to_sai(status);
     }
 
-    memset(&stats_usage, 0, sizeof(stats_usage));
-    stats_usage.port_cnt                                 = 1;
-    stats_usage.log_port_list_p                          = &port_num;
-    stats_usage.sx_port_params.port_params_type          = SX_COS_EGRESS_PORT_TRAFFIC_CLASS_ATTR_E;
-    stats_usage.sx_port_params.port_params_cnt           = 1;
-    stats_usage.sx_port_params.port_param.port_tc_list_p = &queue_num;
+    if (is_occupancy_needed && !mlnx_watermark_queue_get(port_num, queue_num, &occupancy_stats)) {
+        memset(&stats_usage, 0, sizeof(stats_usage));
+        stats_usage.port_cnt                                 = 1;
+        stats_usage.log_port_list_p                          = &port_num;
+        stats_usage.sx_port_params.port_params_type          = SX_COS_EGRESS_PORT_TRAFFIC_CLASS_ATTR_E;
+        stats_usage.sx_port_params.port_params_cnt           = 1;
+        stats_usage.sx_port_params.port_param.port_tc_list_p = &queue_num;
 
-    if (SX_STATUS_SUCCESS !=
-        (status = sx_api_cos_port_buff_type_statistic_get(gh_sdk, SX_ACCESS_CMD_READ, &stats_usage, 1,
-                                                          &occupancy_stats, &usage_cnt))) {
-        SX_LOG_ERR("Failed to get port buff statistics - %s.\n", SX_STATUS_MSG(status));
-        return sdk_to_sai(status);
+        if (SX_STATUS_SUCCESS !=
+            (status = sx_api_cos_port_buff_type_statistic_get(gh_sdk, SX_ACCESS_CMD_READ, &stats_usage, 1,
+                                                              &occupancy_stats, &usage_cnt))) {
+            SX_LOG_ERR("Failed to get port buff statistics - %s.\n", SX_STATUS_MSG(status));
+            return sdk_to_sai(status);
+        }
     }
 
     for (ii = 0; ii < number_of_counters; ii++) {
@@ -648,6 +672,7 @@ static sai_status_t mlnx_clear_queue_stats(_In_ sai_object_id_t         queue_id
         SX_LOG_ERR("Failed to get clear port buff statistics - %s.\n", SX_STATUS_MSG(status));
         return sdk_to_sai(status);
     }
+    mlnx_counter_collector_invalidate();
 
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
@@ -177,6 +177,179 @@ sai_status_t mlnx_rif_oid_to_sdk_rif_id(_In_ sai_object_id_t rif_oid,
     return SAI_STATUS_SUCCESS;
 }
 
+/* Creates SDK router counter and binds it to the RIF, called under sai db write lock */
+sai_status_t mlnx_rif_sx_counter_attach(_In_ sx_router_interface_t sdk_rif_id)
+{
+    sx_router_counter_id_t counter_id;
+    sx_status_t            sx_status;
+
+    if (sdk_rif_id >= MAX_RIFS) {
+        SX_LOG_ERR("SDK rif id %u is out of the counters DB range (%u)\n", sdk_rif_id, MAX_RIFS);
+        return SAI_STATUS_FAILURE;
+    }
+
+    sx_status = sx_api_router_counter_set(gh_sdk, SX_ACCESS_CMD_CREATE, &counter_id);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Failed to create router counter - %s.\n", SX_STATUS_MSG(sx_status));
+        goto unavailable;
+    }
+
+    sx_status = sx_api_router_interface_counter_bind_set(gh_sdk, SX_ACCESS_CMD_BIND, counter_id, sdk_rif_id);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Failed to bind router counter %u to rif %u - %s.\n", counter_id, sdk_rif_id,
+                   SX_STATUS_MSG(sx_status));
+        sx_api_router_counter_set(gh_sdk, SX_ACCESS_CMD_DESTROY, &counter_id);
+        goto unavailable;
+    }
+
+    g_sai_db_ptr->rif_counters_db[sdk_rif_id].counter_id     = counter_id;
+    g_sai_db_ptr->rif_counters_db[sdk_rif_id].is_bound       = true;
+    g_sai_db_ptr->rif_counters_db[sdk_rif_id].is_unavailable = false;
+    sai_db_field_dirty_mark(rif_counters_db[sdk_rif_id]);
+
+    array_bit_set(g_sai_db_ptr->rif_counters_bound, sdk_rif_id);
+    sai_db_field_dirty_mark(rif_counters_bound[sdk_rif_id / 32]);
+
+    return SAI_STATUS_SUCCESS;
+
+unavailable:
+    g_sai_db_ptr->rif_counters_db[sdk_rif_id].is_unavailable = true;
+    sai_db_field_dirty_mark(rif_counters_db[sdk_rif_id]);
+
+    return sdk_to_sai(sx_status);
+}
+
+/* Unbinds and destroys the RIF router counter, called under sai db write lock before the RIF is deleted */
+sai_status_t mlnx_rif_sx_counter_detach(_In_ sx_router_interface_t sdk_rif_id)
+{
+    mlnx_rif_counter_t *rif_counter;
+    sx_status_t         sx_status;
+
+    if (sdk_rif_id >= MAX_RIFS) {
+        return SAI_STATUS_SUCCESS;
+    }
+
+    rif_counter = &g_sai_db_ptr->rif_counters_db[sdk_rif_id];
+
+    if (!rif_counter->is_bound) {
+        memset(rif_counter, 0, sizeof(*rif_counter));
+        sai_db_field_dirty_mark(rif_counters_db[sdk_rif_id]);
+        return SAI_STATUS_SUCCESS;
+    }
+
+    sx_status = sx_api_router_interface_counter_bind_set(gh_sdk, SX_ACCESS_CMD_UNBIND, rif_counter->counter_id,
+                                                         sdk_rif_id);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Failed to unbind router counter %u from rif %u - %s.\n", rif_counter->counter_id, sdk_rif_id,
+                   SX_STATUS_MSG(sx_status));
+        return sdk_to_sai(sx_status);
+    }
+
+    sx_status = sx_api_router_counter_set(gh_sdk, SX_ACCESS_CMD_DESTROY, &rif_counter->counter_id);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Failed to destroy router counter %u - %s.\n", rif_counter->counter_id, SX_STATUS_MSG(sx_status));
+        return sdk_to_sai(sx_status);
+    }
+
+    memset(rif_counter, 0, sizeof(*rif_counter));
+    sai_db_field_dirty_mark(rif_counters_db[sdk_rif_id]);
+
+    array_bit_clear(g_sai_db_ptr->rif_counters_bound, sdk_rif_id);
+    sai_db_field_dirty_mark(rif_counters_bound[sdk_rif_id / 32]);
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static mlnx_rif_db_t* mlnx_rif_db_entry(_In_ sx_router_interface_t sdk_rif_id)
+{
+    if ((sdk_rif_id >= MAX_RIFS) || !g_sai_db_ptr->rifs_db[sdk_rif_id].is_used) {
+        return NULL;
+    }
+
+    return &g_sai_db_ptr->rifs_db[sdk_rif_id];
+}
+
+/* Keeps the RIF state in DB in sync with the one set to SDK, called under sai db write lock */
+void mlnx_rif_db_state_update(_In_ sx_router_interface_t              sdk_rif_id,
+                              _In_ const sx_router_interface_state_t *state)
+{
+    mlnx_rif_db_t *rif = mlnx_rif_db_entry(sdk_rif_id);
+
+    if (!rif) {
+        return;
+    }
+
+    rif->intf_state     = *state;
+    rif->is_state_valid = true;
+    sai_db_field_dirty_mark(rifs_db[sdk_rif_id]);
+}
+
+/*
+ * Gets the RIF config from DB, SDK is only queried for a RIF that is not there.
+ * vport base port/vlan are filled for sub-port RIF only. Called under sai db lock
+ */
+static sai_status_t mlnx_rif_sx_config_get(_In_ sx_router_interface_t         sdk_rif_id,
+                                           _Out_ sx_router_id_t              *vrid,
+                                           _Out_ sx_router_interface_param_t *intf_params,
+                                           _Out_ sx_interface_attributes_t   *intf_attribs,
+                                           _Out_ sx_port_log_id_t            *base_port,
+                                           _Out_ sx_vlan_id_t                *base_vlan)
+{
+    const mlnx_rif_db_t *rif = mlnx_rif_db_entry(sdk_rif_id);
+    sx_status_t          sx_status;
+
+    if (rif) {
+        *vrid         = rif->vrid;
+        *intf_params  = rif->intf_params;
+        *intf_attribs = rif->intf_attribs;
+
+        if (SX_L2_INTERFACE_TYPE_VPORT == intf_params->type) {
+            *base_port = rif->vport_base_port;
+            *base_vlan = rif->vport_base_vlan;
+        }
+
+        return SAI_STATUS_SUCCESS;
+    }
+
+    sx_status = sx_api_router_interface_get(gh_sdk, sdk_rif_id, vrid, intf_params, intf_attribs);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Failed to get router interface - %s.\n", SX_STATUS_MSG(sx_status));
+        return sdk_to_sai(sx_status);
+    }
+
+    if (SX_L2_INTERFACE_TYPE_VPORT == intf_params->type) {
+        sx_status = sx_api_port_vport_base_get(gh_sdk, intf_params->ifc.vport.vport, base_vlan, base_port);
+        if (SX_ERR(sx_status)) {
+            SX_LOG_ERR("Failed to get base port and vlan for vport %x - %s\n", intf_params->ifc.vport.vport,
+                       SX_STATUS_MSG(sx_status));
+            return sdk_to_sai(sx_status);
+        }
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/* Gets the RIF state from DB, SDK is only queried if it is not there. Called under sai db lock */
+static sai_status_t mlnx_rif_sx_state_get(_In_ sx_router_interface_t         sdk_rif_id,
+                                          _Out_ sx_router_interface_state_t *rif_state)
+{
+    const mlnx_rif_db_t *rif = mlnx_rif_db_entry(sdk_rif_id);
+    sx_status_t          sx_status;
+
+    if (rif && rif->is_state_valid) {
+        *rif_state = rif->intf_state;
+        return SAI_STATUS_SUCCESS;
+    }
+
+    sx_status = sx_api_router_interface_state_get(gh_sdk, sdk_rif_id, rif_state);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Failed to get router interface state - %s.\n", SX_STATUS_MSG(sx_status));
+        return sdk_to_sai(sx_status);
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
 /*
  * Routine Description:
  *    Create router interface.
@@ -443,6 +616,30 @@ static sai_status_t mlnx_create_router_interface(_Out_ sai_object_id_t      *rif
             status = sdk_to_sai(status);
             goto out;
         }
+
+        sai_db_write_lock();
+
+        if (sdk_rif_id < MAX_RIFS) {
+            mlnx_rif_db_t *rif = &g_sai_db_ptr->rifs_db[sdk_rif_id];
+
+            memset(rif, 0, sizeof(*rif));
+            rif->is_used      = true;
+            rif->vrid         = (sx_router_id_t)vrid_data;
+            rif->intf_params  = intf_params;
+            rif->intf_attribs = intf_attribs;
+            if (SAI_ROUTER_INTERFACE_TYPE_SUB_PORT == type->s32) {
+                rif->vport_base_port = sx_port_id;
+                rif->vport_base_vlan = sx_vlan_id;
+            }
+            sai_db_field_dirty_mark(rifs_db[sdk_rif_id]);
+        }
+
+        /* RIF stays usable without the counter, its stats report INSUFFICIENT_RESOURCES then */
+        if (SAI_ERR(mlnx_rif_sx_counter_attach(sdk_rif_id))) {
+            SX_LOG_WRN("Router interface %u is created without counters\n", sdk_rif_id);
+        }
+        sai_db_sync_async();
+        sai_db_unlock();
     }
 
     if (SAI_STATUS_SUCCESS ==
@@ -469,6 +666,11 @@ static sai_status_t mlnx_create_router_interface(_Out_ sai_object_id_t      *rif
             status = sdk_to_sai(status);
             goto out;
         }
+
+        sai_db_write_lock();
+        mlnx_rif_db_state_update(sdk_rif_id, &rif_state);
+        sai_db_sync_async();
+        sai_db_unlock();
     }
 
     if (SAI_ROUTER_INTERFACE_TYPE_BRIDGE != type->s32) {
@@ -577,10 +779,11 @@ static sai_status_t mlnx_remove_router_interface(_In_ sai_object_id_t rif_id)
     if (mlnx_rif_obj.field.sub_type != MLNX_RIF_TYPE_BRIDGE) {
         sdk_rif_id = (sx_router_interface_t)mlnx_rif_obj.id.u32;
 
-        if (SX_STATUS_SUCCESS !=
-            (status = sx_api_router_interface_get(gh_sdk, sdk_rif_id, &vrid, &intf_params, &intf_attribs))) {
-            SX_LOG_ERR("Failed to get router interface - %s.\n", SX_STATUS_MSG(status));
-            return sdk_to_sai(status);
+        sai_db_read_lock();
+        status = mlnx_rif_sx_config_get(sdk_rif_id, &vrid, &intf_params, &intf_attribs, &sx_port_id, &sx_vlan_id);
+        sai_db_unlock();
+        if (SAI_ERR(status)) {
+            return status;
         }
 
         status = mlnx_acl_rif_bind_point_clear(rif_id);
@@ -589,6 +792,15 @@ static sai_status_t mlnx_remove_router_interface(_In_ sai_object_id_t rif_id)
             return status;
         }
 
+        sai_db_write_lock();
+        status = mlnx_rif_sx_counter_detach(sdk_rif_id);
+        sai_db_sync_async();
+        sai_db_unlock();
+        if (SAI_ERR(status)) {
+            SX_LOG_EXIT();
+            return status;
+        }
+
         if (SX_STATUS_SUCCESS !=
             (status =
                  sx_api_router_interface_set(gh_sdk, SX_ACCESS_CMD_DELETE, vrid, &intf_params, &intf_attribs,
@@ -597,6 +809,14 @@ static sai_status_t mlnx_remove_router_interface(_In_ sai_object_id_t rif_id)
             return sdk_to_sai(status);
         }
 
+        if (sdk_rif_id < MAX_RIFS) {
+            sai_db_write_lock();
+            memset(&g_sai_db_ptr->rifs_db[sdk_rif_id], 0, sizeof(g_sai_db_ptr->rifs_db[sdk_rif_id]));
+            sai_db_field_dirty_mark(rifs_db[sdk_rif_id]);
+            sai_db_sync_async();
+            sai_db_unlock();
+        }
+
         if (SX_L2_INTERFACE_TYPE_PORT_VLAN == intf_params.type) {
             is_port_or_sub_port = true;
             sx_port_id          = intf_params.ifc.port_vlan.port;
@@ -606,12 +826,6 @@ static sai_status_t mlnx_remove_router_interface(_In_ sai_object_id_t rif_id)
             is_port_or_sub_port = true;
             sx_vport_id         = intf_params.ifc.vport.vport;
 
-            status = sx_api_port_vport_base_get(gh_sdk, sx_vport_id, &sx_vlan_id, &sx_port_id);
-            if (SX_ERR(status)) {
-                SX_LOG_ERR("Failed to get base port and vlan for vport %x - %s\n", sx_vport_id, SX_STATUS_MSG(status));
-                return sdk_to_sai(status);
-            }
-
             status = mlnx_bridge_sx_vport_delete(sx_port_id, sx_vlan_id, sx_vport_id);
             if (SX_ERR(status)) {
                 return sdk_to_sai(status);
@@ -762,6 +976,32 @@ static sai_status_t mlnx_rif_attr_to_sdk(sai_router_interface_attr_t  attr,
     return SAI_STATUS_SUCCESS;
 }
 
+static sai_status_t mlnx_rif_sx_attr_apply(_In_ sx_router_interface_t              rif_id,
+                                           _In_ sx_router_id_t                     vrid,
+                                           _In_ bool                               is_admin_state,
+                                           _In_ sx_router_interface_param_t       *intf_params,
+                                           _In_ sx_interface_attributes_t         *intf_attribs,
+                                           _In_ const sx_router_interface_state_t *rif_state)
+{
+    sx_status_t status;
+
+    if (is_admin_state) {
+        status = sx_api_router_interface_state_set(gh_sdk, rif_id, rif_state);
+        if (SX_ERR(status)) {
+            SX_LOG_ERR("Failed to set router interface state - %s.\n", SX_STATUS_MSG(status));
+            return sdk_to_sai(status);
+        }
+    } else {
+        status = sx_api_router_interface_set(gh_sdk, SX_ACCESS_CMD_EDIT, vrid, intf_params, intf_attribs, &rif_id);
+        if (SX_ERR(status)) {
+            SX_LOG_ERR("Failed to set router interface - %s.\n", SX_STATUS_MSG(status));
+            return sdk_to_sai(status);
+        }
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
 /* MAC Address [sai_mac_t] */
 /* MTU [uint32_t] */
 /* Admin State V4, V6 [bool] */
@@ -773,8 +1013,11 @@ static sai_status_t mlnx_rif_attrib_set(_In_ const sai_object_key_t      *key,
     sx_router_interface_state_t rif_state;
     sx_router_interface_param_t intf_params;
     sx_interface_attributes_t   intf_attribs;
+    sx_port_log_id_t            sx_port_id;
+    sx_vlan_id_t                sx_vlan_id;
     sx_status_t                 status;
     sx_router_interface_t       rif_id;
+    mlnx_rif_db_t              *rif;
     bool                        is_admin_state;
     mlnx_object_id_t            mlnx_rif_id = { 0 };
     sai_router_interface_attr_t attr        = (sai_router_interface_attr_t)arg;
@@ -815,42 +1058,52 @@ static sai_status_t mlnx_rif_attrib_set(_In_ const sai_object_key_t      *key,
         vrid   = br_rif->vrf_id;
 
         sai_db_unlock();
+
+        status = mlnx_rif_sx_attr_apply(rif_id, vrid, is_admin_state, &intf_params, &intf_attribs, &rif_state);
+        if (SAI_ERR(status)) {
+            return status;
+        }
     } else {
         rif_id = (sx_router_interface_t)mlnx_rif_id.id.u32;
 
+        /* Edit is built from the DB, so no read back from SDK is needed */
+        sai_db_write_lock();
+
         if (is_admin_state) {
-            status = sx_api_router_interface_state_get(gh_sdk, rif_id, &rif_state);
-            if (SX_ERR(status)) {
-                SX_LOG_ERR("Failed to get router interface state - %s.\n", SX_STATUS_MSG(status));
-                return sdk_to_sai(status);
-            }
+            status = mlnx_rif_sx_state_get(rif_id, &rif_state);
         } else {
-            status = sx_api_router_interface_get(gh_sdk, rif_id, &vrid, &intf_params, &intf_attribs);
-            if (SX_ERR(status)) {
-                SX_LOG_ERR("Failed to get router interface - %s.\n", SX_STATUS_MSG(status));
-                return sdk_to_sai(status);
-            }
+            status = mlnx_rif_sx_config_get(rif_id, &vrid, &intf_params, &intf_attribs, &sx_port_id, &sx_vlan_id);
+        }
+        if (SAI_ERR(status)) {
+            sai_db_unlock();
+            return status;
         }
 
         status = mlnx_rif_attr_to_sdk(attr, value, &intf_attribs, &intf_params, &rif_state);
         if (SAI_ERR(status)) {
             SX_LOG_ERR("Failed to convert rif params from SAI attr\n");
+            sai_db_unlock();
             return status;
         }
-    }
 
-    if (is_admin_state) {
-        status = sx_api_router_interface_state_set(gh_sdk, rif_id, &rif_state);
-        if (SX_ERR(status)) {
-            SX_LOG_ERR("Failed to set router interface state - %s.\n", SX_STATUS_MSG(status));
-            return sdk_to_sai(status);
+        status = mlnx_rif_sx_attr_apply(rif_id, vrid, is_admin_state, &intf_params, &intf_attribs, &rif_state);
+        if (SAI_ERR(status)) {
+            sai_db_unlock();
+            return status;
         }
-    } else {
-        status = sx_api_router_interface_set(gh_sdk, SX_ACCESS_CMD_EDIT, vrid, &intf_params, &intf_attribs, &rif_id);
-        if (SX_ERR(status)) {
-            SX_LOG_ERR("Failed to set router interface - %s.\n", SX_STATUS_MSG(status));
-            return sdk_to_sai(status);
+
+        if (is_admin_state) {
+            mlnx_rif_db_state_update(rif_id, &rif_state);
+        } else {
+            rif = mlnx_rif_db_entry(rif_id);
+            if (rif) {
+                rif->intf_attribs = intf_attribs;
+                sai_db_field_dirty_mark(rifs_db[rif_id]);
+            }
         }
+
+        sai_db_sync_async();
+        sai_db_unlock();
     }
 
     SX_LOG_EXIT();
@@ -914,30 +1167,23 @@ static sai_status_t mlnx_rif_attrib_get(_In_ const sai_object_key_t   *key,
     } else {
         rif_id = (sx_router_interface_t)mlnx_rif_id.id.u32;
 
+        sai_db_read_lock();
+
         if (is_admin_state) {
-            status = sx_api_router_interface_state_get(gh_sdk, rif_id, &rif_state);
-            if (SX_ERR(status)) {
-                SX_LOG_ERR("Failed to get router interface state - %s.\n", SX_STATUS_MSG(status));
-                return sdk_to_sai(status);
-            }
+            status = mlnx_rif_sx_state_get(rif_id, &rif_state);
         } else {
-            status = sx_api_router_interface_get(gh_sdk, rif_id, &vrid, &intf_params, &intf_attribs);
-            if (SX_ERR(status)) {
-                SX_LOG_ERR("Failed to get router interface - %s.\n", SX_STATUS_MSG(status));
-                return sdk_to_sai(status);
-            }
+            status = mlnx_rif_sx_config_get(rif_id, &vrid, &intf_params, &intf_attribs, &sx_port_id, &sx_vlan_id);
+        }
 
-            if (SX_L2_INTERFACE_TYPE_VPORT == intf_params.type)
-            {
-                status = sx_api_port_vport_base_get(gh_sdk, intf_params.ifc.vport.vport, &sx_vlan_id, &sx_port_id);
-                if (SX_ERR(status)) {
-                    SX_LOG_ERR("Failed to get base port and vlan for vport %x - %s\n", intf_params.ifc.vport.vport, SX_STATUS_MSG(status));
-                    return sdk_to_sai(status);
-                }
-            } else {
-                sx_port_id = intf_params.ifc.port_vlan.port;
-                sx_vlan_id = intf_params.ifc.vlan.vlan;
-            }
+        sai_db_unlock();
+
+        if (SAI_ERR(status)) {
+            return status;
+        }
+
+        if (!is_admin_state && (SX_L2_INTERFACE_TYPE_VPORT != intf_params.type)) {
+            sx_port_id = intf_params.ifc.port_vlan.port;
+            sx_vlan_id = intf_params.ifc.vlan.vlan;
         }
     }
 
@@ -1025,6 +1271,246 @@ static sai_status_t mlnx_rif_attrib_get(_In_ const sai_object_key_t   *key,
     return SAI_STATUS_SUCCESS;
 }
 
+static sai_status_t mlnx_rif_sx_counter_get(_In_ sai_object_id_t          rif_id,
+                                            _Out_ sx_router_interface_t  *sdk_rif_id,
+                                            _Out_ sx_router_counter_id_t *counter_id)
+{
+    sai_status_t status;
+
+    status = mlnx_rif_oid_to_sdk_rif_id(rif_id, sdk_rif_id);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    sai_db_read_lock();
+
+    if ((*sdk_rif_id < MAX_RIFS) && g_sai_db_ptr->rif_counters_db[*sdk_rif_id].is_unavailable) {
+        SX_LOG_ERR("Router interface %u was created without a counter, stats are not available\n", *sdk_rif_id);
+        sai_db_unlock();
+        return SAI_STATUS_INSUFFICIENT_RESOURCES;
+    }
+
+    if ((*sdk_rif_id >= MAX_RIFS) || !g_sai_db_ptr->rif_counters_db[*sdk_rif_id].is_bound) {
+        SX_LOG_ERR("Router interface %u has no counter bound\n", *sdk_rif_id);
+        sai_db_unlock();
+        return SAI_STATUS_FAILURE;
+    }
+
+    *counter_id = g_sai_db_ptr->rif_counters_db[*sdk_rif_id].counter_id;
+
+    sai_db_unlock();
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/*
+ * Routine Description:
+ *   Get router interface statistics counters.
+ *
+ * Arguments:
+ *    [in] rif_id - router interface id
+ *    [in] number_of_counters - number of counters in the array
+ *    [in] counter_ids - specifies the array of counter ids
+ *    [out] counters - array of resulting counter values.
+ *
+ * Return Values:
+ *    SAI_STATUS_SUCCESS on success
+ *    Failure status code on error
+ */
+static sai_status_t mlnx_get_router_interface_stats(_In_ sai_object_id_t                    rif_id,
+                                                    _In_ uint32_t                           number_of_counters,
+                                                    _In_ const sai_router_interface_stat_t *counter_ids,
+                                                    _Out_ uint64_t                         *counters)
+{
+    sx_router_counter_set_t sx_counters;
+    sx_router_counter_id_t  counter_id;
+    sx_router_interface_t   sdk_rif_id;
+    sx_status_t             sx_status;
+    sai_status_t            status;
+    uint32_t                ii;
+    char                    key_str[MAX_KEY_STR_LEN];
+
+    SX_LOG_ENTER();
+
+    rif_key_to_str(rif_id, key_str);
+    SX_LOG_DBG("Get stats %s\n", key_str);
+
+    if (NULL == counter_ids) {
+        SX_LOG_ERR("NULL counter ids array param\n");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    if (NULL == counters) {
+        SX_LOG_ERR("NULL counters array param\n");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    status = mlnx_rif_sx_counter_get(rif_id, &sdk_rif_id, &counter_id);
+    if (SAI_ERR(status)) {
+        SX_LOG_EXIT();
+        return status;
+    }
+
+    if (!mlnx_counter_rif_get(sdk_rif_id, counter_id, &sx_counters)) {
+        sx_status = sx_api_router_counter_get(gh_sdk, SX_ACCESS_CMD_READ, counter_id, &sx_counters);
+        if (SX_ERR(sx_status)) {
+            SX_LOG_ERR("Failed to get router counter %u - %s.\n", counter_id, SX_STATUS_MSG(sx_status));
+            SX_LOG_EXIT();
+            return sdk_to_sai(sx_status);
+        }
+    }
+
+    for (ii = 0; ii < number_of_counters; ii++) {
+        switch (counter_ids[ii]) {
+        case SAI_ROUTER_INTERFACE_STAT_IN_OCTETS:
+            counters[ii] = sx_counters.router_ingress_good_unicast_bytes +
+                           sx_counters.router_ingress_good_multicast_bytes +
+                           sx_counters.router_ingress_good_broadcast_bytes;
+            break;
+
+        case SAI_ROUTER_INTERFACE_STAT_IN_PACKETS:
+            counters[ii] = sx_counters.router_ingress_good_unicast_packets +
+                           sx_counters.router_ingress_good_multicast_packets +
+                           sx_counters.router_ingress_good_broadcast_packets;
+            break;
+
+        case SAI_ROUTER_INTERFACE_STAT_OUT_OCTETS:
+            counters[ii] = sx_counters.router_egress_good_unicast_bytes +
+                           sx_counters.router_egress_good_multicast_bytes +
+                           sx_counters.router_egress_good_broadcast_bytes;
+            break;
+
+        case SAI_ROUTER_INTERFACE_STAT_OUT_PACKETS:
+            counters[ii] = sx_counters.router_egress_good_unicast_packets +
+                           sx_counters.router_egress_good_multicast_packets +
+                           sx_counters.router_egress_good_broadcast_packets;
+            break;
+
+        case SAI_ROUTER_INTERFACE_STAT_IN_ERROR_OCTETS:
+            counters[ii] = sx_counters.router_ingress_error_bytes;
+            break;
+
+        case SAI_ROUTER_INTERFACE_STAT_IN_ERROR_PACKETS:
+            counters[ii] = sx_counters.router_ingress_error_packets;
+            break;
+
+        case SAI_ROUTER_INTERFACE_STAT_OUT_ERROR_OCTETS:
+            counters[ii] = sx_counters.router_egress_error_bytes;
+            break;
+
+        case SAI_ROUTER_INTERFACE_STAT_OUT_ERROR_PACKETS:
+            counters[ii] = sx_counters.router_egress_error_packets;
+            break;
+
+        default:
+            SX_LOG_ERR("Invalid router interface counter %d\n", counter_ids[ii]);
+            SX_LOG_EXIT();
+            return SAI_STATUS_INVALID_PARAMETER;
+        }
+    }
+
+    SX_LOG_EXIT();
+    return SAI_STATUS_SUCCESS;
+}
+
+/*
+ * Routine Description:
+ *   Clear router interface statistics counters.
+ *   The SDK router counter is cleared as a whole, so all the RIF counters are cleared.
+ *
+ * Arguments:
+ *    [in] rif_id - router interface id
+ *    [in] number_of_counters - number of counters in the array
+ *    [in] counter_ids - specifies the array of counter ids
+ *
+ * Return Values:
+ *    SAI_STATUS_SUCCESS on success
+ *    Failure status code on error
+ */
+static sai_status_t mlnx_clear_router_interface_stats(_In_ sai_object_id_t                    rif_id,
+                                                      _In_ uint32_t                           number_of_counters,
+                                                      _In_ const sai_router_interface_stat_t *counter_ids)
+{
+    sx_router_counter_id_t counter_id;
+    sx_router_interface_t  sdk_rif_id;
+    sx_status_t            sx_status;
+    sai_status_t           status;
+    uint32_t               ii;
+    char                   key_str[MAX_KEY_STR_LEN];
+
+    SX_LOG_ENTER();
+
+    rif_key_to_str(rif_id, key_str);
+    SX_LOG_NTC("Clear stats %s\n", key_str);
+
+    if (NULL == counter_ids) {
+        SX_LOG_ERR("NULL counter ids array param\n");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    for (ii = 0; ii < number_of_counters; ii++) {
+        if (counter_ids[ii] > SAI_ROUTER_INTERFACE_STAT_OUT_ERROR_PACKETS) {
+            SX_LOG_ERR("Invalid router interface counter %d\n", counter_ids[ii]);
+            return SAI_STATUS_INVALID_PARAMETER;
+        }
+    }
+
+    status = mlnx_rif_sx_counter_get(rif_id, &sdk_rif_id, &counter_id);
+    if (SAI_ERR(status)) {
+        SX_LOG_EXIT();
+        return status;
+    }
+
+    sx_status = sx_api_router_counter_clear_set(gh_sdk, counter_id, false);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Failed to clear router counter %u - %s.\n", counter_id, SX_STATUS_MSG(sx_status));
+        SX_LOG_EXIT();
+        return sdk_to_sai(sx_status);
+    }
+
+    mlnx_counter_collector_invalidate();
+
+    SX_LOG_EXIT();
+    return SAI_STATUS_SUCCESS;
+}
+
+/*
+ * Reads the counters of the RIFs with a bound counter for the counter collector in one pass,
+ * ordered by the SDK rif id.
+ * Only the counter ids are taken under the DB lock, the counters are read from SDK after it's released.
+ * A counter that fails to read is marked invalid, the rest are still read.
+ */
+void mlnx_rif_counters_read(_In_ sx_api_handle_t            handle,
+                            _Out_ mlnx_rif_counter_value_t *values,
+                            _In_ uint32_t                   max_count,
+                            _Out_ uint32_t                 *count)
+{
+    sx_status_t sx_status;
+    uint32_t    ii, values_count = 0;
+
+    *count = 0;
+
+    sai_db_read_lock();
+    for (ii = mlnx_bitmap_next_set(g_sai_db_ptr->rif_counters_bound, MAX_RIFS, 0);
+         (ii < MAX_RIFS) && (values_count < max_count);
+         ii = mlnx_bitmap_next_set(g_sai_db_ptr->rif_counters_bound, MAX_RIFS, ii + 1)) {
+        values[values_count].rif_id     = (sx_router_interface_t)ii;
+        values[values_count].counter_id = g_sai_db_ptr->rif_counters_db[ii].counter_id;
+        values_count++;
+    }
+    sai_db_unlock();
+
+    for (ii = 0; ii < values_count; ii++) {
+        sx_status = sx_api_router_counter_get(handle, SX_ACCESS_CMD_READ, values[ii].counter_id, &values[ii].value);
+        values[ii].is_valid = !SX_ERR(sx_status);
+        if (!values[ii].is_valid) {
+            SX_LOG_ERR("Failed to get router counter %u - %s.\n", values[ii].counter_id, SX_STATUS_MSG(sx_status));
+        }
+    }
+
+    *count = values_count;
+}
+
 sai_status_t mlnx_rif_log_set(sx_verbosity_level_t level)
 {
     LOG_VAR_NAME(__MODULE__) = level;
@@ -1032,9 +1518,13 @@ sai_status_t mlnx_rif_log_set(sx_verbosity_level_t level)
     return SAI_STATUS_SUCCESS;
 }
 
-const sai_router_interface_api_t mlnx_router_interface_api = {
-    mlnx_create_router_interface,
-    mlnx_remove_router_interface,
-    mlnx_set_router_interface_attribute,
-    mlnx_get_router_interface_attribute,
+const mlnx_router_interface_ext_api_t mlnx_router_interface_api = {
+    {
+        mlnx_create_router_interface,
+        mlnx_remove_router_interface,
+        mlnx_set_router_interface_attribute,
+        mlnx_get_router_interface_attribute,
+    },
+    mlnx_get_router_interface_stats,
+    mlnx_clear_router_interface_stats,
 };
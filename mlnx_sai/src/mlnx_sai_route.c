@@ -112,25 +112,17 @@ static sai_status_t mlnx_fill_route_data(sx_uc_route_data_t      *route_data,
     sai_status_t  status;
     sx_ecmp_id_t  sdk_ecmp_id;
     sx_next_hop_t sdk_next_hop;
-    uint32_t      sdk_next_hop_cnt;
     uint32_t      port_data;
 
     SX_LOG_ENTER();
 
     if (SAI_OBJECT_TYPE_NEXT_HOP == sai_object_type_query(oid)) {
-        if (SAI_STATUS_SUCCESS != (status = mlnx_object_to_type(oid, SAI_OBJECT_TYPE_NEXT_HOP, &sdk_ecmp_id, NULL))) {
+        if (SAI_STATUS_SUCCESS != (status = mlnx_nhop_oid_validate(oid, &sdk_ecmp_id))) {
             return status;
         }
 
-        /* ECMP container should contains exactly 1 next hop */
-        sdk_next_hop_cnt = 1;
-        memset(&sdk_next_hop, 0, sizeof(sdk_next_hop));
-        if (SX_STATUS_SUCCESS !=
-            (status = sx_api_router_ecmp_get(gh_sdk, sdk_ecmp_id, &sdk_next_hop, &sdk_next_hop_cnt))) {
-            SX_LOG_ERR("Failed to get ecmp - %s.\n", SX_STATUS_MSG(status));
-            return sdk_to_sai(status);
-        }
-        if (1 != sdk_next_hop_cnt) {
+        /* ECMP container contains exactly 1 next hop, shadowed by the next hop cache */
+        if (SAI_STATUS_SUCCESS != (status = mlnx_nhop_get_by_ecmp_id(sdk_ecmp_id, &sdk_next_hop))) {
             SX_LOG_ERR("Invalid next hop object\n");
             return SAI_STATUS_INVALID_ATTR_VALUE_0 + next_hop_param_index;
         }
@@ -139,7 +131,7 @@ static sai_status_t mlnx_fill_route_data(sx_uc_route_data_t      *route_data,
             route_data->next_hop_cnt           = 0;
             route_data->uc_route_param.ecmp_id = sdk_ecmp_id;
         } else {
-            route_data->next_hop_cnt           = sdk_next_hop_cnt;
+            route_data->next_hop_cnt           = 1;
             route_data->uc_route_param.ecmp_id = SX_ROUTER_ECMP_ID_INVALID;
         }
         route_data->next_hop_list_p[0].version =
@@ -215,9 +207,9 @@ static sai_status_t mlnx_fill_route_data(sx_uc_route_data_t      *route_data,
  * Note: IP prefix/mask expected in Network Byte Order.
  *
  */
-static sai_status_t mlnx_create_route(_In_ const sai_route_entry_t* route_entry,
-                                      _In_ uint32_t                 attr_count,
-                                      _In_ const sai_attribute_t   *attr_list)
+static sai_status_t mlnx_create_route_impl(_In_ const sai_route_entry_t* route_entry,
+                                           _In_ uint32_t                 attr_count,
+                                           _In_ const sai_attribute_t   *attr_list)
 {
     sx_status_t                  status;
     const sai_attribute_value_t *action, *priority, *next_hop;
@@ -307,7 +299,8 @@ static sai_status_t mlnx_create_route(_In_ const sai_route_entry_t* route_entry,
 
     if (SX_STATUS_SUCCESS !=
         (status =
-             sx_api_router_uc_route_set(gh_sdk, SX_ACCESS_CMD_ADD, vrid, &ip_prefix, &route_data))) {
+             MLNX_PERF_SDK_CALL(sx_api_router_uc_route_set(gh_sdk, SX_ACCESS_CMD_ADD, vrid, &ip_prefix,
+                                                           &route_data)))) {
         SX_LOG_ERR("Failed to set route - %s.\n", SX_STATUS_MSG(status));
         return sdk_to_sai(status);
     }
@@ -316,6 +309,19 @@ static sai_status_t mlnx_create_route(_In_ const sai_route_entry_t* route_entry,
     return SAI_STATUS_SUCCESS;
 }
 
+static sai_status_t mlnx_create_route(_In_ const sai_route_entry_t* route_entry,
+                                      _In_ uint32_t                 attr_count,
+                                      _In_ const sai_attribute_t   *attr_list)
+{
+    sai_status_t status;
+
+    mlnx_perf_op_begin(SAI_OBJECT_TYPE_ROUTE_ENTRY, MLNX_PERF_OP_CREATE);
+    status = mlnx_create_route_impl(route_entry, attr_count, attr_list);
+    mlnx_perf_op_end(status);
+
+    return status;
+}
+
 /*
  * Routine Description:
  *    Remove Route
@@ -329,7 +335,7 @@ static sai_status_t mlnx_create_route(_In_ const sai_route_entry_t* route_entry,
  *
  * Note: IP prefix/mask expected in Network Byte Order.
  */
-static sai_status_t mlnx_remove_route(_In_ const sai_route_entry_t* route_entry)
+static sai_status_t mlnx_remove_route_impl(_In_ const sai_route_entry_t* route_entry)
 {
     sx_status_t    status;
     sx_ip_prefix_t ip_prefix;
@@ -355,7 +361,7 @@ static sai_status_t mlnx_remove_route(_In_ const sai_route_entry_t* route_entry)
 
     if (SX_STATUS_SUCCESS !=
         (status =
-             sx_api_router_uc_route_set(gh_sdk, SX_ACCESS_CMD_DELETE, vrid, &ip_prefix, NULL))) {
+             MLNX_PERF_SDK_CALL(sx_api_router_uc_route_set(gh_sdk, SX_ACCESS_CMD_DELETE, vrid, &ip_prefix, NULL)))) {
         SX_LOG_ERR("Failed to remove route - %s.\n", SX_STATUS_MSG(status));
         return sdk_to_sai(status);
     }
@@ -364,6 +370,17 @@ static sai_status_t mlnx_remove_route(_In_ const sai_route_entry_t* route_entry)
     return SAI_STATUS_SUCCESS;
 }
 
+static sai_status_t mlnx_remove_route(_In_ const sai_route_entry_t* route_entry)
+{
+    sai_status_t status;
+
+    mlnx_perf_op_begin(SAI_OBJECT_TYPE_ROUTE_ENTRY, MLNX_PERF_OP_REMOVE);
+    status = mlnx_remove_route_impl(route_entry);
+    mlnx_perf_op_end(status);
+
+    return status;
+}
+
 /*
  * Routine Description:
  *    Set route attribute value
@@ -576,16 +593,17 @@ static sai_status_t mlnx_modify_route(sx_router_id_t           vrid,
     /* Delete and Add for action/priority, or Set for next hops changes */
     if (SX_ACCESS_CMD_ADD == cmd) {
         if (SX_STATUS_SUCCESS !=
-            (status = sx_api_router_uc_route_set(gh_sdk, SX_ACCESS_CMD_DELETE, vrid,
-                                                 &route_get_entry->network_addr, &route_get_entry->route_data))) {
+            (status = MLNX_PERF_SDK_CALL(sx_api_router_uc_route_set(gh_sdk, SX_ACCESS_CMD_DELETE, vrid,
+                                                                    &route_get_entry->network_addr,
+                                                                    &route_get_entry->route_data)))) {
             SX_LOG_ERR("Failed to delete route - %s.\n", SX_STATUS_MSG(status));
             return sdk_to_sai(status);
         }
     }
 
     if (SX_STATUS_SUCCESS !=
-        (status = sx_api_router_uc_route_set(gh_sdk, cmd, vrid,
-                                             &route_get_entry->network_addr, &route_get_entry->route_data))) {
+        (status = MLNX_PERF_SDK_CALL(sx_api_router_uc_route_set(gh_sdk, cmd, vrid, &route_get_entry->network_addr,
+                                                                &route_get_entry->route_data)))) {
         SX_LOG_ERR("Failed to set route - %s.\n", SX_STATUS_MSG(status));
         return sdk_to_sai(status);
     }
@@ -273,13 +273,13 @@ static sai_status_t mlnx_remove_virtual_router(_In_ sai_object_id_t vr_id)
     }
     vrid = (sx_router_id_t)data;
 
-    cl_plock_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_read_lock();
     if (vr_id == g_sai_db_ptr->default_vrid) {
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
         SX_LOG_ERR("Can't delete the default router\n");
         return SAI_STATUS_OBJECT_IN_USE;
     }
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_unlock();
 
     if (SX_STATUS_SUCCESS != (status = sx_api_router_set(gh_sdk, SX_ACCESS_CMD_DELETE, NULL, &vrid))) {
         SX_LOG_ERR("Failed to delete router - %s.\n", SX_STATUS_MSG(status));
@@ -88,85 +88,53 @@ static void samplepacket_key_to_str(_In_ const sai_object_id_t sai_samplepacket_
     SX_LOG_EXIT();
 }
 
-static sai_status_t mlnx_samplepacket_sample_rate_validate(_In_ const uint32_t internal_samplepacket_obj_idx)
+#define samplepacket_ports_map(obj_idx) (g_sai_db_ptr->mlnx_samplepacket_session[obj_idx].ports_map)
+
+#define samplepacket_bound_ports_foreach(obj_idx, port, idx) \
+    for (idx = mlnx_bitmap_next_set(samplepacket_ports_map(obj_idx), MAX_PORTS * 2, 0); \
+         idx < (MAX_PORTS * 2) && (port = &mlnx_ports_db[idx]); \
+         idx = mlnx_bitmap_next_set(samplepacket_ports_map(obj_idx), MAX_PORTS * 2, idx + 1)) \
+        if (port->is_present && port->logical && \
+            (port->internal_ingress_samplepacket_obj_idx == obj_idx))
+
+static void samplepacket_port_ref_set(_In_ uint32_t obj_idx, _In_ uint32_t port_idx, _In_ bool is_set)
 {
-    mlnx_port_config_t    *port_config;
-    uint32_t               index             = 0;
-    uint32_t               value_sample_rate = 0;
-    sx_port_sflow_params_t sdk_sflow_params;
-    sai_status_t           status = SAI_STATUS_FAILURE;
+    uint32_t *word;
 
-    assert(NULL != g_sai_db_ptr);
+    if ((MLNX_INVALID_SAMPLEPACKET_SESSION == obj_idx) || (obj_idx >= MLNX_SAMPLEPACKET_SESSION_MAX)) {
+        return;
+    }
 
-    /* caller of this function should use read lock to guard the callsite */
+    word = &g_sai_db_ptr->mlnx_samplepacket_session[obj_idx].ports_map[port_idx / 32];
 
-    value_sample_rate = g_sai_db_ptr->mlnx_samplepacket_session[internal_samplepacket_obj_idx].sai_sample_rate;
-
-    mlnx_port_foreach(port_config, index) {
-        if (internal_samplepacket_obj_idx == port_config->internal_ingress_samplepacket_obj_idx) {
-            if (SAI_STATUS_SUCCESS !=
-                (status =
-                     (sdk_to_sai(sx_api_port_sflow_get(gh_sdk, port_config->logical, &sdk_sflow_params))))) {
-                SX_LOG_ERR("Error getting sflow params for sdk port id %d with internal samplepacket obj id %d\n",
-                           port_config->logical,
-                           internal_samplepacket_obj_idx);
-                goto cleanup;
-            }
-
-            if (sdk_sflow_params.ratio != value_sample_rate) {
-                SX_LOG_ERR("Error: sdk sflow params ratio %d does not equal to internal sai sample rate %d\n",
-                           sdk_sflow_params.ratio,
-                           value_sample_rate);
-                status = SAI_STATUS_FAILURE;
-                goto cleanup;
-            }
-
-            if (0 != sdk_sflow_params.deviation) {
-                SX_LOG_ERR("Error: sdk sflow params deviation %d does not equal to %d\n", sdk_sflow_params.deviation,
-                           0);
-                status = SAI_STATUS_FAILURE;
-                goto cleanup;
-            }
-
-            if (true != sdk_sflow_params.packet_types.uc) {
-                SX_LOG_ERR("Error: sdk sflow params packet type uc %d does not equal to %d\n",
-                           sdk_sflow_params.packet_types.uc,
-                           true);
-            }
-
-            if (true != sdk_sflow_params.packet_types.mc) {
-                SX_LOG_ERR("Error: sdk sflow params packet type mc %d does not equal to %d\n",
-                           sdk_sflow_params.packet_types.mc,
-                           true);
-            }
-
-            if (true != sdk_sflow_params.packet_types.bc) {
-                SX_LOG_ERR("Error: sdk sflow params packet type bc %d does not equal to %d\n",
-                           sdk_sflow_params.packet_types.bc,
-                           true);
-            }
-
-            if (true != sdk_sflow_params.packet_types.uuc) {
-                SX_LOG_ERR("Error: sdk sflow params packet type uuc %d does not equal to %d\n",
-                           sdk_sflow_params.packet_types.uuc,
-                           true);
-            }
-
-            if (true != sdk_sflow_params.packet_types.umc) {
-                SX_LOG_ERR("Error: sdk sflow params packet type umc %d does not equal to %d\n",
-                           sdk_sflow_params.packet_types.umc,
-                           true);
-            }
-
-            SX_LOG_DBG("Verified sflow params for sdk port id %d\n", port_config->logical);
-        }
+    if (is_set) {
+        *word |= 1u << (port_idx % 32);
+    } else {
+        *word &= ~(1u << (port_idx % 32));
     }
+    sai_db_dirty_mark(word, sizeof(*word));
+}
 
-    status = SAI_STATUS_SUCCESS;
+/*
+ * Move the port from the old to the new session in the session->ports index.
+ * (DB write lock is needed)
+ */
+void mlnx_samplepacket_port_ref_update(_In_ uint32_t                  old_idx,
+                                       _In_ uint32_t                  new_idx,
+                                       _In_ const mlnx_port_config_t *port)
+{
+    uint32_t port_idx;
 
-cleanup:
-    SX_LOG_EXIT();
-    return status;
+    assert(port);
+
+    if (old_idx == new_idx) {
+        return;
+    }
+
+    port_idx = mlnx_port_idx_get(port);
+
+    samplepacket_port_ref_set(old_idx, port_idx, false);
+    samplepacket_port_ref_set(new_idx, port_idx, true);
 }
 
 static sai_status_t mlnx_samplepacket_sample_rate_get(_In_ const sai_object_key_t   *key,
@@ -193,6 +161,7 @@ static sai_status_t mlnx_samplepacket_sample_rate_get(_In_ const sai_object_key_
 
     sai_db_read_lock();
 
+    /* Bound ports are programmed from this value only, no need to read them back */
     if (g_sai_db_ptr->mlnx_samplepacket_session[internal_samplepacket_obj_idx].in_use) {
         value->u32 = g_sai_db_ptr->mlnx_samplepacket_session[internal_samplepacket_obj_idx].sai_sample_rate;
     } else {
@@ -201,14 +170,6 @@ static sai_status_t mlnx_samplepacket_sample_rate_get(_In_ const sai_object_key_
         goto cleanup;
     }
 
-    if (SAI_STATUS_SUCCESS !=
-        (status = mlnx_samplepacket_sample_rate_validate(internal_samplepacket_obj_idx))) {
-        SX_LOG_ERR("Error validating sample rate for internal samplepacket obj idx: %d\n",
-                   internal_samplepacket_obj_idx);
-        status = SAI_STATUS_FAILURE;
-        goto cleanup;
-    }
-
     status = SAI_STATUS_SUCCESS;
 
 cleanup:
@@ -303,8 +264,11 @@ static sai_status_t mlnx_samplepacket_sample_rate_set(_In_ const sai_object_key_
 {
     sai_status_t           status = SAI_STATUS_FAILURE;
     mlnx_port_config_t    *port_config;
+    mlnx_samplepacket_t   *session;
     uint32_t               internal_samplepacket_obj_idx = 0;
     uint32_t               index                         = 0;
+    uint32_t               failed_index;
+    uint32_t               prev_sample_rate;
     sx_port_sflow_params_t sdk_sflow_params;
 
     memset(&sdk_sflow_params, 0, sizeof(sx_port_sflow_params_t));
@@ -323,42 +287,68 @@ static sai_status_t mlnx_samplepacket_sample_rate_set(_In_ const sai_object_key_
 
     sai_db_write_lock();
 
-    if (g_sai_db_ptr->mlnx_samplepacket_session[internal_samplepacket_obj_idx].in_use) {
-        g_sai_db_ptr->mlnx_samplepacket_session[internal_samplepacket_obj_idx].sai_sample_rate = value->u32;
-    } else {
+    session = &g_sai_db_ptr->mlnx_samplepacket_session[internal_samplepacket_obj_idx];
+
+    if (!session->in_use) {
         SX_LOG_ERR("Non-exist internal samplepacket obj idx: %d\n", internal_samplepacket_obj_idx);
         status = SAI_STATUS_INVALID_OBJECT_ID;
         goto cleanup;
     }
 
-    mlnx_port_foreach(port_config, index) {
-        if (internal_samplepacket_obj_idx == port_config->internal_ingress_samplepacket_obj_idx) {
-            sdk_sflow_params.ratio            = value->u32;
-            sdk_sflow_params.deviation        = 0;
-            sdk_sflow_params.packet_types.uc  = true;
-            sdk_sflow_params.packet_types.mc  = true;
-            sdk_sflow_params.packet_types.bc  = true;
-            sdk_sflow_params.packet_types.uuc = true;
-            sdk_sflow_params.packet_types.umc = true;
-
-            if (SAI_STATUS_SUCCESS !=
-                (status =
-                     (sdk_to_sai(sx_api_port_sflow_set(gh_sdk, SX_ACCESS_CMD_EDIT,
-                                                       port_config->logical,
-                                                       &sdk_sflow_params))))) {
-                SX_LOG_ERR("Error updating sflow params for sdk port id %d with internal samplepacket obj idx %d\n",
-                           port_config->logical,
-                           internal_samplepacket_obj_idx);
-                goto cleanup;
-            }
-
-            SX_LOG_NTC("Updated sflow params for sdk port id %d with internal samplepacket obj idx %d\n",
+    if (session->sai_sample_rate == value->u32) {
+        status = SAI_STATUS_SUCCESS;
+        goto cleanup;
+    }
+
+    prev_sample_rate         = session->sai_sample_rate;
+    session->sai_sample_rate = value->u32;
+
+    /* Same params for every bound port, built once from the DB */
+    sdk_sflow_params.ratio            = value->u32;
+    sdk_sflow_params.deviation        = 0;
+    sdk_sflow_params.packet_types.uc  = true;
+    sdk_sflow_params.packet_types.mc  = true;
+    sdk_sflow_params.packet_types.bc  = true;
+    sdk_sflow_params.packet_types.uuc = true;
+    sdk_sflow_params.packet_types.umc = true;
+
+    samplepacket_bound_ports_foreach(internal_samplepacket_obj_idx, port_config, index) {
+        if (SAI_STATUS_SUCCESS !=
+            (status =
+                 (sdk_to_sai(sx_api_port_sflow_set(gh_sdk, SX_ACCESS_CMD_EDIT,
+                                                   port_config->logical,
+                                                   &sdk_sflow_params))))) {
+            SX_LOG_ERR("Error updating sflow params for sdk port id %d with internal samplepacket obj idx %d\n",
                        port_config->logical,
                        internal_samplepacket_obj_idx);
+            failed_index = index;
+            goto rollback;
         }
+
+        SX_LOG_DBG("Updated sflow params for sdk port id %d with internal samplepacket obj idx %d\n",
+                   port_config->logical,
+                   internal_samplepacket_obj_idx);
     }
 
+    SX_LOG_NTC("Updated sample rate of internal samplepacket obj idx %d to %u\n",
+               internal_samplepacket_obj_idx, value->u32);
+
     status = SAI_STATUS_SUCCESS;
+    goto cleanup;
+
+rollback:
+    /* Ports updated so far go back to the previous rate so that the DB stays the source of truth */
+    session->sai_sample_rate = prev_sample_rate;
+    sdk_sflow_params.ratio   = prev_sample_rate;
+    samplepacket_bound_ports_foreach(internal_samplepacket_obj_idx, port_config, index) {
+        if (index >= failed_index) {
+            break;
+        }
+
+        if (SX_ERR(sx_api_port_sflow_set(gh_sdk, SX_ACCESS_CMD_EDIT, port_config->logical, &sdk_sflow_params))) {
+            SX_LOG_ERR("Failed to restore sflow params for sdk port id %d\n", port_config->logical);
+        }
+    }
 
 cleanup:
     sai_db_unlock();
@@ -530,14 +520,12 @@ static sai_status_t mlnx_remove_samplepacket_session(_In_ const sai_object_id_t
 
     sai_db_write_lock();
 
-    mlnx_port_foreach(port_config, index) {
-        if (internal_samplepacket_obj_idx == port_config->internal_ingress_samplepacket_obj_idx) {
-            SX_LOG_ERR(
-                "Please disassociate sdk port id %d with internal samplepacket obj id %d before removing samplepacket obj idx\n",
-                port_config->logical,
-                internal_samplepacket_obj_idx);
-            port_associated = true;
-        }
+    samplepacket_bound_ports_foreach(internal_samplepacket_obj_idx, port_config, index) {
+        SX_LOG_ERR(
+            "Please disassociate sdk port id %d with internal samplepacket obj id %d before removing samplepacket obj idx\n",
+            port_config->logical,
+            internal_samplepacket_obj_idx);
+        port_associated = true;
     }
 
     if (port_associated) {
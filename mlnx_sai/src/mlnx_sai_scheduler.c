@@ -216,64 +216,63 @@ static void ets_element_dump(sx_port_log_id_t port_log_id, sx_cos_ets_element_co
                ets->next_element_index);
 }
 
-static sai_status_t ets_element_update(sx_port_log_id_t port_log_id, sx_cos_ets_element_config_t *ets, char *name)
+/*
+ * Elements' parent (next_element_index) is taken from the port's scheduling hierarchy
+ * shadow (mlnx_sched_obj_t.next_index), which is kept in sync with the SDK on every
+ * topology change, so there is no need to read back the whole ETS list.
+ */
+static sai_status_t ets_element_update(sx_port_log_id_t             port_log_id,
+                                       sx_cos_ets_element_config_t *ets,
+                                       uint32_t                     count,
+                                       char                        *name)
 {
-    sx_cos_ets_element_config_t *ets_list;
-    uint32_t                     max_ets_count = MAX_ETS_ELEMENTS;
-    sai_status_t                 status;
-    uint32_t                     ii;
+    sx_status_t status;
+    uint32_t    ii;
 
-    ets_list = (sx_cos_ets_element_config_t*)malloc(sizeof(*ets_list) * MAX_ETS_ELEMENTS);
-    if (!ets_list) {
-        SX_LOG_ERR("Failed to allocate ETS list\n");
-        return SAI_STATUS_NO_MEMORY;
+    if (!count) {
+        return SAI_STATUS_SUCCESS;
     }
 
-    status = sx_api_cos_port_ets_element_get(gh_sdk, port_log_id, ets_list, &max_ets_count);
-    if (status != SX_STATUS_SUCCESS) {
-        SX_LOG_ERR("Failed get ETS list - %s\n", SX_STATUS_MSG(status));
-        status = sdk_to_sai(status);
-        goto out;
+    for (ii = 0; ii < count; ii++) {
+        ets_element_dump(port_log_id, &ets[ii]);
     }
 
-    for (ii = 0; ii < MAX_ETS_ELEMENTS; ii++) {
-        if ((ets_list[ii].element_index == ets->element_index) &&
-            (ets_list[ii].element_hierarchy == ets->element_hierarchy)) {
-            ets->next_element_index = ets_list[ii].next_element_index;
-            break;
-        }
-    }
-
-    ets_element_dump(port_log_id, ets);
-
     status = sx_api_cos_port_ets_element_set(gh_sdk, SX_ACCESS_CMD_EDIT,
-                                             port_log_id, ets, 1);
+                                             port_log_id, ets, count);
 
     if (status != SX_STATUS_SUCCESS) {
         SX_LOG_ERR("Failed to apply scheduler on %s - %s.\n",
                    name, SX_STATUS_MSG(status));
-        status = sdk_to_sai(status);
-        goto out;
+        return sdk_to_sai(status);
     }
 
-out:
-    free(ets_list);
-    return status;
+    return SAI_STATUS_SUCCESS;
+}
+
+static void sched_obj_ets_fill(sx_cos_ets_element_config_t *ets, mlnx_sched_obj_t *obj)
+{
+    ets->element_hierarchy  = obj->ets_type;
+    ets->element_index      = obj->index;
+    ets->next_element_index = (obj->next_index == INVALID_INDEX) ? 0 : obj->next_index;
+}
+
+static void queue_ets_fill(sx_cos_ets_element_config_t *ets, mlnx_sched_obj_t *obj)
+{
+    sched_obj_ets_fill(ets, obj);
+    ets->min_shaper_enable = TRUE;
+    ets->max_shaper_enable = TRUE;
 }
 
 static sai_status_t queue_update_ets(sx_port_log_id_t             port_log_id,
                                      sx_cos_ets_element_config_t *ets,
                                      mlnx_sched_obj_t            *obj)
 {
-    ets->element_hierarchy = obj->ets_type;
-    ets->element_index     = obj->index;
-    ets->min_shaper_enable = TRUE;
-    ets->max_shaper_enable = TRUE;
+    queue_ets_fill(ets, obj);
 
-    return ets_element_update(port_log_id, ets, "queue");
+    return ets_element_update(port_log_id, ets, 1, "queue");
 }
 
-static sai_status_t port_update_ets(sx_port_log_id_t port_log_id, sx_cos_ets_element_config_t *ets)
+static sai_status_t port_ets_fill(sx_cos_ets_element_config_t *ets)
 {
     if (ets->min_shaper_rate > 0) {
         SX_LOG_ERR("Min bandwidth rate can't be used on the port\n");
@@ -288,34 +287,32 @@ static sai_status_t port_update_ets(sx_port_log_id_t port_log_id, sx_cos_ets_ele
     ets->dwrr               = FALSE;
     ets->dwrr_enable        = FALSE;
 
-    return ets_element_update(port_log_id, ets, "port");
+    return SAI_STATUS_SUCCESS;
 }
 
-static sai_status_t group_update_ets(sx_port_log_id_t             port_log_id,
-                                     sx_cos_ets_element_config_t *ets,
-                                     uint8_t                      level,
-                                     uint8_t                      index)
+static sai_status_t port_update_ets(sx_port_log_id_t port_log_id, sx_cos_ets_element_config_t *ets)
 {
-    ets->element_hierarchy = level + 1;
-    ets->element_index     = index;
+    sai_status_t status;
 
-    /* The following are SDK limitations */
-    if (level == 0) {
-        ets->min_shaper_enable = FALSE;
-        ets->max_shaper_enable = FALSE;
+    status = port_ets_fill(ets);
+    if (SAI_ERR(status)) {
+        return status;
     }
-    return ets_element_update(port_log_id, ets, "group");
+
+    return ets_element_update(port_log_id, ets, 1, "port");
 }
 
 /* DB read lock is required */
-static sai_status_t scheduler_to_group_apply(sai_object_id_t  scheduler_id,
-                                             sx_port_log_id_t port_id,
-                                             uint8_t          level,
-                                             uint8_t          index)
+static sai_status_t scheduler_to_group_ets(sai_object_id_t              scheduler_id,
+                                           uint8_t                      level,
+                                           uint8_t                      index,
+                                           mlnx_sched_obj_t            *obj,
+                                           sx_cos_ets_element_config_t *ets)
 {
-    sx_cos_ets_element_config_t ets = {0};
-    sai_status_t                status;
-    mlnx_sched_profile_t       *sched;
+    sai_status_t          status;
+    mlnx_sched_profile_t *sched;
+
+    memset(ets, 0, sizeof(*ets));
 
     if (scheduler_id != SAI_NULL_OBJECT_ID) {
         status = sched_db_entry_get(scheduler_id, &sched);
@@ -328,36 +325,78 @@ static sai_status_t scheduler_to_group_apply(sai_object_id_t  scheduler_id,
             return SAI_STATUS_INVALID_PARAMETER;
         }
 
-        memcpy(&ets, &sched->ets, sizeof(ets));
-        sai_to_sdk_rate(sched->min_rate, sched->max_rate, &ets);
+        memcpy(ets, &sched->ets, sizeof(*ets));
+        sai_to_sdk_rate(sched->min_rate, sched->max_rate, ets);
     } else {
-        sai_to_sdk_rate(0, 0, &ets);
+        sai_to_sdk_rate(0, 0, ets);
     }
 
-    return group_update_ets(port_id, &ets, level, index);
+    ets->element_hierarchy  = level + 1;
+    ets->element_index      = index;
+    ets->next_element_index = (obj->next_index == INVALID_INDEX) ? 0 : obj->next_index;
+
+    /* The following are SDK limitations */
+    if (level == 0) {
+        ets->min_shaper_enable = FALSE;
+        ets->max_shaper_enable = FALSE;
+    }
+
+    return SAI_STATUS_SUCCESS;
 }
 
+/* DB read lock is required */
+static sai_status_t scheduler_to_group_apply(sai_object_id_t   scheduler_id,
+                                             sx_port_log_id_t  port_id,
+                                             uint8_t           level,
+                                             uint8_t           index,
+                                             mlnx_sched_obj_t *obj)
+{
+    sx_cos_ets_element_config_t ets;
+    sai_status_t                status;
+
+    status = scheduler_to_group_ets(scheduler_id, level, index, obj, &ets);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    return ets_element_update(port_id, &ets, 1, "group");
+}
+
+typedef struct _sched_ets_batch_t {
+    sx_cos_ets_element_config_t *list;
+    uint32_t                     count;
+    sai_object_id_t              scheduler_id;
+} sched_ets_batch_t;
+
 static mlnx_iter_ret_t sched_profile_update_groups(mlnx_port_config_t *port, mlnx_sched_obj_t *obj, void *arg)
 {
     mlnx_sched_iter_ctx_t *ctx = arg;
-    sai_object_id_t        scheduler_id;
+    sched_ets_batch_t     *batch;
 
     assert(port != NULL);
     assert(ctx != NULL);
     assert(ctx->arg != NULL);
 
-    scheduler_id = *(sai_object_id_t*)ctx->arg;
+    batch = ctx->arg;
 
     if (obj->type != MLNX_SCHED_OBJ_GROUP) {
         return ITER_NEXT;
     }
 
-    if (scheduler_id == obj->scheduler_id) {
-        ctx->sai_status = scheduler_to_group_apply(scheduler_id, port->logical, obj->level,
-                                                   obj->index);
+    if (batch->scheduler_id == obj->scheduler_id) {
+        if (batch->count >= MAX_ETS_ELEMENTS) {
+            SX_LOG_ERR("Too many ETS elements on port %x\n", port->logical);
+            ctx->sai_status = SAI_STATUS_FAILURE;
+            return ITER_STOP;
+        }
+
+        ctx->sai_status = scheduler_to_group_ets(batch->scheduler_id, obj->level, obj->index, obj,
+                                                 &batch->list[batch->count]);
         if (SAI_ERR(ctx->sai_status)) {
             return ITER_STOP;
         }
+
+        batch->count++;
     }
 
     return ITER_NEXT;
@@ -375,6 +414,7 @@ static sai_status_t mlnx_sched_attr_setter(_In_ const sai_object_key_t      *key
     sai_status_t                status;
     uint32_t                    ii, qi;
     mlnx_sched_iter_ctx_t       ctx;
+    sched_ets_batch_t           batch = { NULL, 0, SAI_NULL_OBJECT_ID };
 
     SX_LOG_ENTER();
 
@@ -439,39 +479,65 @@ static sai_status_t mlnx_sched_attr_setter(_In_ const sai_object_key_t      *key
     memcpy(&ets, &sched->ets, sizeof(ets));
     sai_to_sdk_rate(sched->min_rate, sched->max_rate, &ets);
 
+    batch.scheduler_id = key->key.object_id;
+    batch.list         = (sx_cos_ets_element_config_t*)malloc(sizeof(*batch.list) * MAX_ETS_ELEMENTS);
+    if (!batch.list) {
+        SX_LOG_ERR("Failed to allocate ETS list\n");
+        status = SAI_STATUS_NO_MEMORY;
+        goto out;
+    }
+
+    /* All the changed elements of the port are applied by one SDK call */
     mlnx_port_not_in_lag_foreach(port, ii) {
+        batch.count = 0;
+
         if (port->scheduler_id == key->key.object_id) {
-            status = port_update_ets(port->logical, &ets);
+            batch.list[batch.count] = ets;
 
+            status = port_ets_fill(&batch.list[batch.count]);
             if (status != SAI_STATUS_SUCCESS) {
                 goto out;
             }
+
+            batch.count++;
         }
 
         port_queues_foreach(port, queue, qi) {
             if (queue->sched_obj.scheduler_id == key->key.object_id) {
-                status = queue_update_ets(port->logical, &ets, &queue->sched_obj);
-
-                if (status != SAI_STATUS_SUCCESS) {
+                if (batch.count >= MAX_ETS_ELEMENTS) {
+                    SX_LOG_ERR("Too many ETS elements on port %x\n", port->logical);
+                    status = SAI_STATUS_FAILURE;
                     goto out;
                 }
+
+                batch.list[batch.count] = ets;
+                queue_ets_fill(&batch.list[batch.count], &queue->sched_obj);
+                batch.count++;
             }
         }
 
         ctx.sai_status = SAI_STATUS_SUCCESS;
-        ctx.arg        = (void*)&key->key.object_id;
+        ctx.arg        = &batch;
 
         status = mlnx_sched_hierarchy_foreach(port, sched_profile_update_groups, &ctx);
         if (status != SAI_STATUS_SUCCESS) {
             goto out;
         }
+
+        status = ets_element_update(port->logical, batch.list, batch.count, "port elements");
+        if (status != SAI_STATUS_SUCCESS) {
+            goto out;
+        }
     }
 
 out:
     if (status == SAI_STATUS_SUCCESS) {
-        sai_qos_db_sync();
+        sai_qos_db_dirty_mark(sched, sizeof(*sched));
+        sai_qos_db_sync_async();
     }
 
+    free(batch.list);
+
     SX_LOG_EXIT();
 
     sai_qos_db_unlock();
@@ -640,7 +706,8 @@ static sai_status_t mlnx_create_scheduler_profile(_Out_ sai_object_id_t      *sc
         return SAI_STATUS_TABLE_FULL;
     }
 
-    sai_qos_db_sync();
+    sai_qos_db_dirty_mark(&sai_qos_sched_db[ii], sizeof(sai_qos_sched_db[ii]));
+    sai_qos_db_sync_async();
     sai_qos_db_unlock();
 
     SX_LOG_NTC("Created scheduler id=%" PRIx64 "\n", *scheduler_id);
@@ -707,7 +774,8 @@ static sai_status_t mlnx_remove_scheduler_profile(_In_ sai_object_id_t scheduler
 
 out:
     if (status == SAI_STATUS_SUCCESS) {
-        sai_qos_db_sync();
+        sai_qos_db_dirty_mark(sched, sizeof(*sched));
+        sai_qos_db_sync_async();
     }
 
     sai_qos_db_unlock();
@@ -865,7 +933,8 @@ sai_status_t mlnx_scheduler_to_group_apply(sai_object_id_t scheduler_id, sai_obj
         port_id = port->lag_id;
     }
 
-    status = scheduler_to_group_apply(scheduler_id, port_id, level, index);
+    status = scheduler_to_group_apply(scheduler_id, port_id, level, index,
+                                      &port->sched_hierarchy.groups[level][index]);
     if (SAI_ERR(status)) {
         return status;
     }
@@ -874,6 +943,7 @@ sai_status_t mlnx_scheduler_to_group_apply(sai_object_id_t scheduler_id, sai_obj
                scheduler_id, port_id, level, index);
 
     port->sched_hierarchy.groups[level][index].scheduler_id = scheduler_id;
+    sai_db_dirty_mark(&port->sched_hierarchy.groups[level][index], sizeof(port->sched_hierarchy.groups[level][index]));
     return status;
 }
 
@@ -199,21 +199,94 @@ out:
     return SAI_STATUS_SUCCESS;
 }
 
-static mlnx_iter_ret_t groups_child_iter(mlnx_port_config_t *port, mlnx_sched_obj_t *obj, void *arg)
+/* Returns false if the object is not linked to a parent group */
+static bool sched_obj_parent_get(mlnx_sched_obj_t *obj, uint8_t *lvl, uint8_t *idx)
 {
-    mlnx_sched_obj_t      *parent;
-    mlnx_sched_iter_ctx_t *ctx = arg;
+    if (!obj->is_used || (obj->level == 0) || (obj->level > MAX_SCHED_LEVELS) ||
+        (obj->next_index == INVALID_INDEX) || (obj->next_index >= MAX_SCHED_CHILD_GROUPS)) {
+        return false;
+    }
 
-    assert(ctx != NULL);
-    assert(obj != NULL);
+    *lvl = obj->level - 1;
+    *idx = obj->next_index;
+    return true;
+}
 
-    parent = (mlnx_sched_obj_t*)ctx->arg;
+static mlnx_sched_obj_t * sched_obj_by_ref(mlnx_port_config_t *port, uint8_t ref)
+{
+    mlnx_qos_queue_config_t *queue;
 
-    if ((obj->level != parent->level + 1) || (obj->next_index != parent->index)) {
-        return ITER_NEXT;
+    if (ref < MLNX_SCHED_GROUP_REFS) {
+        return group_get(port, ref / MAX_SCHED_CHILD_GROUPS, ref % MAX_SCHED_CHILD_GROUPS);
+    }
+
+    queue = &g_sai_qos_db_ptr->queue_db[port->start_queues_index + ref - MLNX_SCHED_GROUP_REFS];
+    return &queue->sched_obj;
+}
+
+/*
+ * Re-build group -> children index of the port from the objects' level/next_index,
+ * must be called after any change of the port's scheduling topology (DB write lock is needed).
+ */
+void mlnx_sched_hierarchy_child_index_update(mlnx_port_config_t *port)
+{
+    mlnx_sched_hierarchy_t  *hierarchy = &port->sched_hierarchy;
+    uint8_t                  fill[MAX_SCHED_LEVELS][MAX_SCHED_CHILD_GROUPS];
+    mlnx_qos_queue_config_t *queue;
+    uint32_t                 ii, lvl, total = 0;
+    uint8_t                  plvl, pidx, ref;
+
+    memset(hierarchy->child_count, 0, sizeof(hierarchy->child_count));
+
+    for (ref = 0; ref < MLNX_SCHED_GROUP_REFS; ref++) {
+        if (sched_obj_parent_get(sched_obj_by_ref(port, ref), &plvl, &pidx)) {
+            hierarchy->child_count[plvl][pidx]++;
+        }
     }
 
-    return ctx->iter(port, obj, ctx->iter_ctx);
+    port_queues_foreach(port, queue, ii) {
+        if (MLNX_SCHED_GROUP_REFS + ii >= MLNX_SCHED_OBJ_REFS) {
+            SX_LOG_ERR("Queue index %u exceeds scheduler child index size\n", ii);
+            break;
+        }
+
+        if (sched_obj_parent_get(&queue->sched_obj, &plvl, &pidx)) {
+            hierarchy->child_count[plvl][pidx]++;
+        }
+    }
+
+    for (lvl = 0; lvl < MAX_SCHED_LEVELS; lvl++) {
+        for (ii = 0; ii < MAX_SCHED_CHILD_GROUPS; ii++) {
+            hierarchy->child_first[lvl][ii] = total;
+            fill[lvl][ii]                   = total;
+            total                          += hierarchy->child_count[lvl][ii];
+        }
+    }
+
+    for (ref = 0; ref < MLNX_SCHED_GROUP_REFS; ref++) {
+        if (sched_obj_parent_get(sched_obj_by_ref(port, ref), &plvl, &pidx)) {
+            hierarchy->child_refs[fill[plvl][pidx]++] = ref;
+        }
+    }
+
+    port_queues_foreach(port, queue, ii) {
+        if (MLNX_SCHED_GROUP_REFS + ii >= MLNX_SCHED_OBJ_REFS) {
+            break;
+        }
+
+        if (sched_obj_parent_get(&queue->sched_obj, &plvl, &pidx)) {
+            hierarchy->child_refs[fill[plvl][pidx]++] = MLNX_SCHED_GROUP_REFS + ii;
+        }
+    }
+
+    sai_db_dirty_mark(hierarchy->child_first, sizeof(hierarchy->child_first));
+    sai_db_dirty_mark(hierarchy->child_count, sizeof(hierarchy->child_count));
+    sai_db_dirty_mark(hierarchy->child_refs, sizeof(hierarchy->child_refs));
+}
+
+static uint32_t groups_child_count(mlnx_port_config_t *port, uint8_t lvl, uint8_t idx)
+{
+    return port->sched_hierarchy.child_count[lvl][idx];
 }
 
 static sai_status_t groups_child_foreach(mlnx_port_config_t    *port,
@@ -222,17 +295,17 @@ static sai_status_t groups_child_foreach(mlnx_port_config_t    *port,
                                          mlnx_sched_obj_iter_t  iter,
                                          mlnx_sched_iter_ctx_t *ctx)
 {
-    mlnx_sched_obj_t      parent    = {.level = lvl, .index = idx };
-    mlnx_sched_iter_ctx_t child_ctx = { .arg = &parent, .iter = iter, .iter_ctx = ctx };
+    mlnx_sched_hierarchy_t *hierarchy = &port->sched_hierarchy;
+    uint32_t                ii;
 
-    parent.level = lvl;
-    parent.index = idx;
+    for (ii = 0; ii < hierarchy->child_count[lvl][idx]; ii++) {
+        uint8_t ref = hierarchy->child_refs[hierarchy->child_first[lvl][idx] + ii];
 
-    child_ctx.arg      = &parent;
-    child_ctx.iter     = iter;
-    child_ctx.iter_ctx = ctx;
+        if (iter(port, sched_obj_by_ref(port, ref), ctx) == ITER_STOP) {
+            break;
+        }
+    }
 
-    mlnx_sched_hierarchy_foreach(port, groups_child_iter, &child_ctx);
     return ctx->sai_status;
 }
 
@@ -278,20 +351,6 @@ static void mlnx_sched_group_key_to_str(_In_ sai_object_id_t group_id, _Out_ cha
     snprintf(key_str, MAX_KEY_STR_LEN, "scheduler group id %x:%u:%u", port_id, level, index);
 }
 
-static mlnx_iter_ret_t groups_child_counter(mlnx_port_config_t *port, mlnx_sched_obj_t *obj, void *arg)
-{
-    mlnx_sched_iter_ctx_t *ctx = arg;
-
-    assert(arg != NULL);
-
-    if (obj->is_used) {
-        (*(uint32_t*)ctx->arg)++;
-    }
-
-    ctx->sai_status = SAI_STATUS_SUCCESS;
-    return ITER_NEXT;
-}
-
 static mlnx_iter_ret_t groups_child_to_objlist(mlnx_port_config_t *port, mlnx_sched_obj_t *obj, void *arg)
 {
     mlnx_sched_iter_ctx_t *ctx = arg;
@@ -331,13 +390,11 @@ static sai_status_t mlnx_sched_group_child_count_get(_In_ const sai_object_key_t
                                                      _Inout_ vendor_cache_t        *cache,
                                                      void                          *arg)
 {
-    mlnx_port_config_t   *port;
-    sx_port_log_id_t      port_id;
-    mlnx_sched_iter_ctx_t ctx;
-    sai_status_t          status;
-    uint32_t              count = 0;
-    uint8_t               idx;
-    uint8_t               lvl;
+    mlnx_port_config_t *port;
+    sx_port_log_id_t    port_id;
+    sai_status_t        status;
+    uint8_t             idx;
+    uint8_t             lvl;
 
     status = mlnx_sched_group_parse_id(key->key.object_id, &port_id, &lvl, &idx);
     if (status != SAI_STATUS_SUCCESS) {
@@ -352,15 +409,7 @@ static sai_status_t mlnx_sched_group_child_count_get(_In_ const sai_object_key_t
         goto out;
     }
 
-    ctx.sai_status = SAI_STATUS_SUCCESS;
-    ctx.arg        = &count;
-
-    status = groups_child_foreach(port, lvl, idx, groups_child_counter, &ctx);
-    if (SAI_ERR(status)) {
-        goto out;
-    }
-
-    value->u32 = count;
+    value->u32 = groups_child_count(port, lvl, idx);
 
 out:
     sai_qos_db_unlock();
@@ -396,13 +445,7 @@ static sai_status_t mlnx_sched_group_child_list_get(_In_ const sai_object_key_t
         goto out;
     }
 
-    ctx.sai_status = SAI_STATUS_SUCCESS;
-    ctx.arg        = &count;
-
-    status = groups_child_foreach(port, lvl, idx, groups_child_counter, &ctx);
-    if (SAI_ERR(status)) {
-        goto out;
-    }
+    count = groups_child_count(port, lvl, idx);
 
     child_list.list = malloc(count * sizeof(sai_object_id_t));
     if (!child_list.list) {
@@ -561,7 +604,7 @@ static sai_status_t mlnx_sched_group_profile_set(_In_ const sai_object_key_t
 
     status = mlnx_scheduler_to_group_apply(value->oid, key->key.object_id);
 
-    sai_qos_db_sync();
+    sai_db_sync_async();
     sai_qos_db_unlock();
 
     SX_LOG_EXIT();
@@ -733,6 +776,7 @@ static sai_status_t sched_hierarchy_reset(mlnx_port_config_t *port)
     SX_LOG_NTC("Drop default hierarchy on log port id %x\n", port->logical);
 
     mlnx_sched_hierarchy_foreach(port, sched_obj_reset, &ctx);
+    mlnx_sched_hierarchy_child_index_update(port);
     if (SAI_ERR(ctx.sai_status)) {
         SX_LOG_ERR("Failed drop default hierarchy on log port id %x\n", port->logical);
         return ctx.sai_status;
@@ -905,11 +949,15 @@ static sai_status_t mlnx_create_scheduler_group(_Out_ sai_object_id_t      *sche
     sched_obj->scheduler_id    = scheduler_id;
 
     port->sched_hierarchy.groups_count[level]++;
+    mlnx_sched_hierarchy_child_index_update(port);
 
     SX_LOG_NTC("Created scheduler group %" PRIx64 " at port %x level %u index %u\n",
                *scheduler_group_id, port_id, sched_obj->level, sched_obj->index);
 out:
-    sai_qos_db_sync();
+    if (!SAI_ERR(status)) {
+        sai_db_dirty_mark(&port->sched_hierarchy, sizeof(port->sched_hierarchy));
+    }
+    sai_db_sync_async();
     sai_qos_db_unlock();
     SX_LOG_EXIT();
     return status;
@@ -988,11 +1036,15 @@ static sai_status_t mlnx_remove_scheduler_group(_In_ sai_object_id_t scheduler_g
     group->parent_id    = SAI_NULL_OBJECT_ID;
 
     port->sched_hierarchy.groups_count[level]--;
+    mlnx_sched_hierarchy_child_index_update(port);
 
     SX_LOG_NTC("Removed scheduler group on log port id %x level %u index %u\n",
                port_id, level, index);
 out:
-    sai_qos_db_sync();
+    if (!SAI_ERR(status)) {
+        sai_db_dirty_mark(&port->sched_hierarchy, sizeof(port->sched_hierarchy));
+    }
+    sai_db_sync_async();
     sai_qos_db_unlock();
     SX_LOG_EXIT();
     return status;
@@ -1135,6 +1187,7 @@ static sai_status_t mlnx_sched_objlist_to_hierarchy_update(mlnx_port_config_t *p
         }
     }
 
+    mlnx_sched_hierarchy_child_index_update(port);
     return status;
 }
 
@@ -1156,8 +1209,7 @@ static sai_status_t sched_group_add_or_del_child_list(sai_object_id_t       pare
         sai_object_type_t parent_type = sai_object_type_query(parent_id);
 
         if (parent_type == SAI_OBJECT_TYPE_SCHEDULER_GROUP) {
-            uint32_t              count = 0;
-            mlnx_sched_iter_ctx_t ctx;
+            uint32_t count;
 
             status = mlnx_sched_group_parse_id(parent_id, &port_id, &parent_level, &parent_index);
             if (SAI_ERR(status)) {
@@ -1171,13 +1223,7 @@ static sai_status_t sched_group_add_or_del_child_list(sai_object_id_t       pare
 
             parent_sch_obj = group_get(port, parent_level, parent_index);
 
-            ctx.sai_status = SAI_STATUS_SUCCESS;
-            ctx.arg        = &count;
-
-            status = groups_child_foreach(port, parent_level, parent_index, groups_child_counter, &ctx);
-            if (SAI_ERR(status)) {
-                goto out;
-            }
+            count = groups_child_count(port, parent_level, parent_index);
 
             if (count >= parent_sch_obj->max_child_count) {
                 SX_LOG_ERR("Child groups count %u exceeds max value %u\n",
@@ -1397,6 +1443,7 @@ out:
     if (ets_list) {
         free(ets_list);
     }
+    mlnx_sched_hierarchy_child_index_update(port);
     port->sched_hierarchy.is_default = true;
     return SAI_STATUS_SUCCESS;
 }
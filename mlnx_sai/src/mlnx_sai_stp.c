@@ -603,19 +603,10 @@ static sx_mstp_inst_port_state_t sai_stp_port_state_to_sdk(sai_stp_port_state_t
     return SX_MSTP_INST_PORT_STATE_MAX + 1;
 }
 
-/**
- * @brief Create stp port object
- *
- * @param[out] stp_port_id stp port id
- * @param[in] attr_count Number of attributes
- * @param[in] attr_list Value of attributes
- * @return SAI_STATUS_SUCCESS if operation is successful otherwise a different
- *  error code is returned.
- */
-static sai_status_t mlnx_create_stp_port(_Out_ sai_object_id_t      *stp_port_id,
-                                         _In_ sai_object_id_t        switch_id,
-                                         _In_ uint32_t               attr_count,
-                                         _In_ const sai_attribute_t *attr_list)
+/* DB write lock is needed, the attributes are checked by the caller before taking it */
+static sai_status_t mlnx_stp_port_create_impl(_In_ uint32_t               attr_count,
+                                              _In_ const sai_attribute_t *attr_list,
+                                              _Out_ sai_object_id_t      *stp_port_id)
 {
     uint32_t                     stp_index, port_index, state_index;
     char                         list_str[MAX_LIST_VALUE_STR_LEN];
@@ -627,19 +618,6 @@ static sai_status_t mlnx_create_stp_port(_Out_ sai_object_id_t      *stp_port_id
     mlnx_object_id_t             stp_obj_id;
     sai_status_t                 status;
 
-    SX_LOG_ENTER();
-
-    if (stp_port_id == NULL) {
-        SX_LOG_ERR("NULL object id\n");
-        return SAI_STATUS_INVALID_PARAMETER;
-    }
-
-    status = check_attribs_metadata(attr_count, attr_list, SAI_OBJECT_TYPE_STP_PORT,
-                                    stp_port_vendor_attribs, SAI_COMMON_API_CREATE);
-    if (SAI_ERR(status)) {
-        return status;
-    }
-
     sai_attr_list_to_str(attr_count, attr_list, SAI_OBJECT_TYPE_STP_PORT, MAX_LIST_VALUE_STR_LEN, list_str);
     SX_LOG_NTC("Create STP Port, %s\n", list_str);
 
@@ -657,31 +635,28 @@ static sai_status_t mlnx_create_stp_port(_Out_ sai_object_id_t      *stp_port_id
         return status;
     }
 
-    sai_db_write_lock();
-
     status = mlnx_bridge_port_by_oid(port->oid, &bridge_port);
     if (SAI_ERR(status)) {
         SX_LOG_ERR("Failed to lookup bridge port by oid %" PRIx64 "\n", port->oid);
-        goto out;
+        return status;
     }
 
     if ((bridge_port->port_type != SAI_BRIDGE_PORT_TYPE_PORT) &&
         (bridge_port->port_type != SAI_BRIDGE_PORT_TYPE_SUB_PORT)) {
         SX_LOG_ERR("Invalid bridge port type - should be port or sub-port\n");
-        status = SAI_STATUS_INVALID_PARAMETER;
-        goto out;
+        return SAI_STATUS_INVALID_PARAMETER;
     }
 
     status = sai_stp_port_state_validate(state->s32);
     if (SAI_ERR(status)) {
-        goto out;
+        return status;
     }
 
     sx_port_state = sai_stp_port_state_to_sdk(state->s32);
 
     status = mlnx_stp_port_state_set_impl(bridge_port->logical, sx_port_state, stp_obj_id.id.stp_inst_id);
     if (SAI_ERR(status)) {
-        goto out;
+        return status;
     }
 
     memset(&stp_port_obj_id, 0, sizeof(stp_port_obj_id));
@@ -691,7 +666,7 @@ static sai_status_t mlnx_create_stp_port(_Out_ sai_object_id_t      *stp_port_id
 
     status = mlnx_object_id_to_sai(SAI_OBJECT_TYPE_STP_PORT, &stp_port_obj_id, stp_port_id);
     if (SAI_ERR(status)) {
-        goto out;
+        return status;
     }
 
     stp_port_id_to_str(*stp_port_id, key_str);
@@ -699,40 +674,26 @@ static sai_status_t mlnx_create_stp_port(_Out_ sai_object_id_t      *stp_port_id
 
     bridge_port->stps++;
 
-out:
-    sai_db_unlock();
-    SX_LOG_EXIT();
-    return status;
+    return SAI_STATUS_SUCCESS;
 }
 
-/**
- * @brief Remove stp port object.
- *
- * @param[in] stp_port_id stp object id
- * @return SAI_STATUS_SUCCESS if operation is successful otherwise a different
- *  error code is returned.
- */
-static sai_status_t mlnx_remove_stp_port(_In_ sai_object_id_t stp_port_id)
+/* DB write lock is needed */
+static sai_status_t mlnx_stp_port_remove_impl(_In_ sai_object_id_t stp_port_id)
 {
     mlnx_object_id_t    stp_port_obj_id = {0};
     mlnx_bridge_port_t *port;
     sai_status_t        status;
 
-    SX_LOG_ENTER();
-    SX_LOG_EXIT();
-
     status = sai_to_mlnx_object_id(SAI_OBJECT_TYPE_STP_PORT, stp_port_id, &stp_port_obj_id);
     if (SAI_ERR(status)) {
         SX_LOG_ERR("Failed to convert stp port oid to mlnx id\n");
         return status;
     }
 
-    sai_db_write_lock();
-
     status = mlnx_bridge_port_by_log(stp_port_obj_id.id.log_port_id, &port);
     if (SAI_ERR(status)) {
         SX_LOG_ERR("Failed to lookup bridge port for stp port\n");
-        goto out;
+        return status;
     }
 
     /* We need to be careful as we do not track existence of STP port so app
@@ -741,9 +702,64 @@ static sai_status_t mlnx_remove_stp_port(_In_ sai_object_id_t stp_port_id)
         port->stps--;
     }
 
-out:
+    return SAI_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Create stp port object
+ *
+ * @param[out] stp_port_id stp port id
+ * @param[in] attr_count Number of attributes
+ * @param[in] attr_list Value of attributes
+ * @return SAI_STATUS_SUCCESS if operation is successful otherwise a different
+ *  error code is returned.
+ */
+static sai_status_t mlnx_create_stp_port(_Out_ sai_object_id_t      *stp_port_id,
+                                         _In_ sai_object_id_t        switch_id,
+                                         _In_ uint32_t               attr_count,
+                                         _In_ const sai_attribute_t *attr_list)
+{
+    sai_status_t status;
+
+    SX_LOG_ENTER();
+
+    if (stp_port_id == NULL) {
+        SX_LOG_ERR("NULL object id\n");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    status = check_attribs_metadata(attr_count, attr_list, SAI_OBJECT_TYPE_STP_PORT,
+                                    stp_port_vendor_attribs, SAI_COMMON_API_CREATE);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    sai_db_write_lock();
+    status = mlnx_stp_port_create_impl(attr_count, attr_list, stp_port_id);
+    sai_db_unlock();
+
     SX_LOG_EXIT();
+    return status;
+}
+
+/**
+ * @brief Remove stp port object.
+ *
+ * @param[in] stp_port_id stp object id
+ * @return SAI_STATUS_SUCCESS if operation is successful otherwise a different
+ *  error code is returned.
+ */
+static sai_status_t mlnx_remove_stp_port(_In_ sai_object_id_t stp_port_id)
+{
+    sai_status_t status;
+
+    SX_LOG_ENTER();
+
+    sai_db_write_lock();
+    status = mlnx_stp_port_remove_impl(stp_port_id);
     sai_db_unlock();
+
+    SX_LOG_EXIT();
     return status;
 }
 
@@ -772,7 +788,77 @@ sai_status_t mlnx_create_stp_ports(_In_ sai_object_id_t         switch_id,
                                    _Out_ sai_object_id_t       *object_id,
                                    _Out_ sai_status_t          *object_statuses)
 {
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    sai_status_t status = SAI_STATUS_SUCCESS;
+    uint32_t     ii;
+    bool         stop_on_error, failure;
+
+    SX_LOG_ENTER();
+
+    if (0 == object_count) {
+        SX_LOG_ERR("object_count is 0\n");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    if (!attr_count) {
+        SX_LOG_ERR("attr_count is NULL\n");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    if (!attrs) {
+        SX_LOG_ERR("attrs is NULL\n");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    if (!object_id) {
+        SX_LOG_ERR("object_id is NULL\n");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    if (!object_statuses) {
+        SX_LOG_ERR("object_statuses is NULL\n");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    if (SAI_BULK_OP_TYPE_INGORE_ERROR < type) {
+        SX_LOG_ERR("Invalid value for sai_bulk_op_type_t - %d\n", type);
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    stop_on_error = (type == SAI_BULK_OP_TYPE_STOP_ON_ERROR);
+    failure       = false;
+
+    /* The attributes are checked before the DB lock is taken */
+    for (ii = 0; ii < object_count; ii++) {
+        object_id[ii] = SAI_NULL_OBJECT_ID;
+
+        status              = check_attribs_metadata(attr_count[ii], attrs[ii], SAI_OBJECT_TYPE_STP_PORT,
+                                                     stp_port_vendor_attribs, SAI_COMMON_API_CREATE);
+        object_statuses[ii] = SAI_ERR(status) ? status : SAI_STATUS_NOT_EXECUTED;
+    }
+
+    /* The whole batch is applied under one DB lock */
+    sai_db_write_lock();
+
+    for (ii = 0; ii < object_count; ii++) {
+        if (failure && stop_on_error) {
+            object_statuses[ii] = SAI_STATUS_NOT_EXECUTED;
+            continue;
+        }
+
+        if (SAI_STATUS_NOT_EXECUTED == object_statuses[ii]) {
+            object_statuses[ii] = mlnx_stp_port_create_impl(attr_count[ii], attrs[ii], &object_id[ii]);
+        }
+
+        if (SAI_ERR(object_statuses[ii])) {
+            SX_LOG_ERR("Failed to create STP port #%u\n", ii);
+            failure = true;
+        }
+    }
+
+    sai_db_unlock();
+
+    SX_LOG_EXIT();
+    return failure ? SAI_STATUS_FAILURE : SAI_STATUS_SUCCESS;
 }
 
 /**
@@ -792,7 +878,55 @@ sai_status_t mlnx_remove_stp_ports(_In_ uint32_t               object_count,
                                    _In_ sai_bulk_op_type_t     type,
                                    _Out_ sai_status_t         *object_statuses)
 {
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    sai_status_t status = SAI_STATUS_SUCCESS;
+    uint32_t     ii;
+    bool         stop_on_error, failure;
+
+    SX_LOG_ENTER();
+
+    if (0 == object_count) {
+        SX_LOG_ERR("object_count is 0\n");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    if (!object_id) {
+        SX_LOG_ERR("object_id is NULL\n");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    if (!object_statuses) {
+        SX_LOG_ERR("object_statuses is NULL\n");
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    if (SAI_BULK_OP_TYPE_INGORE_ERROR < type) {
+        SX_LOG_ERR("Invalid value for sai_bulk_op_type_t - %d\n", type);
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    stop_on_error = (type == SAI_BULK_OP_TYPE_STOP_ON_ERROR);
+    failure       = false;
+
+    sai_db_write_lock();
+
+    for (ii = 0; ii < object_count; ii++) {
+        if (failure && stop_on_error) {
+            object_statuses[ii] = SAI_STATUS_NOT_EXECUTED;
+            continue;
+        }
+
+        status              = mlnx_stp_port_remove_impl(object_id[ii]);
+        object_statuses[ii] = status;
+        if (SAI_ERR(status)) {
+            SX_LOG_ERR("Failed to remove STP port %" PRIx64 "\n", object_id[ii]);
+            failure = true;
+        }
+    }
+
+    sai_db_unlock();
+
+    SX_LOG_EXIT();
+    return failure ? SAI_STATUS_FAILURE : SAI_STATUS_SUCCESS;
 }
 
 /**
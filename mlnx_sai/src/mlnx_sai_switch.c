@@ -26,7 +26,12 @@
 #include <libxml/parser.h>
 #include <libxml/tree.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <inttypes.h>
 #include <pthread.h>
+#include <stddef.h>
 #endif
 #include <complib/cl_mem.h>
 #include <complib/cl_passivelock.h>
@@ -65,6 +70,9 @@ uint32_t                         g_sai_acl_db_pbs_map_size = 0;
 static cl_thread_t               event_thread;
 static bool                      event_thread_asked_to_stop = false;
 static uint32_t                  g_route_table_size, g_neighbor_table_size;
+static uint32_t                  g_watermark_poll_interval;
+/* Serializes the collector reconfiguration with the counter_refresh_interval update in DB */
+static pthread_mutex_t           g_counter_refresh_mutex = PTHREAD_MUTEX_INITIALIZER;
 
 void log_cb(sx_log_severity_t severity, const char *module_name, char *msg);
 #ifdef CONFIG_SYSLOG
@@ -87,6 +95,7 @@ typedef struct _pool_array_info_t {
 } pool_array_info_t;
 
 static sai_status_t switch_open_traps(void);
+static sai_status_t switch_reopen_traps(void);
 static sai_status_t switch_close_traps(void);
 static void event_thread_func(void *context);
 static sai_status_t sai_db_create();
@@ -399,6 +408,14 @@ static sai_status_t mlnx_switch_transaction_mode_get(_In_ const sai_object_key_t
                                                      _In_ uint32_t                  attr_index,
                                                      _Inout_ vendor_cache_t        *cache,
                                                      void                          *arg);
+static sai_status_t mlnx_switch_restart_warm_set(_In_ const sai_object_key_t      *key,
+                                                 _In_ const sai_attribute_value_t *value,
+                                                 void                             *arg);
+static sai_status_t mlnx_switch_restart_warm_get(_In_ const sai_object_key_t   *key,
+                                                 _Inout_ sai_attribute_value_t *value,
+                                                 _In_ uint32_t                  attr_index,
+                                                 _Inout_ vendor_cache_t        *cache,
+                                                 void                          *arg);
 static sai_status_t mlnx_default_bridge_id_get(_In_ const sai_object_key_t   *key,
                                                _Inout_ sai_attribute_value_t *value,
                                                _In_ uint32_t                  attr_index,
@@ -830,6 +847,11 @@ static const sai_vendor_attribute_entry_t switch_vendor_attribs[] = {
       { true, false, true, true },
       mlnx_switch_transaction_mode_get, NULL,
       mlnx_switch_transaction_mode_set, NULL},
+    { SAI_SWITCH_ATTR_RESTART_WARM,
+      { false, false, true, true },
+      { false, false, true, true },
+      mlnx_switch_restart_warm_get, NULL,
+      mlnx_switch_restart_warm_set, NULL },
     { SAI_SWITCH_ATTR_ACL_STAGE_INGRESS,
       { false, false, false, true },
       { false, false, false, true },
@@ -1272,9 +1294,9 @@ static sai_status_t mlnx_resource_mng_stage()
     for (ii = 0; ii < SWID_NUM; ++ii) {
         swid_details.swid        = ii;
         swid_details.iptrap_synd = SXD_TRAP_ID_IPTRAP_MIN + ii;
-        cl_plock_acquire(&g_sai_db_ptr->p_lock);
+        sai_db_read_lock();
         swid_details.mac = SX_MAC_TO_U64(g_sai_db_ptr->base_mac_addr);
-        cl_plock_release(&g_sai_db_ptr->p_lock);
+        sai_db_unlock();
 
         sxd_ret = sxd_ioctl(sxd_handle, &ctrl_pack);
         if (SXD_CHECK_FAIL(sxd_ret)) {
@@ -1741,7 +1763,8 @@ static sai_status_t mlnx_parse_config(const char *config_file)
         status = SAI_STATUS_FAILURE;
     }
 
-    msync(g_sai_db_ptr, sizeof(*g_sai_db_ptr), MS_SYNC);
+    sai_db_dirty_mark(g_sai_db_ptr, sizeof(*g_sai_db_ptr));
+    sai_db_sync();
     sai_db_unlock();
 
     xmlFreeDoc(doc);
@@ -1768,9 +1791,10 @@ static void sai_db_policer_entries_init()
 
 static void sai_db_values_init()
 {
-    uint32_t ii;
+    uint32_t    ii;
+    const char *nhop_sharing;
 
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_write_lock();
 
     memset(&g_sai_db_ptr->base_mac_addr, 0, sizeof(g_sai_db_ptr->base_mac_addr));
     memset(g_sai_db_ptr->dev_mac, 0, sizeof(g_sai_db_ptr->dev_mac));
@@ -1780,6 +1804,7 @@ static void sai_db_values_init()
     memset(g_sai_db_ptr->fd_db, 0, sizeof(g_sai_db_ptr->fd_db));
     g_sai_db_ptr->default_trap_group = SAI_NULL_OBJECT_ID;
     g_sai_db_ptr->default_vrid       = SAI_NULL_OBJECT_ID;
+    g_sai_db_ptr->restart_warm       = false;
     memset(&g_sai_db_ptr->callback_channel, 0, sizeof(g_sai_db_ptr->callback_channel));
     memset(g_sai_db_ptr->traps_db, 0, sizeof(g_sai_db_ptr->traps_db));
     memset(g_sai_db_ptr->qos_maps_db, 0, sizeof(g_sai_db_ptr->qos_maps_db));
@@ -1789,13 +1814,18 @@ static void sai_db_values_init()
     memset(g_sai_db_ptr->policers_db, 0, sizeof(g_sai_db_ptr->policers_db));
     memset(g_sai_db_ptr->mlnx_samplepacket_session, 0, sizeof(g_sai_db_ptr->mlnx_samplepacket_session));
     memset(g_sai_db_ptr->trap_group_valid, 0, sizeof(g_sai_db_ptr->trap_group_valid));
+    memset(&g_sai_db_ptr->nhop_cache, 0, sizeof(g_sai_db_ptr->nhop_cache));
+    nhop_sharing = g_mlnx_services.profile_get_value(g_profile_id, KV_NEXT_HOP_SHARING);
+    g_sai_db_ptr->nhop_cache.is_sharing_enabled = (NULL != nhop_sharing) && (0 != atoi(nhop_sharing));
+    if (g_sai_db_ptr->nhop_cache.is_sharing_enabled) {
+        SX_LOG_NTC("Next hop sharing is enabled\n");
+    }
 
     g_sai_db_ptr->flood_action_uc = SAI_PACKET_ACTION_FORWARD;
     g_sai_db_ptr->flood_action_bc = SAI_PACKET_ACTION_FORWARD;
 
     sai_db_policer_entries_init();
 
-    msync(g_sai_db_ptr, sizeof(*g_sai_db_ptr), MS_SYNC);
     sai_qos_db_init();
     memset(g_sai_qos_db_ptr->wred_db, 0, sizeof(mlnx_wred_profile_t) * g_resource_limits.cos_redecn_profiles_max);
     memset(g_sai_qos_db_ptr->queue_db, 0,
@@ -1812,8 +1842,11 @@ static void sai_db_values_init()
 
     mlnx_vlan_db_create_vlan(DEFAULT_VLAN);
 
+    sai_db_dirty_mark(g_sai_db_ptr, sizeof(*g_sai_db_ptr));
+    sai_qos_db_dirty_mark(g_sai_qos_db_ptr->db_base_ptr, g_sai_qos_db_size);
+    sai_db_sync();
     sai_qos_db_sync();
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_unlock();
 }
 
 static sai_status_t sai_db_unload(boolean_t erase_db)
@@ -1962,8 +1995,121 @@ static sai_status_t mlnx_port_auto_split(mlnx_port_config_t *port)
             return status;
         }
 
-        status = mlnx_port_speed_bitmap_apply(new_port);
+        status = mlnx_port_speed_bitmap_apply(gh_sdk, new_port);
+        if (SAI_ERR(status)) {
+            return status;
+        }
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+#define MLNX_PORT_INIT_WORKERS_NUM 4
+
+typedef struct _mlnx_port_init_worker_t {
+    cl_thread_t          thread;
+    bool                 is_thread_started;
+    mlnx_port_config_t **ports;
+    uint32_t             ports_count;
+    uint32_t             first;
+    sai_status_t         status;
+} mlnx_port_init_worker_t;
+
+/*
+ * Runs the SDK part of the port init for every MLNX_PORT_INIT_WORKERS_NUM-th port
+ * starting from worker->first, on its own SDK handle.
+ * Port configs are only read here, DB lock is held by the caller for the whole stage.
+ */
+static void mlnx_port_init_worker_func(void *context)
+{
+    mlnx_port_init_worker_t *worker = (mlnx_port_init_worker_t*)context;
+    sx_api_handle_t          handle;
+    sx_status_t              sx_status;
+    sai_status_t             status = SAI_STATUS_SUCCESS;
+    uint32_t                 ii;
+
+    sx_status = sx_api_open(sai_log_cb, &handle);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Can't open connection to SDK from port init worker - %s.\n", SX_STATUS_MSG(sx_status));
+        worker->status = sdk_to_sai(sx_status);
+        return;
+    }
+
+    for (ii = worker->first; ii < worker->ports_count; ii += MLNX_PORT_INIT_WORKERS_NUM) {
+        status = mlnx_port_config_init_sdk(handle, worker->ports[ii]);
+        if (SAI_ERR(status)) {
+            SX_LOG_ERR("Failed initialize port oid %" PRIx64 " config\n", worker->ports[ii]->saiport);
+            break;
+        }
+
+        status = mlnx_port_speed_bitmap_apply(handle, worker->ports[ii]);
+        if (SAI_ERR(status)) {
+            break;
+        }
+    }
+
+    sx_status = sx_api_close(&handle);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Failed to close SDK handle of port init worker - %s.\n", SX_STATUS_MSG(sx_status));
+        if (!SAI_ERR(status)) {
+            status = sdk_to_sai(sx_status);
+        }
+    }
+
+    worker->status = status;
+}
+
+/* DB write lock is needed */
+static sai_status_t mlnx_port_init_parallel(void)
+{
+    mlnx_port_init_worker_t workers[MLNX_PORT_INIT_WORKERS_NUM];
+    mlnx_port_config_t     *ports[MAX_PORTS];
+    mlnx_port_config_t     *port;
+    uint32_t                ports_count = 0, workers_count, ii;
+    sai_status_t            status      = SAI_STATUS_SUCCESS;
+
+    mlnx_port_phy_foreach(port, ii) {
+        ports[ports_count++] = port;
+    }
+
+    workers_count = MIN(ports_count, MLNX_PORT_INIT_WORKERS_NUM);
+
+    memset(workers, 0, sizeof(workers));
+
+    for (ii = 0; ii < workers_count; ii++) {
+        workers[ii].ports       = ports;
+        workers[ii].ports_count = ports_count;
+        workers[ii].first       = ii;
+        workers[ii].status      = SAI_STATUS_FAILURE;
+
+        if (CL_SUCCESS != cl_thread_init(&workers[ii].thread, mlnx_port_init_worker_func, &workers[ii], NULL)) {
+            SX_LOG_WRN("Failed to start port init worker %u, running it inline\n", ii);
+            mlnx_port_init_worker_func(&workers[ii]);
+            continue;
+        }
+
+        workers[ii].is_thread_started = true;
+    }
+
+    /* cl_thread_destroy() waits for the thread to exit */
+    for (ii = 0; ii < workers_count; ii++) {
+        if (workers[ii].is_thread_started) {
+            cl_thread_destroy(&workers[ii].thread);
+        }
+
+        if (SAI_ERR(workers[ii].status) && !SAI_ERR(status)) {
+            status = workers[ii].status;
+        }
+    }
+
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    for (ii = 0; ii < ports_count; ii++) {
+        status = mlnx_port_config_commit(ports[ii]);
         if (SAI_ERR(status)) {
+            SX_LOG_ERR("Failed initialize port oid %" PRIx64 " config\n", ports[ii]->saiport);
             return status;
         }
     }
@@ -1980,12 +2126,12 @@ static sai_status_t mlnx_dvs_mng_stage(sai_object_id_t switch_id)
     uint32_t                                  ii;
     sx_topolib_dev_info_t                     dev_info;
     uint32_t                                  jj;
-    struct                        ku_pmlp_reg pmlp_reg;
-    sxd_reg_meta_t                            reg_meta;
+    struct                        ku_pmlp_reg pmlp_reg[MAX_PORTS];
+    sxd_reg_meta_t                            reg_meta[MAX_PORTS];
     sxd_status_t                              sxd_status;
     mlnx_port_config_t                       *port;
 
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_write_lock();
 
     if (SX_STATUS_SUCCESS != (status = sx_api_port_swid_set(gh_sdk, SX_ACCESS_CMD_ADD, DEFAULT_ETH_SWID))) {
         SX_LOG_ERR("Port swid set failed - %s.\n", SX_STATUS_MSG(status));
@@ -2082,38 +2228,40 @@ static sai_status_t mlnx_dvs_mng_stage(sai_object_id_t switch_id)
         g_notification_callbacks.on_switch_state_change(switch_id, SAI_SWITCH_OPER_STATUS_UP);
     }
 
-    memset(&pmlp_reg, 0, sizeof(struct ku_pmlp_reg));
-    memset(&reg_meta, 0, sizeof(reg_meta));
-    reg_meta.swid       = DEFAULT_ETH_SWID;
-    reg_meta.dev_id     = SX_DEVICE_ID;
-    reg_meta.access_cmd = SXD_ACCESS_CMD_SET;
-    pmlp_reg.width      = 0;
+    memset(pmlp_reg, 0, sizeof(pmlp_reg));
+    memset(reg_meta, 0, sizeof(reg_meta));
 
+    /* Unbind all the ports in one batch, then bind them in one more */
     for (ii = 0; ii < MAX_PORTS; ii++) {
-        pmlp_reg.local_port = g_sai_db_ptr->ports_db[ii].port_map.local_port;
+        reg_meta[ii].swid       = DEFAULT_ETH_SWID;
+        reg_meta[ii].dev_id     = SX_DEVICE_ID;
+        reg_meta[ii].access_cmd = SXD_ACCESS_CMD_SET;
 
-        sxd_status = sxd_access_reg_pmlp(&pmlp_reg, &reg_meta, 1, NULL, NULL);
-        if (SXD_CHECK_FAIL(sxd_status)) {
-            SX_LOG_ERR("pmlp unbind %u failed - %s.\n", pmlp_reg.local_port, SXD_STATUS_MSG(sxd_status));
-            status = SAI_STATUS_FAILURE;
-            goto out;
-        }
+        pmlp_reg[ii].local_port = g_sai_db_ptr->ports_db[ii].port_map.local_port;
+        pmlp_reg[ii].width      = 0;
+    }
+
+    sxd_status = sxd_access_reg_pmlp(pmlp_reg, reg_meta, MAX_PORTS, NULL, NULL);
+    if (SXD_CHECK_FAIL(sxd_status)) {
+        SX_LOG_ERR("pmlp unbind failed - %s.\n", SXD_STATUS_MSG(sxd_status));
+        status = SAI_STATUS_FAILURE;
+        goto out;
     }
+
     for (ii = 0; ii < MAX_PORTS; ii++) {
-        pmlp_reg.local_port = g_sai_db_ptr->ports_db[ii].port_map.local_port;
-        pmlp_reg.width      = g_sai_db_ptr->ports_db[ii].width;
+        pmlp_reg[ii].width = g_sai_db_ptr->ports_db[ii].width;
 
-        for (jj = 0; jj < pmlp_reg.width; ++jj) {
-            pmlp_reg.module[jj] = g_sai_db_ptr->ports_db[ii].module;
-            pmlp_reg.lane[jj]   = jj;
+        for (jj = 0; jj < pmlp_reg[ii].width; ++jj) {
+            pmlp_reg[ii].module[jj] = g_sai_db_ptr->ports_db[ii].module;
+            pmlp_reg[ii].lane[jj]   = jj;
         }
+    }
 
-        sxd_status = sxd_access_reg_pmlp(&pmlp_reg, &reg_meta, 1, NULL, NULL);
-        if (SXD_CHECK_FAIL(sxd_status)) {
-            SX_LOG_ERR("pmlp bind %u failed - %s.\n", pmlp_reg.local_port, SXD_STATUS_MSG(sxd_status));
-            status = SAI_STATUS_FAILURE;
-            goto out;
-        }
+    sxd_status = sxd_access_reg_pmlp(pmlp_reg, reg_meta, MAX_PORTS, NULL, NULL);
+    if (SXD_CHECK_FAIL(sxd_status)) {
+        SX_LOG_ERR("pmlp bind failed - %s.\n", SXD_STATUS_MSG(sxd_status));
+        status = SAI_STATUS_FAILURE;
+        goto out;
     }
 
     status = mlnx_stp_preinitialize();
@@ -2121,17 +2269,9 @@ static sai_status_t mlnx_dvs_mng_stage(sai_object_id_t switch_id)
         goto out;
     }
 
-    mlnx_port_phy_foreach(port, ii) {
-        status = mlnx_port_config_init(port);
-        if (SAI_ERR(status)) {
-            SX_LOG_ERR("Failed initialize port oid %" PRIx64 " config\n", port->saiport);
-            goto out;
-        }
-
-        status = mlnx_port_speed_bitmap_apply(port);
-        if (SAI_ERR(status)) {
-            goto out;
-        }
+    status = mlnx_port_init_parallel();
+    if (SAI_ERR(status)) {
+        goto out;
     }
 
     mlnx_port_phy_foreach(port, ii) {
@@ -2381,9 +2521,9 @@ static void event_thread_func(void *context)
         goto out;
     }
 
-    cl_plock_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_read_lock();
     memcpy(&callback_channel, &g_sai_db_ptr->callback_channel, sizeof(callback_channel));
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_unlock();
 
     while (!event_thread_asked_to_stop) {
         FD_ZERO(&descr_set);
@@ -2523,13 +2663,14 @@ out:
         SX_LOG_ERR("host ifc close port fd failed - %s.\n", SX_STATUS_MSG(status));
     }
 
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_write_lock();
     if (SX_STATUS_SUCCESS != (status = sx_api_host_ifc_close(api_handle, &callback_channel.channel.fd))) {
         SX_LOG_ERR("host ifc close callback fd failed - %s.\n", SX_STATUS_MSG(status));
     }
     memset(&g_sai_db_ptr->callback_channel, 0, sizeof(g_sai_db_ptr->callback_channel));
-    msync(g_sai_db_ptr, sizeof(*g_sai_db_ptr), MS_SYNC);
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_field_dirty_mark(callback_channel);
+    sai_db_sync();
+    sai_db_unlock();
 
     if (NULL != p_packet) {
         free(p_packet);
@@ -2651,11 +2792,11 @@ static sai_status_t sai_qos_db_create()
 /* NOTE:  g_sai_db_ptr->ports_number must be initializes before calling this method*/
 static void sai_buffer_db_values_init()
 {
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_write_lock();
     assert(g_sai_db_ptr->ports_number != 0);
     sai_buffer_db_pointers_init();
     sai_buffer_db_data_reset();
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_unlock();
 }
 
 static sai_status_t sai_buffer_db_switch_connect_init(int shmid)
@@ -2675,7 +2816,6 @@ static sai_status_t sai_buffer_db_switch_connect_init(int shmid)
         return SAI_STATUS_NO_MEMORY;
     }
     sai_buffer_db_pointers_init();
-    msync(g_sai_buffer_db_ptr, g_sai_buffer_db_size, MS_SYNC);
     return SAI_STATUS_SUCCESS;
 }
 
@@ -2999,176 +3139,710 @@ static sai_status_t sai_acl_db_switch_connect_init(int shmid)
     return SAI_STATUS_SUCCESS;
 }
 
-static sai_status_t mlnx_initialize_switch(sai_object_id_t switch_id, bool *transaction_mode_enable)
+/*
+ * SAI DB snapshot is used for warm restart of the SAI process while sx_sdk (and the HW)
+ * keeps running. The file starts with a header followed by the raw images of the shared memory
+ * segments. The header keeps a fingerprint of the DB layout of the build that took the snapshot and the
+ * section sizes, so a snapshot taken by a build with a different DB layout or with different resource
+ * limits is rejected and the switch has to be cold booted.
+ */
+#define MLNX_SAI_SNAPSHOT_MAGIC   0x4D534442 /* "MSDB" */
+#define MLNX_SAI_SNAPSHOT_VERSION 2
+
+typedef enum _mlnx_sai_snapshot_section_id_t {
+    MLNX_SAI_SNAPSHOT_SECTION_DB,
+    MLNX_SAI_SNAPSHOT_SECTION_QOS_DB,
+    MLNX_SAI_SNAPSHOT_SECTION_BUFFER_DB,
+    MLNX_SAI_SNAPSHOT_SECTION_ACL_DB,
+    MLNX_SAI_SNAPSHOT_SECTION_MAX
+} mlnx_sai_snapshot_section_id_t;
+
+typedef struct _mlnx_sai_snapshot_section_t {
+    uint64_t offset;
+    uint64_t size;
+    uint32_t checksum;
+    uint32_t reserved;
+} mlnx_sai_snapshot_section_t;
+
+typedef struct _mlnx_sai_snapshot_hdr_t {
+    uint32_t                    magic;
+    uint32_t                    version;
+    uint32_t                    sections_count;
+    uint32_t                    hdr_checksum;
+    uint32_t                    layout_id;
+    uint32_t                    reserved;
+    mlnx_sai_snapshot_section_t sections[MLNX_SAI_SNAPSHOT_SECTION_MAX];
+} mlnx_sai_snapshot_hdr_t;
+
+static uint32_t mlnx_sai_snapshot_crc32(_In_ const void *data, _In_ uint64_t size)
 {
-    int                         system_err;
-    const char                 *config_file, *route_table_size, *neighbor_table_size;
-    const char                 *boot_type_char;
-    uint8_t                     boot_type     = 0;
-    uint32_t                    routes_num    = 0;
-    uint32_t                    neighbors_num = 0;
-    sx_router_resources_param_t resources_param;
-    sx_router_general_param_t   general_param;
-    sx_status_t                 status;
-    bool                        fastboot_enable = false;
+    static uint32_t crc_table[256];
+    static bool     is_table_ready = false;
+    const uint8_t  *buf            = data;
+    uint32_t        crc            = 0xFFFFFFFF;
+    uint32_t        ii, jj, val;
+    uint64_t        pos;
+
+    if (!is_table_ready) {
+        for (ii = 0; ii < 256; ii++) {
+            val = ii;
+            for (jj = 0; jj < 8; jj++) {
+                val = (val & 1) ? (0xEDB88320 ^ (val >> 1)) : (val >> 1);
+            }
+            crc_table[ii] = val;
+        }
+        is_table_ready = true;
+    }
 
-#ifndef ACS_OS
-    const char *initial_fan_speed;
-    uint8_t     fan_percent;
-#endif
-    cl_status_t                cl_err;
-    sx_router_attributes_t     router_attr;
-    sx_router_id_t             vrid;
-    sx_span_init_params_t      span_init_params;
-    sx_tunnel_general_params_t sx_tunnel_general_params;
-    sx_tunnel_attribute_t      sx_tunnel_attribute;
+    for (pos = 0; pos < size; pos++) {
+        crc = crc_table[(crc ^ buf[pos]) & 0xFF] ^ (crc >> 8);
+    }
 
-    memset(&span_init_params, 0, sizeof(sx_span_init_params_t));
-    memset(&sx_tunnel_general_params, 0, sizeof(sx_tunnel_general_params_t));
+    return crc ^ 0xFFFFFFFF;
+}
 
-    assert(sizeof(sx_tunnel_attribute.attributes.ipinip_p2p) ==
-           sizeof(sx_tunnel_attribute.attributes.ipinip_p2p_gre));
+static uint32_t mlnx_sai_snapshot_hdr_crc32(_In_ const mlnx_sai_snapshot_hdr_t *hdr)
+{
+    mlnx_sai_snapshot_hdr_t tmp_hdr;
 
-    if (NULL == transaction_mode_enable) {
-        MLNX_SAI_LOG_ERR("transaction mode enable is null\n");
-        return SAI_STATUS_FAILURE;
-    }
+    memcpy(&tmp_hdr, hdr, sizeof(tmp_hdr));
+    tmp_hdr.hdr_checksum = 0;
 
-    config_file = g_mlnx_services.profile_get_value(g_profile_id, SAI_KEY_INIT_CONFIG_FILE);
-    if (NULL == config_file) {
-        MLNX_SAI_LOG_ERR("NULL config file for profile %u\n", g_profile_id);
-        return SAI_STATUS_INVALID_PARAMETER;
-    }
+    return mlnx_sai_snapshot_crc32(&tmp_hdr, sizeof(tmp_hdr));
+}
 
-    if (SAI_STATUS_SUCCESS != (status = mlnx_sai_db_initialize(config_file))) {
-        return status;
-    }
+/* Fingerprint of the sizes and offsets the shared memory images are laid out with in this build */
+static uint32_t mlnx_sai_snapshot_layout_id(void)
+{
+    const uint64_t layout[] = {
+        sizeof(sai_db_t),
+        offsetof(sai_db_t, ports_db),
+        sizeof(mlnx_port_config_t),
+        offsetof(sai_db_t, bridge_ports_db),
+        sizeof(mlnx_bridge_port_t),
+        offsetof(sai_db_t, rifs_db),
+        sizeof(mlnx_rif_db_t),
+        offsetof(sai_db_t, vlans_db),
+        sizeof(mlnx_vlan_db_t),
+        offsetof(sai_db_t, traps_db),
+        sizeof(mlnx_trap_t),
+        offsetof(sai_db_t, policers_db),
+        sizeof(mlnx_policer_db_entry_t),
+        offsetof(sai_db_t, nhop_cache),
+        sizeof(mlnx_nhop_cache_t),
+        sizeof(mlnx_qos_queue_config_t),
+        sizeof(mlnx_wred_profile_t),
+        sizeof(mlnx_sched_profile_t),
+        sizeof(mlnx_sai_db_buffer_profile_entry_t),
+        sizeof(acl_table_db_t),
+        sizeof(acl_entry_db_t),
+        sizeof(acl_counter_db_t),
+        sizeof(acl_group_db_t),
+    };
+
+    return mlnx_sai_snapshot_crc32(layout, sizeof(layout));
+}
 
-    system_err = system("pidof sx_sdk");
-    if (0 == system_err) {
-        MLNX_SAI_LOG_ERR("SDK already running. Please terminate it before running SAI init.\n");
-        return SAI_STATUS_FAILURE;
-    }
+/* Fills the current images of the shared memory segments, indexed by section id */
+static void mlnx_sai_snapshot_sections_get(_Out_ uint8_t **data, _Out_ uint64_t *sizes)
+{
+    data[MLNX_SAI_SNAPSHOT_SECTION_DB]         = (uint8_t*)g_sai_db_ptr;
+    sizes[MLNX_SAI_SNAPSHOT_SECTION_DB]        = sizeof(*g_sai_db_ptr);
+    data[MLNX_SAI_SNAPSHOT_SECTION_QOS_DB]     = g_sai_qos_db_ptr->db_base_ptr;
+    sizes[MLNX_SAI_SNAPSHOT_SECTION_QOS_DB]    = g_sai_qos_db_size;
+    data[MLNX_SAI_SNAPSHOT_SECTION_BUFFER_DB]  = g_sai_buffer_db_ptr->db_base_ptr;
+    sizes[MLNX_SAI_SNAPSHOT_SECTION_BUFFER_DB] = g_sai_buffer_db_size;
+    data[MLNX_SAI_SNAPSHOT_SECTION_ACL_DB]     = g_sai_acl_db_ptr->db_base_ptr;
+    sizes[MLNX_SAI_SNAPSHOT_SECTION_ACL_DB]    = g_sai_acl_db_size;
+}
 
-    boot_type_char = g_mlnx_services.profile_get_value(g_profile_id, SAI_KEY_BOOT_TYPE);
-    if (NULL != boot_type_char) {
-        boot_type = (uint8_t)atoi(boot_type_char);
-    } else {
-        boot_type = 0;
-    }
+static sai_status_t mlnx_sai_snapshot_write(_In_ int fd, _In_ const void *data, _In_ uint64_t size)
+{
+    const uint8_t *buf = data;
+    ssize_t        written;
 
-    switch (boot_type) {
-    /* cold boot */
-    case 0:
-#if (!defined ACS_OS) || (defined ACS_OS_NO_DOCKERS)
-        system_err = system("/etc/init.d/sxdkernel start");
-        if (0 != system_err) {
-            MLNX_SAI_LOG_ERR("Failed running sxdkernel start.\n");
+    while (size > 0) {
+        written = write(fd, buf, size);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            SX_LOG_ERR("Failed to write SAI DB snapshot - %s\n", strerror(errno));
             return SAI_STATUS_FAILURE;
         }
-#endif
-        if (SAI_STATUS_SUCCESS != (status = mlnx_resource_mng_stage())) {
-            return status;
-        }
-        fastboot_enable = false;
-        break;
 
-    /* warm boot */
-    case 1:
-        MLNX_SAI_LOG_ERR("Warm boot not supported yet\n");
-        return SAI_STATUS_INVALID_PARAMETER;
-        break;
+        buf  += written;
+        size -= written;
+    }
 
-    /* fast boot */
-    case 2:
-#if (!defined ACS_OS) || (defined ACS_OS_NO_DOCKERS)
-        system_err = system("env FAST_BOOT=1 /etc/init.d/sxdkernel start");
-        if (0 != system_err) {
-            MLNX_SAI_LOG_ERR("Failed running sxdkernel start.\n");
-            return SAI_STATUS_FAILURE;
-        }
-#endif
-        if (SAI_STATUS_SUCCESS != (status = mlnx_resource_mng_stage())) {
-            return status;
-        }
-        fastboot_enable = true;
-        if (!(*transaction_mode_enable)) {
-            MLNX_SAI_LOG_ERR("Transaction mode should be enabled, enabling now\n");
-            *transaction_mode_enable = true;
-        }
-        break;
+    return SAI_STATUS_SUCCESS;
+}
 
-    /* default */
-    default:
-        MLNX_SAI_LOG_ERR("Boot type %d not recognized, must be 0 (cold) or 1 (warm) or 2 (fast)\n", boot_type);
+/* DB write lock is needed */
+static sai_status_t mlnx_sai_db_snapshot_save(_In_ const char *path)
+{
+    mlnx_sai_snapshot_hdr_t hdr;
+    uint8_t                *data[MLNX_SAI_SNAPSHOT_SECTION_MAX];
+    uint64_t                sizes[MLNX_SAI_SNAPSHOT_SECTION_MAX];
+    char                    tmp_path[PATH_MAX];
+    uint64_t                offset;
+    sai_status_t            status = SAI_STATUS_SUCCESS;
+    uint32_t                ii;
+    int                     fd;
+
+    SX_LOG_ENTER();
+
+    if (snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", path) >= (int)sizeof(tmp_path)) {
+        SX_LOG_ERR("SAI DB snapshot path is too long - %s\n", path);
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    if (SAI_STATUS_SUCCESS != (status = mlnx_chassis_mng_stage(fastboot_enable, *transaction_mode_enable))) {
-        return status;
-    }
+    mlnx_sai_snapshot_sections_get(data, sizes);
 
-    if (SAI_STATUS_SUCCESS != (status = mlnx_dvs_mng_stage(switch_id))) {
-        return status;
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.magic          = MLNX_SAI_SNAPSHOT_MAGIC;
+    hdr.version        = MLNX_SAI_SNAPSHOT_VERSION;
+    hdr.sections_count = MLNX_SAI_SNAPSHOT_SECTION_MAX;
+    hdr.layout_id      = mlnx_sai_snapshot_layout_id();
+
+    offset = sizeof(hdr);
+    for (ii = 0; ii < MLNX_SAI_SNAPSHOT_SECTION_MAX; ii++) {
+        hdr.sections[ii].offset   = offset;
+        hdr.sections[ii].size     = sizes[ii];
+        hdr.sections[ii].checksum = mlnx_sai_snapshot_crc32(data[ii], sizes[ii]);
+        offset                   += sizes[ii];
     }
+    hdr.hdr_checksum = mlnx_sai_snapshot_hdr_crc32(&hdr);
 
-#ifndef ACS_OS
-    initial_fan_speed = g_mlnx_services.profile_get_value(g_profile_id, KV_INITIAL_FAN_SPEED);
-    if (NULL != initial_fan_speed) {
-        fan_percent = (uint8_t)atoi(initial_fan_speed);
-        if ((fan_percent > MAX_FAN_PERCENT) || (fan_percent < MIN_FAN_PERCENT)) {
-            SX_LOG_ERR("Initial fan speed must be in range [%u,%u] - %u\n",
-                       MIN_FAN_PERCENT,
-                       MAX_FAN_PERCENT,
-                       fan_percent);
-            return SAI_STATUS_INVALID_PARAMETER;
-        }
-        SX_LOG_NTC("Setting initial fan speed %u%%\n", fan_percent);
-        if (SAI_STATUS_SUCCESS != (status = mlnx_switch_fan_set(fan_percent))) {
-            return status;
-        }
+    fd = open(tmp_path, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    if (fd < 0) {
+        SX_LOG_ERR("Failed to open %s - %s\n", tmp_path, strerror(errno));
+        return SAI_STATUS_FAILURE;
     }
-#endif
 
-    if (SAI_STATUS_SUCCESS != (status = switch_open_traps())) {
-        return status;
+    status = mlnx_sai_snapshot_write(fd, &hdr, sizeof(hdr));
+    for (ii = 0; (SAI_STATUS_SUCCESS == status) && (ii < MLNX_SAI_SNAPSHOT_SECTION_MAX); ii++) {
+        status = mlnx_sai_snapshot_write(fd, data[ii], sizes[ii]);
     }
 
-    cl_err = cl_thread_init(&event_thread, event_thread_func, (const void*const)switch_id, NULL);
-    if (cl_err) {
-        SX_LOG_ERR("Failed to create event thread\n");
-        return SAI_STATUS_FAILURE;
+    if ((SAI_STATUS_SUCCESS == status) && (0 != fsync(fd))) {
+        SX_LOG_ERR("Failed to sync SAI DB snapshot - %s\n", strerror(errno));
+        status = SAI_STATUS_FAILURE;
     }
 
-    /* init router model, T1 config */
-    /* TODO : in the future, get some/all of these params dynamically from the profile */
-    memset(&resources_param, 0, sizeof(resources_param));
-    memset(&general_param, 0, sizeof(general_param));
+    close(fd);
 
-    g_route_table_size    = single_part_eth_device_profile_spectrum.kvd_hash_single_size;
-    g_neighbor_table_size = single_part_eth_device_profile_spectrum.kvd_hash_single_size;
-    route_table_size      = g_mlnx_services.profile_get_value(g_profile_id, SAI_KEY_L3_ROUTE_TABLE_SIZE);
-    neighbor_table_size   = g_mlnx_services.profile_get_value(g_profile_id, SAI_KEY_L3_NEIGHBOR_TABLE_SIZE);
-    if (NULL != route_table_size) {
-        routes_num = (uint32_t)atoi(route_table_size);
-        SX_LOG_NTC("Setting initial route table size %u\n", routes_num);
-        /* 0 is full kvd */
-        if (routes_num) {
-            g_route_table_size = routes_num;
-        }
+    if (SAI_STATUS_SUCCESS != status) {
+        unlink(tmp_path);
+        return status;
     }
-    if (NULL != neighbor_table_size) {
-        neighbors_num = (uint32_t)atoi(neighbor_table_size);
-        SX_LOG_NTC("Setting initial neighbor table size %u\n", neighbors_num);
-        if (neighbors_num) {
-            g_neighbor_table_size = neighbors_num;
-        }
+
+    /* rename is atomic, a crash in the middle leaves the previous snapshot intact */
+    if (0 != rename(tmp_path, path)) {
+        SX_LOG_ERR("Failed to rename %s to %s - %s\n", tmp_path, path, strerror(errno));
+        unlink(tmp_path);
+        return SAI_STATUS_FAILURE;
     }
 
-    resources_param.max_virtual_routers_num    = g_resource_limits.router_vrid_max;
-    resources_param.max_vlan_router_interfaces = 64;
-    resources_param.max_port_router_interfaces = 64;
-    resources_param.max_router_interfaces      = g_resource_limits.router_rifs_max;
+    SX_LOG_NTC("SAI DB snapshot saved to %s (%" PRIu64 " bytes)\n", path, offset);
+
+    SX_LOG_EXIT();
+    return SAI_STATUS_SUCCESS;
+}
+
+static sai_status_t mlnx_sai_snapshot_validate(_In_ const uint8_t *file, _In_ uint64_t file_size)
+{
+    const mlnx_sai_snapshot_hdr_t *hdr = (const mlnx_sai_snapshot_hdr_t*)file;
+    uint32_t                       ii;
+
+    if (file_size < sizeof(*hdr)) {
+        SX_LOG_ERR("SAI DB snapshot is truncated\n");
+        return SAI_STATUS_FAILURE;
+    }
+
+    if ((MLNX_SAI_SNAPSHOT_MAGIC != hdr->magic) || (MLNX_SAI_SNAPSHOT_VERSION != hdr->version) ||
+        (MLNX_SAI_SNAPSHOT_SECTION_MAX != hdr->sections_count)) {
+        SX_LOG_ERR("SAI DB snapshot format is not supported (magic 0x%x version %u sections %u)\n",
+                   hdr->magic, hdr->version, hdr->sections_count);
+        return SAI_STATUS_FAILURE;
+    }
+
+    if (mlnx_sai_snapshot_hdr_crc32(hdr) != hdr->hdr_checksum) {
+        SX_LOG_ERR("SAI DB snapshot header is corrupted\n");
+        return SAI_STATUS_FAILURE;
+    }
+
+    if (mlnx_sai_snapshot_layout_id() != hdr->layout_id) {
+        SX_LOG_ERR("SAI DB snapshot was taken by a build with a different DB layout (0x%x, current 0x%x)\n",
+                   hdr->layout_id, mlnx_sai_snapshot_layout_id());
+        return SAI_STATUS_FAILURE;
+    }
+
+    for (ii = 0; ii < MLNX_SAI_SNAPSHOT_SECTION_MAX; ii++) {
+        if ((hdr->sections[ii].offset > file_size) ||
+            (hdr->sections[ii].size > file_size - hdr->sections[ii].offset)) {
+            SX_LOG_ERR("SAI DB snapshot section %u is out of file bounds\n", ii);
+            return SAI_STATUS_FAILURE;
+        }
+
+        if (mlnx_sai_snapshot_crc32(file + hdr->sections[ii].offset, hdr->sections[ii].size) !=
+            hdr->sections[ii].checksum) {
+            SX_LOG_ERR("SAI DB snapshot section %u is corrupted\n", ii);
+            return SAI_STATUS_FAILURE;
+        }
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static sai_status_t mlnx_sai_snapshot_section_restore(_In_ const uint8_t                *file,
+                                                      _In_ mlnx_sai_snapshot_section_id_t id,
+                                                      _In_ void                         *dst,
+                                                      _In_ uint64_t                      dst_size)
+{
+    const mlnx_sai_snapshot_hdr_t *hdr = (const mlnx_sai_snapshot_hdr_t*)file;
+
+    if (hdr->sections[id].size != dst_size) {
+        SX_LOG_ERR("SAI DB snapshot section %u size %" PRIu64 " doesn't match current layout %" PRIu64 "\n",
+                   id, hdr->sections[id].size, dst_size);
+        return SAI_STATUS_FAILURE;
+    }
+
+    memcpy(dst, file + hdr->sections[id].offset, dst_size);
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/*
+ * Re-creates the shared memory segments from the snapshot and rebuilds the process local
+ * pointer tables on top of them. g_resource_limits must be initialized.
+ */
+static sai_status_t mlnx_sai_db_snapshot_restore(_In_ const char *path)
+{
+    struct stat  st;
+    uint8_t     *file = MAP_FAILED;
+    sai_status_t status;
+    cl_status_t  cl_err;
+    int          fd;
+
+    SX_LOG_ENTER();
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        SX_LOG_ERR("Failed to open SAI DB snapshot %s - %s\n", path, strerror(errno));
+        return SAI_STATUS_FAILURE;
+    }
+
+    if ((0 != fstat(fd, &st)) || (st.st_size <= 0)) {
+        SX_LOG_ERR("Failed to get size of SAI DB snapshot %s\n", path);
+        status = SAI_STATUS_FAILURE;
+        goto out;
+    }
+
+    file = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (file == MAP_FAILED) {
+        SX_LOG_ERR("Failed to map SAI DB snapshot %s - %s\n", path, strerror(errno));
+        status = SAI_STATUS_FAILURE;
+        goto out;
+    }
+
+    if (SAI_STATUS_SUCCESS != (status = mlnx_sai_snapshot_validate(file, st.st_size))) {
+        goto out;
+    }
+
+    if (SAI_STATUS_SUCCESS != (status = sai_db_create())) {
+        goto out;
+    }
+
+    if (SAI_STATUS_SUCCESS != (status = mlnx_sai_snapshot_section_restore(file, MLNX_SAI_SNAPSHOT_SECTION_DB,
+                                                                          g_sai_db_ptr,
+                                                                          sizeof(*g_sai_db_ptr)))) {
+        goto out;
+    }
+
+    /* The lock image belongs to the previous process */
+    cl_err = cl_plock_init_pshared(&g_sai_db_ptr->p_lock);
+    if (cl_err) {
+        SX_LOG_ERR("Failed to initialize the SAI DB rwlock\n");
+        status = SAI_STATUS_FAILURE;
+        goto out;
+    }
+    g_sai_db_ptr->restart_warm = false;
+
+    if (SAI_STATUS_SUCCESS != (status = sai_qos_db_create())) {
+        goto out;
+    }
+
+    if (SAI_STATUS_SUCCESS != (status = mlnx_sai_snapshot_section_restore(file, MLNX_SAI_SNAPSHOT_SECTION_QOS_DB,
+                                                                          g_sai_qos_db_ptr->db_base_ptr,
+                                                                          g_sai_qos_db_size))) {
+        goto out;
+    }
+    sai_qos_db_init();
+
+    /* buffer DB size depends on ports_number which is taken from the restored SAI DB */
+    if (SAI_STATUS_SUCCESS != (status = sai_buffer_db_create())) {
+        goto out;
+    }
+
+    if (SAI_STATUS_SUCCESS != (status = mlnx_sai_snapshot_section_restore(file,
+                                                                          MLNX_SAI_SNAPSHOT_SECTION_BUFFER_DB,
+                                                                          g_sai_buffer_db_ptr->db_base_ptr,
+                                                                          g_sai_buffer_db_size))) {
+        goto out;
+    }
+    sai_buffer_db_pointers_init();
+
+    if (SAI_STATUS_SUCCESS != (status = sai_acl_db_create())) {
+        goto out;
+    }
+
+    if (SAI_STATUS_SUCCESS != (status = mlnx_sai_snapshot_section_restore(file, MLNX_SAI_SNAPSHOT_SECTION_ACL_DB,
+                                                                          g_sai_acl_db_ptr->db_base_ptr,
+                                                                          g_sai_acl_db_size))) {
+        goto out;
+    }
+    sai_acl_db_init();
+
+    sai_db_dirty_mark(g_sai_db_ptr, sizeof(*g_sai_db_ptr));
+    sai_qos_db_dirty_mark(g_sai_qos_db_ptr->db_base_ptr, g_sai_qos_db_size);
+    sai_db_sync();
+    sai_qos_db_sync();
+
+    SX_LOG_NTC("SAI DB restored from snapshot %s\n", path);
+
+out:
+    if (file != MAP_FAILED) {
+        munmap(file, st.st_size);
+    }
+    close(fd);
+    SX_LOG_EXIT();
+    return status;
+}
+
+/*
+ * Checks the restored DB against the state of the running SDK.
+ * ACL tables and FD host interfaces keep process local state (psort handles, file descriptors)
+ * which can't be carried over, such configuration requires a cold boot.
+ */
+static sai_status_t mlnx_sai_db_snapshot_reconcile(void)
+{
+    mlnx_port_config_t    *port;
+    sx_port_mapping_t      port_map;
+    sx_router_attributes_t router_attr;
+    sx_status_t            sx_status;
+    sai_status_t           status;
+    uint32_t               data;
+    uint32_t               ii;
+
+    SX_LOG_ENTER();
+
+    mlnx_port_phy_foreach(port, ii) {
+        sx_status = sx_api_port_mapping_get(gh_sdk, &port->logical, &port_map, 1);
+        if (SX_ERR(sx_status)) {
+            SX_LOG_ERR("Failed to get port 0x%x mapping - %s\n", port->logical, SX_STATUS_MSG(sx_status));
+            return sdk_to_sai(sx_status);
+        }
+
+        if ((port_map.module_port != port->port_map.module_port) ||
+            (port_map.width != port->port_map.width) ||
+            (port_map.lane_bmap != port->port_map.lane_bmap)) {
+            SX_LOG_ERR("Port 0x%x mapping in SDK doesn't match the snapshot\n", port->logical);
+            return SAI_STATUS_FAILURE;
+        }
+    }
+
+    status = mlnx_object_to_type(g_sai_db_ptr->default_vrid, SAI_OBJECT_TYPE_VIRTUAL_ROUTER, &data, NULL);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    sx_status = sx_api_router_get(gh_sdk, (sx_router_id_t)data, &router_attr);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Default router %u from the snapshot is missing in SDK - %s\n", data, SX_STATUS_MSG(sx_status));
+        return sdk_to_sai(sx_status);
+    }
+
+    for (ii = 0; ii < ACL_MAX_TABLE_NUMBER; ii++) {
+        if (g_sai_acl_db_ptr->acl_table_db[ii].is_used) {
+            SX_LOG_ERR("Warm restart with ACL tables is not supported\n");
+            return SAI_STATUS_NOT_SUPPORTED;
+        }
+    }
+
+    for (ii = 0; ii < MAX_FDS; ii++) {
+        if (g_sai_db_ptr->fd_db[ii].valid) {
+            SX_LOG_ERR("Warm restart with FD host interfaces is not supported\n");
+            return SAI_STATUS_NOT_SUPPORTED;
+        }
+    }
+
+    SX_LOG_EXIT();
+    return SAI_STATUS_SUCCESS;
+}
+
+static void mlnx_switch_l3_table_sizes_init(_Out_ uint32_t *routes_num, _Out_ uint32_t *neighbors_num)
+{
+    const char *route_table_size, *neighbor_table_size;
+
+    *routes_num    = 0;
+    *neighbors_num = 0;
+
+    g_route_table_size    = single_part_eth_device_profile_spectrum.kvd_hash_single_size;
+    g_neighbor_table_size = single_part_eth_device_profile_spectrum.kvd_hash_single_size;
+    route_table_size      = g_mlnx_services.profile_get_value(g_profile_id, SAI_KEY_L3_ROUTE_TABLE_SIZE);
+    neighbor_table_size   = g_mlnx_services.profile_get_value(g_profile_id, SAI_KEY_L3_NEIGHBOR_TABLE_SIZE);
+    if (NULL != route_table_size) {
+        *routes_num = (uint32_t)atoi(route_table_size);
+        SX_LOG_NTC("Setting initial route table size %u\n", *routes_num);
+        /* 0 is full kvd */
+        if (*routes_num) {
+            g_route_table_size = *routes_num;
+        }
+    }
+    if (NULL != neighbor_table_size) {
+        *neighbors_num = (uint32_t)atoi(neighbor_table_size);
+        SX_LOG_NTC("Setting initial neighbor table size %u\n", *neighbors_num);
+        if (*neighbors_num) {
+            g_neighbor_table_size = *neighbors_num;
+        }
+    }
+}
+
+/*
+ * Warm boot - sx_sdk was left running by the warm shutdown of the previous SAI instance,
+ * so only the SAI side is rebuilt from the snapshot, the HW is not touched.
+ */
+static sai_status_t mlnx_warm_restart_switch(sai_object_id_t switch_id, bool *transaction_mode_enable)
+{
+    const char  *snapshot_file;
+    uint32_t     routes_num, neighbors_num;
+    int          system_err;
+    sxd_status_t sxd_ret;
+    sx_status_t  status;
+    cl_status_t  cl_err;
+
+    snapshot_file = g_mlnx_services.profile_get_value(g_profile_id, SAI_KEY_WARM_BOOT_READ_FILE);
+    if (NULL == snapshot_file) {
+        MLNX_SAI_LOG_ERR("Warm boot requires %s in profile %u\n", SAI_KEY_WARM_BOOT_READ_FILE, g_profile_id);
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    system_err = system("pidof sx_sdk");
+    if (0 != system_err) {
+        MLNX_SAI_LOG_ERR("SDK is not running, warm boot requires SDK left running by warm shutdown\n");
+        return SAI_STATUS_FAILURE;
+    }
+
+    sxd_ret = sxd_dpt_init(SYS_TYPE_EN, sai_log_cb, LOG_VAR_NAME(__MODULE__));
+    if (SXD_CHECK_FAIL(sxd_ret)) {
+        MLNX_SAI_LOG_ERR("Failed to init dpt - %s.\n", SXD_STATUS_MSG(sxd_ret));
+        return SAI_STATUS_FAILURE;
+    }
+
+    sxd_ret = sxd_access_reg_init(0, sai_log_cb, LOG_VAR_NAME(__MODULE__));
+    if (SXD_CHECK_FAIL(sxd_ret)) {
+        MLNX_SAI_LOG_ERR("Failed to init access reg - %s.\n", SXD_STATUS_MSG(sxd_ret));
+        return SAI_STATUS_FAILURE;
+    }
+
+    if (SX_STATUS_SUCCESS != (status = sx_api_open(sai_log_cb, &gh_sdk))) {
+        MLNX_SAI_LOG_ERR("Can't open connection to SDK - %s.\n", SX_STATUS_MSG(status));
+        return sdk_to_sai(status);
+    }
+
+    if (SX_STATUS_SUCCESS != (status = sx_api_system_log_verbosity_level_set(gh_sdk,
+                                                                             SX_LOG_VERBOSITY_BOTH,
+                                                                             LOG_VAR_NAME(__MODULE__),
+                                                                             LOG_VAR_NAME(__MODULE__)))) {
+        SX_LOG_ERR("Set system log verbosity failed - %s.\n", SX_STATUS_MSG(status));
+        return sdk_to_sai(status);
+    }
+
+    if (SAI_STATUS_SUCCESS != (status = mlnx_sai_db_snapshot_restore(snapshot_file))) {
+        return status;
+    }
+
+    if (SAI_STATUS_SUCCESS != (status = mlnx_sai_db_snapshot_reconcile())) {
+        return status;
+    }
+
+    /* SDK keeps the transaction mode of the previous instance */
+    *transaction_mode_enable = g_sai_db_ptr->transaction_mode_enable;
+
+    mlnx_switch_l3_table_sizes_init(&routes_num, &neighbors_num);
+
+    if (SAI_STATUS_SUCCESS != (status = switch_reopen_traps())) {
+        return status;
+    }
+
+    event_thread_asked_to_stop = false;
+
+    cl_err = cl_thread_init(&event_thread, event_thread_func, (const void*const)switch_id, NULL);
+    if (cl_err) {
+        SX_LOG_ERR("Failed to create event thread\n");
+        return SAI_STATUS_FAILURE;
+    }
+
+    if (SAI_STATUS_SUCCESS != (status = mlnx_acl_init())) {
+        SX_LOG_ERR("Failed to init acl DB\n");
+        return status;
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static sai_status_t mlnx_initialize_switch(sai_object_id_t switch_id, bool *transaction_mode_enable)
+{
+    int                         system_err;
+    const char                 *config_file;
+    const char                 *boot_type_char;
+    uint8_t                     boot_type     = 0;
+    uint32_t                    routes_num    = 0;
+    uint32_t                    neighbors_num = 0;
+    sx_router_resources_param_t resources_param;
+    sx_router_general_param_t   general_param;
+    sx_status_t                 status;
+    bool                        fastboot_enable = false;
+
+#ifndef ACS_OS
+    const char *initial_fan_speed;
+    uint8_t     fan_percent;
+#endif
+    cl_status_t                cl_err;
+    sx_router_attributes_t     router_attr;
+    sx_router_id_t             vrid;
+    sx_span_init_params_t      span_init_params;
+    sx_tunnel_general_params_t sx_tunnel_general_params;
+    sx_tunnel_attribute_t      sx_tunnel_attribute;
+
+    memset(&span_init_params, 0, sizeof(sx_span_init_params_t));
+    memset(&sx_tunnel_general_params, 0, sizeof(sx_tunnel_general_params_t));
+
+    assert(sizeof(sx_tunnel_attribute.attributes.ipinip_p2p) ==
+           sizeof(sx_tunnel_attribute.attributes.ipinip_p2p_gre));
+
+    if (NULL == transaction_mode_enable) {
+        MLNX_SAI_LOG_ERR("transaction mode enable is null\n");
+        return SAI_STATUS_FAILURE;
+    }
+
+    boot_type_char = g_mlnx_services.profile_get_value(g_profile_id, SAI_KEY_BOOT_TYPE);
+    if (NULL != boot_type_char) {
+        boot_type = (uint8_t)atoi(boot_type_char);
+    } else {
+        boot_type = 0;
+    }
+
+    /* warm boot */
+    if (1 == boot_type) {
+        return mlnx_warm_restart_switch(switch_id, transaction_mode_enable);
+    }
+
+    config_file = g_mlnx_services.profile_get_value(g_profile_id, SAI_KEY_INIT_CONFIG_FILE);
+    if (NULL == config_file) {
+        MLNX_SAI_LOG_ERR("NULL config file for profile %u\n", g_profile_id);
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    if (SAI_STATUS_SUCCESS != (status = mlnx_sai_db_initialize(config_file))) {
+        return status;
+    }
+
+    system_err = system("pidof sx_sdk");
+    if (0 == system_err) {
+        MLNX_SAI_LOG_ERR("SDK already running. Please terminate it before running SAI init.\n");
+        return SAI_STATUS_FAILURE;
+    }
+
+    switch (boot_type) {
+    /* cold boot */
+    case 0:
+#if (!defined ACS_OS) || (defined ACS_OS_NO_DOCKERS)
+        system_err = system("/etc/init.d/sxdkernel start");
+        if (0 != system_err) {
+            MLNX_SAI_LOG_ERR("Failed running sxdkernel start.\n");
+            return SAI_STATUS_FAILURE;
+        }
+#endif
+        if (SAI_STATUS_SUCCESS != (status = mlnx_resource_mng_stage())) {
+            return status;
+        }
+        fastboot_enable = false;
+        break;
+
+    /* fast boot */
+    case 2:
+#if (!defined ACS_OS) || (defined ACS_OS_NO_DOCKERS)
+        system_err = system("env FAST_BOOT=1 /etc/init.d/sxdkernel start");
+        if (0 != system_err) {
+            MLNX_SAI_LOG_ERR("Failed running sxdkernel start.\n");
+            return SAI_STATUS_FAILURE;
+        }
+#endif
+        if (SAI_STATUS_SUCCESS != (status = mlnx_resource_mng_stage())) {
+            return status;
+        }
+        fastboot_enable = true;
+        if (!(*transaction_mode_enable)) {
+            MLNX_SAI_LOG_ERR("Transaction mode should be enabled, enabling now\n");
+            *transaction_mode_enable = true;
+        }
+        break;
+
+    /* default */
+    default:
+        MLNX_SAI_LOG_ERR("Boot type %d not recognized, must be 0 (cold) or 1 (warm) or 2 (fast)\n", boot_type);
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    if (SAI_STATUS_SUCCESS != (status = mlnx_chassis_mng_stage(fastboot_enable, *transaction_mode_enable))) {
+        return status;
+    }
+
+    if (SAI_STATUS_SUCCESS != (status = mlnx_dvs_mng_stage(switch_id))) {
+        return status;
+    }
+
+#ifndef ACS_OS
+    initial_fan_speed = g_mlnx_services.profile_get_value(g_profile_id, KV_INITIAL_FAN_SPEED);
+    if (NULL != initial_fan_speed) {
+        fan_percent = (uint8_t)atoi(initial_fan_speed);
+        if ((fan_percent > MAX_FAN_PERCENT) || (fan_percent < MIN_FAN_PERCENT)) {
+            SX_LOG_ERR("Initial fan speed must be in range [%u,%u] - %u\n",
+                       MIN_FAN_PERCENT,
+                       MAX_FAN_PERCENT,
+                       fan_percent);
+            return SAI_STATUS_INVALID_PARAMETER;
+        }
+        SX_LOG_NTC("Setting initial fan speed %u%%\n", fan_percent);
+        if (SAI_STATUS_SUCCESS != (status = mlnx_switch_fan_set(fan_percent))) {
+            return status;
+        }
+    }
+#endif
+
+    if (SAI_STATUS_SUCCESS != (status = switch_open_traps())) {
+        return status;
+    }
+
+    cl_err = cl_thread_init(&event_thread, event_thread_func, (const void*const)switch_id, NULL);
+    if (cl_err) {
+        SX_LOG_ERR("Failed to create event thread\n");
+        return SAI_STATUS_FAILURE;
+    }
+
+    /* init router model, T1 config */
+    /* TODO : in the future, get some/all of these params dynamically from the profile */
+    memset(&resources_param, 0, sizeof(resources_param));
+    memset(&general_param, 0, sizeof(general_param));
+
+    mlnx_switch_l3_table_sizes_init(&routes_num, &neighbors_num);
+
+    resources_param.max_virtual_routers_num    = g_resource_limits.router_vrid_max;
+    resources_param.max_vlan_router_interfaces = 64;
+    resources_param.max_port_router_interfaces = 64;
+    resources_param.max_router_interfaces      = g_resource_limits.router_rifs_max;
 
     resources_param.min_ipv4_uc_route_entries = routes_num;
     resources_param.min_ipv6_uc_route_entries = routes_num;
@@ -3210,10 +3884,11 @@ static sai_status_t mlnx_initialize_switch(sai_object_id_t switch_id, bool *tran
         return sdk_to_sai(status);
     }
 
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_write_lock();
     status = mlnx_create_object(SAI_OBJECT_TYPE_VIRTUAL_ROUTER, vrid, NULL, &g_sai_db_ptr->default_vrid);
-    msync(g_sai_db_ptr, sizeof(*g_sai_db_ptr), MS_SYNC);
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_field_dirty_mark(default_vrid);
+    sai_db_sync();
+    sai_db_unlock();
     if (SAI_STATUS_SUCCESS != status) {
         return status;
     }
@@ -3342,6 +4017,53 @@ static sai_status_t mlnx_connect_switch(sai_object_id_t switch_id)
     return SAI_STATUS_SUCCESS;
 }
 
+/*
+ * The non zero refresh interval (in seconds) makes the counter collector also read the port, queue, PG, ACL,
+ * RIF and VLAN counters. On 0 the collector goes back to watermarks only if they are polled
+ * (KV_WATERMARK_POLL_INTERVAL), otherwise it is stopped.
+ */
+static sai_status_t mlnx_switch_counter_collector_apply(_In_ uint32_t refresh_interval)
+{
+    if (0 != refresh_interval) {
+        return mlnx_counter_collector_start(refresh_interval * 1000, true);
+    }
+
+    if (0 != g_watermark_poll_interval) {
+        return mlnx_counter_collector_start(g_watermark_poll_interval, false);
+    }
+
+    mlnx_counter_collector_stop();
+    return SAI_STATUS_SUCCESS;
+}
+
+/*
+ * The counter collector snapshots are process local, so it is started both by the process which
+ * initializes the switch and by the one which connects to it, with the refresh interval kept in DB
+ * (set before the connect or restored on warm boot).
+ */
+static void mlnx_switch_counter_collector_init(void)
+{
+    const char *watermark_interval;
+    uint32_t    refresh_interval;
+
+    watermark_interval = g_mlnx_services.profile_get_value(g_profile_id, KV_WATERMARK_POLL_INTERVAL);
+    if ((NULL != watermark_interval) && (0 != atoi(watermark_interval))) {
+        g_watermark_poll_interval = (uint32_t)atoi(watermark_interval);
+    }
+
+    pthread_mutex_lock(&g_counter_refresh_mutex);
+
+    sai_db_read_lock();
+    refresh_interval = g_sai_db_ptr->counter_refresh_interval;
+    sai_db_unlock();
+
+    if (SAI_ERR(mlnx_switch_counter_collector_apply(refresh_interval))) {
+        SX_LOG_WRN("Failed to start counter collector, counters and watermarks will be read on demand\n");
+    }
+
+    pthread_mutex_unlock(&g_counter_refresh_mutex);
+}
+
 /**
  * @brief Create switch
  *
@@ -3461,6 +4183,7 @@ static sai_status_t mlnx_create_switch(_Out_ sai_object_id_t     * switch_id,
      * Inits the sai_attr_metadata_t structures for ACL UDF attributes
      */
     mlnx_udf_acl_attrs_metadata_init();
+    mlnx_sai_validation_plans_init();
 
     sai_db_write_lock();
 
@@ -3472,6 +4195,8 @@ static sai_status_t mlnx_create_switch(_Out_ sai_object_id_t     * switch_id,
         return sai_status;
     }
 
+    mlnx_switch_counter_collector_init();
+
     return mlnx_object_id_to_sai(SAI_OBJECT_TYPE_SWITCH, &mlnx_switch_id, switch_id);
 }
 
@@ -3496,7 +4221,7 @@ static sai_status_t switch_open_traps(void)
         return sdk_to_sai(status);
     }
 
-    cl_plock_excl_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_write_lock();
 
     g_sai_db_ptr->trap_group_valid[DEFAULT_TRAP_GROUP_ID] = true;
 
@@ -3534,8 +4259,59 @@ static sai_status_t switch_open_traps(void)
     }
 
 out:
-    msync(g_sai_db_ptr, sizeof(*g_sai_db_ptr), MS_SYNC);
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_field_dirty_mark(trap_group_valid[DEFAULT_TRAP_GROUP_ID]);
+    sai_db_field_dirty_mark(default_trap_group);
+    sai_db_field_dirty_mark(callback_channel);
+    sai_db_field_dirty_mark(traps_db);
+    sai_db_sync();
+    sai_db_unlock();
+    return status;
+}
+
+/*
+ * The callback channel of the previous instance is gone, the traps are registered on a new one.
+ * Each trap is bound again to the trap group and action restored in the DB, so SDK follows the DB
+ * also for the trap groups changed after the snapshot was taken.
+ */
+static sai_status_t switch_reopen_traps(void)
+{
+    uint32_t                   ii;
+    sai_status_t               status;
+    sx_host_ifc_register_key_t reg;
+
+    memset(&reg, 0, sizeof(reg));
+    reg.key_type = SX_HOST_IFC_REGISTER_KEY_TYPE_GLOBAL;
+
+    sai_db_write_lock();
+
+    if (SX_STATUS_SUCCESS != (status = sx_api_host_ifc_open(gh_sdk, &g_sai_db_ptr->callback_channel.channel.fd))) {
+        SX_LOG_ERR("host ifc open callback fd failed - %s.\n", SX_STATUS_MSG(status));
+        status = sdk_to_sai(status);
+        goto out;
+    }
+    g_sai_db_ptr->callback_channel.type = SX_USER_CHANNEL_TYPE_FD;
+
+    for (ii = 0; END_TRAP_INFO_ID != mlnx_traps_info[ii].trap_id; ii++) {
+        if (0 == mlnx_traps_info[ii].sdk_traps_num) {
+            continue;
+        }
+
+        if (SAI_STATUS_SUCCESS != (status = mlnx_trap_set(ii, g_sai_db_ptr->traps_db[ii].action,
+                                                          g_sai_db_ptr->traps_db[ii].trap_group))) {
+            goto out;
+        }
+
+        if (SAI_STATUS_SUCCESS != (status = mlnx_register_trap(SX_ACCESS_CMD_REGISTER, ii,
+                                                               SAI_HOSTIF_TABLE_ENTRY_CHANNEL_TYPE_CB,
+                                                               g_sai_db_ptr->callback_channel.channel.fd, &reg))) {
+            goto out;
+        }
+    }
+
+out:
+    sai_db_field_dirty_mark(callback_channel);
+    sai_db_sync();
+    sai_db_unlock();
     return status;
 }
 
@@ -3554,6 +4330,46 @@ static sai_status_t switch_close_traps(void)
     return SAI_STATUS_SUCCESS;
 }
 
+/*
+ * Saves the SAI DB snapshot and releases the SAI side only,
+ * sx_sdk and the driver are left running for the next warm boot.
+ */
+static sai_status_t mlnx_shutdown_switch_warm(_In_ const char *snapshot_file)
+{
+    sx_status_t  status;
+    sxd_status_t sxd_status;
+
+    sai_db_write_lock();
+    acl_global_lock();
+    status = mlnx_sai_db_snapshot_save(snapshot_file);
+    acl_global_unlock();
+    sai_db_unlock();
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    if (SAI_STATUS_SUCCESS != (status = mlnx_acl_deinit())) {
+        SX_LOG_ERR("ACL DB deinit failed.\n");
+    }
+
+    sai_qos_db_unload(true);
+    sai_buffer_db_unload(true);
+    sai_acl_db_unload(true);
+    sai_db_unload(true);
+
+    if (SXD_STATUS_SUCCESS != (sxd_status = sxd_access_reg_deinit())) {
+        SX_LOG_ERR("Access reg deinit failed.\n");
+    }
+
+    if (SX_STATUS_SUCCESS != (status = sx_api_close(&gh_sdk))) {
+        SX_LOG_ERR("API close failed.\n");
+    }
+
+    memset(&g_notification_callbacks, 0, sizeof(g_notification_callbacks));
+
+    return sdk_to_sai(status);
+}
+
 static sai_status_t mlnx_shutdown_switch(void)
 {
     sx_status_t    status;
@@ -3561,11 +4377,19 @@ static sai_status_t mlnx_shutdown_switch(void)
     int            system_err;
     sx_router_id_t vrid;
     uint32_t       data;
+    const char    *snapshot_file = NULL;
 
     SX_LOG_ENTER();
 
     SX_LOG_NTC("Shutdown switch\n");
 
+    if (g_sai_db_ptr->restart_warm) {
+        snapshot_file = g_mlnx_services.profile_get_value(g_profile_id, SAI_KEY_WARM_BOOT_WRITE_FILE);
+        if (NULL == snapshot_file) {
+            SX_LOG_ERR("Warm restart requires %s, performing cold shutdown\n", SAI_KEY_WARM_BOOT_WRITE_FILE);
+        }
+    }
+
     if (SX_STATUS_SUCCESS != (status = switch_close_traps())) {
         SX_LOG_ERR("Close traps failed\n");
     }
@@ -3576,6 +4400,18 @@ static sai_status_t mlnx_shutdown_switch(void)
     pthread_join(event_thread.osd.id, NULL);
 #endif
 
+    mlnx_counter_collector_stop();
+
+    if (NULL != snapshot_file) {
+        if (SAI_STATUS_SUCCESS == (status = mlnx_shutdown_switch_warm(snapshot_file))) {
+            SX_LOG_NTC("Switch is ready for warm boot\n");
+            SX_LOG_EXIT();
+            return SAI_STATUS_SUCCESS;
+        }
+
+        SX_LOG_ERR("Failed to save SAI DB snapshot, performing cold shutdown\n");
+    }
+
     if (SAI_STATUS_SUCCESS ==
         mlnx_object_to_type(g_sai_db_ptr->default_vrid, SAI_OBJECT_TYPE_VIRTUAL_ROUTER, &data, NULL)) {
         vrid = (sx_router_id_t)data;
@@ -3635,6 +4471,8 @@ static sai_status_t mlnx_disconnect_switch(void)
 
     SX_LOG_NTC("Disconnect switch\n");
 
+    mlnx_counter_collector_stop();
+
     if (SX_STATUS_SUCCESS != (status = sx_api_close(&gh_sdk))) {
         SX_LOG_ERR("API close failed.\n");
     }
@@ -3656,6 +4494,87 @@ static sai_status_t mlnx_disconnect_switch(void)
     return sdk_to_sai(status);
 }
 
+static sai_status_t mlnx_switch_api_perf_counters_get(_Inout_ sai_u32_list_t *list)
+{
+    mlnx_perf_entry_t entry;
+    uint32_t         *data, count = 0;
+    uint32_t          object_type, op;
+    sai_status_t      status;
+
+    data = calloc(SAI_OBJECT_TYPE_MAX * MLNX_PERF_OP_MAX * MLNX_PERF_RECORD_SIZE, sizeof(*data));
+    if (!data) {
+        SX_LOG_ERR("Failed to allocate memory\n");
+        return SAI_STATUS_NO_MEMORY;
+    }
+
+    for (object_type = SAI_OBJECT_TYPE_NULL; object_type < SAI_OBJECT_TYPE_MAX; object_type++) {
+        for (op = 0; op < MLNX_PERF_OP_MAX; op++) {
+            mlnx_perf_entry_get(object_type, op, &entry);
+            if (0 == entry.count) {
+                continue;
+            }
+
+            data[count++] = object_type;
+            data[count++] = op;
+            data[count++] = (uint32_t)MIN(entry.count, UINT32_MAX);
+            data[count++] = (uint32_t)MIN(entry.failed, UINT32_MAX);
+            data[count++] = (uint32_t)MIN(entry.total_ns / entry.count / 1000, UINT32_MAX);
+            data[count++] = (uint32_t)MIN(entry.max_ns / 1000, UINT32_MAX);
+            data[count++] = (0 == entry.sdk_count) ? UINT32_MAX :
+                            (uint32_t)MIN(entry.sdk_ns / entry.count / 1000, UINT32_MAX - 1);
+            data[count++] = (uint32_t)MIN(entry.lock_wait_ns / entry.count / 1000, UINT32_MAX);
+        }
+    }
+
+    status = mlnx_fill_u32list(data, count, list);
+
+    free(data);
+    return status;
+}
+
+static sai_status_t mlnx_switch_custom_attr_set(_In_ const sai_attribute_t *attr)
+{
+    switch (attr->id) {
+    case MLNX_SWITCH_ATTR_API_PERF_ENABLE:
+        mlnx_perf_enable_set(attr->value.booldata);
+        return SAI_STATUS_SUCCESS;
+
+    case MLNX_SWITCH_ATTR_API_PERF_CLEAR:
+        if (attr->value.booldata) {
+            mlnx_perf_clear();
+        }
+        return SAI_STATUS_SUCCESS;
+
+    case MLNX_SWITCH_ATTR_API_PERF_COUNTERS:
+        SX_LOG_ERR("Attribute %x is read only\n", attr->id);
+        return SAI_STATUS_INVALID_ATTRIBUTE_0;
+
+    default:
+        SX_LOG_ERR("Unknown switch attribute %x\n", attr->id);
+        return SAI_STATUS_UNKNOWN_ATTRIBUTE_0;
+    }
+}
+
+static sai_status_t mlnx_switch_custom_attr_get(_Inout_ sai_attribute_t *attr)
+{
+    switch (attr->id) {
+    case MLNX_SWITCH_ATTR_API_PERF_ENABLE:
+        attr->value.booldata = mlnx_perf_is_enabled();
+        return SAI_STATUS_SUCCESS;
+
+    case MLNX_SWITCH_ATTR_API_PERF_COUNTERS:
+        return mlnx_switch_api_perf_counters_get(&attr->value.u32list);
+
+    case MLNX_SWITCH_ATTR_API_PERF_CLEAR:
+        SX_LOG_ERR("Attribute %x is write only\n", attr->id);
+        return SAI_STATUS_INVALID_ATTRIBUTE_0;
+
+    default:
+        SX_LOG_ERR("Unknown switch attribute %x\n", attr->id);
+        return SAI_STATUS_UNKNOWN_ATTRIBUTE_0;
+    }
+}
+
 /**
  * @brief Set switch attribute value
  *
@@ -3671,6 +4590,13 @@ static sai_status_t mlnx_set_switch_attribute(_In_ sai_object_id_t switch_id, _I
     sai_status_t           sai_status;
 
     SX_LOG_ENTER();
+
+    if (attr && (attr->id >= SAI_SWITCH_ATTR_CUSTOM_RANGE_START)) {
+        sai_status = mlnx_switch_custom_attr_set(attr);
+        SX_LOG_EXIT();
+        return sai_status;
+    }
+
     switch_key_to_str(switch_id, key_str);
     sai_status = sai_set_attribute(&key, key_str, SAI_OBJECT_TYPE_SWITCH, switch_vendor_attribs, attr);
     SX_LOG_EXIT();
@@ -3763,7 +4689,7 @@ static sai_status_t mlnx_switch_fdb_flood_ctrl_set(_In_ const sai_object_key_t
                                                    void                             *arg)
 {
     sai_switch_attr_t       attr_id = (sai_switch_attr_t)arg;
-    sx_port_log_id_t        log_ports[MAX_PORTS];
+    sx_port_log_id_t        log_ports[MAX_BRIDGE_PORTS];
     sx_flood_control_type_t flood_type;
     sai_status_t            status;
     sai_packet_action_t     action = (sai_packet_action_t)value->s32;
@@ -3797,6 +4723,8 @@ static sai_status_t mlnx_switch_fdb_flood_ctrl_set(_In_ const sai_object_key_t
         assert(false);
     }
 
+    /* Only the VLANs with members (on drop) or with a flood list set (on forward) are updated */
+    status = SAI_STATUS_SUCCESS;
     mlnx_vlan_id_foreach(fid) {
         sx_status_t         sx_status = SX_STATUS_SUCCESS;
         mlnx_bridge_port_t *port;
@@ -3817,13 +4745,21 @@ static sai_status_t mlnx_switch_fdb_flood_ctrl_set(_In_ const sai_object_key_t
                                                      ports_count, log_ports);
             if (SX_ERR(sx_status)) {
                 SX_LOG_ERR("Failed to add fdb flood list for fid %u - %s.\n", fid, SX_STATUS_MSG(sx_status));
+            } else {
+                mlnx_fdb_flood_ctrl_type_mark(fid, flood_type, true);
             }
         } else {
+            if (!mlnx_fdb_flood_ctrl_type_is_set(fid, flood_type)) {
+                continue;
+            }
+
             sx_status = sx_api_fdb_flood_control_set(gh_sdk, SX_ACCESS_CMD_DELETE_ALL_PORTS,
                                                      DEFAULT_ETH_SWID, fid, flood_type,
                                                      0, NULL);
             if (SX_ERR(sx_status)) {
                 SX_LOG_ERR("Failed to delete fdb flood list for fid %u - %s.\n", fid, SX_STATUS_MSG(sx_status));
+            } else {
+                mlnx_fdb_flood_ctrl_type_mark(fid, flood_type, false);
             }
         }
 
@@ -3880,16 +4816,41 @@ static sai_status_t mlnx_switch_ecmp_hash_param_set(_In_ const sai_object_key_t
  * A NPU may support both or one of the option. It would return
  * error for unsupported options. [uint32_t]
  */
+/* See mlnx_switch_counter_collector_apply() */
 static sai_status_t mlnx_switch_counter_refresh_set(_In_ const sai_object_key_t      *key,
                                                     _In_ const sai_attribute_value_t *value,
                                                     void                             *arg)
 {
+    sai_status_t status;
+    uint32_t     interval = value->u32;
+
     SX_LOG_ENTER();
 
-    /* TODO : implement */
+    if (interval > UINT32_MAX / 1000) {
+        SX_LOG_ERR("Counter refresh interval %u is out of range\n", interval);
+        SX_LOG_EXIT();
+        return SAI_STATUS_INVALID_ATTR_VALUE_0;
+    }
+
+    pthread_mutex_lock(&g_counter_refresh_mutex);
+
+    status = mlnx_switch_counter_collector_apply(interval);
+    if (SAI_ERR(status)) {
+        SX_LOG_ERR("Failed to apply counter refresh interval %u\n", interval);
+        pthread_mutex_unlock(&g_counter_refresh_mutex);
+        SX_LOG_EXIT();
+        return status;
+    }
+
+    sai_db_write_lock();
+    g_sai_db_ptr->counter_refresh_interval = interval;
+    sai_db_field_dirty_mark(counter_refresh_interval);
+    sai_db_unlock();
+
+    pthread_mutex_unlock(&g_counter_refresh_mutex);
 
     SX_LOG_EXIT();
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    return SAI_STATUS_SUCCESS;
 }
 
 /* Set LAG hashing seed  [uint32_t] */
@@ -3976,8 +4937,35 @@ static sai_status_t mlnx_get_switch_attribute(_In_ sai_object_id_t     switch_id
     sai_status_t           status;
     const sai_object_key_t key = { .key.object_id = switch_id };
     char                   key_str[MAX_KEY_STR_LEN];
+    uint32_t               ii, custom_count = 0;
 
     SX_LOG_ENTER();
+
+    for (ii = 0; attr_list && (ii < attr_count); ii++) {
+        if (attr_list[ii].id >= SAI_SWITCH_ATTR_CUSTOM_RANGE_START) {
+            custom_count++;
+        }
+    }
+
+    if (custom_count > 0) {
+        if (custom_count != attr_count) {
+            SX_LOG_ERR("Vendor switch attributes can't be mixed with SAI attributes\n");
+            SX_LOG_EXIT();
+            return SAI_STATUS_INVALID_PARAMETER;
+        }
+
+        for (ii = 0; ii < attr_count; ii++) {
+            status = mlnx_switch_custom_attr_get(&attr_list[ii]);
+            if (SAI_ERR(status)) {
+                SX_LOG_EXIT();
+                return status;
+            }
+        }
+
+        SX_LOG_EXIT();
+        return SAI_STATUS_SUCCESS;
+    }
+
     switch_key_to_str(switch_id, key_str);
     status = sai_get_attributes(&key, key_str, SAI_OBJECT_TYPE_SWITCH, switch_vendor_attribs, attr_count, attr_list);
     SX_LOG_EXIT();
@@ -3993,9 +4981,9 @@ static sai_status_t mlnx_switch_port_number_get(_In_ const sai_object_key_t   *k
 {
     SX_LOG_ENTER();
 
-    cl_plock_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_read_lock();
     value->u32 = g_sai_db_ptr->ports_number;
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_unlock();
 
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
@@ -4249,7 +5237,8 @@ static sai_status_t mlnx_switch_qos_map_id_set(_In_ const sai_object_key_t
 
     g_sai_db_ptr->switch_qos_maps[qos_map_type] = qos_map_id;
 
-    sai_db_sync();
+    sai_db_field_dirty_mark(switch_qos_maps[qos_map_type]);
+    sai_db_sync_async();
     sai_db_unlock();
     return status;
 }
@@ -4854,10 +5843,12 @@ static sai_status_t mlnx_switch_counter_refresh_get(_In_ const sai_object_key_t
 {
     SX_LOG_ENTER();
 
-    /* TODO : implement */
-    SX_LOG_EXIT();
+    sai_db_read_lock();
+    value->u32 = g_sai_db_ptr->counter_refresh_interval;
+    sai_db_unlock();
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    SX_LOG_EXIT();
+    return SAI_STATUS_SUCCESS;
 }
 
 /* Default trap group [sai_object_id_t] */
@@ -4869,9 +5860,9 @@ static sai_status_t mlnx_switch_default_trap_group_get(_In_ const sai_object_key
 {
     SX_LOG_ENTER();
 
-    cl_plock_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_read_lock();
     value->oid = g_sai_db_ptr->default_trap_group;
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_unlock();
 
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
@@ -4886,9 +5877,9 @@ static sai_status_t mlnx_switch_default_vrid_get(_In_ const sai_object_key_t   *
 {
     SX_LOG_ENTER();
 
-    cl_plock_acquire(&g_sai_db_ptr->p_lock);
+    sai_db_read_lock();
     value->oid = g_sai_db_ptr->default_vrid;
-    cl_plock_release(&g_sai_db_ptr->p_lock);
+    sai_db_unlock();
 
     SX_LOG_EXIT();
     return SAI_STATUS_SUCCESS;
@@ -5181,7 +6172,8 @@ static sai_status_t mlnx_switch_hash_object_set(_In_ const sai_object_key_t
     }
 
 out:
-    sai_db_sync();
+    sai_db_field_dirty_mark(oper_hash_list);
+    sai_db_sync_async();
     sai_db_unlock();
     SX_LOG_EXIT();
     return status;
@@ -5511,6 +6503,43 @@ static sai_status_t mlnx_switch_transaction_mode_get(_In_ const sai_object_key_t
     return SAI_STATUS_SUCCESS;
 }
 
+/* Shutdown saves the SAI DB snapshot and keeps SDK running when set */
+static sai_status_t mlnx_switch_restart_warm_set(_In_ const sai_object_key_t      *key,
+                                                 _In_ const sai_attribute_value_t *value,
+                                                 void                             *arg)
+{
+    SX_LOG_ENTER();
+
+    sai_db_write_lock();
+
+    g_sai_db_ptr->restart_warm = value->booldata;
+
+    sai_db_unlock();
+
+    SX_LOG_EXIT();
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static sai_status_t mlnx_switch_restart_warm_get(_In_ const sai_object_key_t   *key,
+                                                 _Inout_ sai_attribute_value_t *value,
+                                                 _In_ uint32_t                  attr_index,
+                                                 _Inout_ vendor_cache_t        *cache,
+                                                 void                          *arg)
+{
+    SX_LOG_ENTER();
+
+    sai_db_read_lock();
+
+    value->booldata = g_sai_db_ptr->restart_warm;
+
+    sai_db_unlock();
+
+    SX_LOG_EXIT();
+
+    return SAI_STATUS_SUCCESS;
+}
+
 static sai_status_t mlnx_default_bridge_id_get(_In_ const sai_object_key_t   *key,
                                                _Inout_ sai_attribute_value_t *value,
                                                _In_ uint32_t                  attr_index,
@@ -4417,6 +4417,11 @@ static sai_status_t mlnx_create_tunnel(_Out_ sai_object_id_t     * sai_tunnel_ob
             sai_status = sdk_to_sai(sdk_status);
             goto cleanup;
         }
+
+        sai_db_write_lock();
+        mlnx_rif_db_state_update(sx_tunnel_attr.attributes.ipinip_p2p.overlay_rif, &rif_state);
+        sai_db_sync_async();
+        sai_db_unlock();
     }
 
     SX_LOG_EXIT();
@@ -4537,6 +4542,8 @@ static sai_status_t mlnx_remove_tunnel(_In_ const sai_object_id_t sai_tunnel_obj
             sai_status = sdk_to_sai(sdk_status);
             goto cleanup;
         }
+
+        mlnx_rif_db_state_update(sx_tunnel_attr.attributes.ipinip_p2p.overlay_rif, &rif_state);
     }
 
     if ((0 != g_sai_db_ptr->tunnel_db[tunnel_db_idx].sai_tunnel_map_encap_cnt) ||
@@ -4649,6 +4656,7 @@ static sai_status_t mlnx_remove_tunnel(_In_ const sai_object_id_t sai_tunnel_obj
     sai_status = SAI_STATUS_SUCCESS;
 
 cleanup:
+    sai_db_sync_async();
     sai_db_unlock();
     SX_LOG_EXIT();
     return sai_status;
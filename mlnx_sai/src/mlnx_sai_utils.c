@@ -23,10 +23,15 @@
 #include <saimetadatautils.h>
 #include "assert.h"
 #include "inttypes.h"
+#include <errno.h>
 #ifndef WIN32
 #include <arpa/inet.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <time.h>
 #else
 #include <Ws2tcpip.h>
+#include <complib/cl_timer.h>
 #endif
 
 #undef  __MODULE__
@@ -45,6 +50,42 @@
  */
 #define MLNX_UDF_ACL_ATTR_SHORT_NAME_OFFSET (19)
 
+/*
+ * Validation plans are compiled once per object type by mlnx_sai_validation_plans_init() and let
+ * check_attribs_metadata() resolve attributes and check mandatory ones without walking the meta data.
+ * Object types without a plan (ACL table/entry because of UDF attributes, or too many attributes)
+ * take the generic path.
+ */
+#define MLNX_SAI_VALIDATION_PLAN_ATTRS_MAX (256)
+#define MLNX_SAI_VALIDATION_PLAN_NO_INDEX  (UINT16_MAX)
+
+typedef struct _mlnx_sai_attr_plan_t {
+    /* enum values form a contiguous range [enum_min, enum_max] */
+    bool    is_enum_range;
+    int32_t enum_min;
+    int32_t enum_max;
+} mlnx_sai_attr_plan_t;
+
+typedef struct _mlnx_sai_validation_plan_t {
+    bool     is_valid;
+    uint32_t attr_count_meta;
+    /* attr id -> index in sai_metadata_attr_by_object_type[] */
+    uint16_t meta_index[MLNX_SAI_VALIDATION_PLAN_ATTRS_MAX];
+    /* bitmap by meta index of mandatory on create attributes without conditions */
+    uint32_t mandatory[MLNX_SAI_VALIDATION_PLAN_ATTRS_MAX / 32];
+    /* meta indexes of mandatory on create attributes with conditions */
+    uint16_t             cond_mandatory[MLNX_SAI_VALIDATION_PLAN_ATTRS_MAX];
+    uint32_t             cond_mandatory_count;
+    mlnx_sai_attr_plan_t attrs[MLNX_SAI_VALIDATION_PLAN_ATTRS_MAX];
+    /* attr id -> index in vendor_attr, built on first use for the vendor table of the object type */
+    const sai_vendor_attribute_entry_t *volatile vendor_attr;
+    uint32_t                                     vendor_index_building;
+    uint16_t                                     vendor_index[MLNX_SAI_VALIDATION_PLAN_ATTRS_MAX];
+} mlnx_sai_validation_plan_t;
+
+static mlnx_sai_validation_plan_t mlnx_sai_validation_plans[SAI_OBJECT_TYPE_MAX];
+static bool                       mlnx_sai_validation_plans_ready;
+
 static const sai_u32_list_t        mlnx_sai_not_mandatory_attrs[SAI_OBJECT_TYPE_MAX] = {
     [SAI_OBJECT_TYPE_QOS_MAP] =
     {.count = 1, .list = (sai_attr_id_t[1]) {SAI_QOS_MAP_ATTR_MAP_TO_VALUE_LIST}
@@ -256,7 +297,7 @@ static sai_status_t sai_attribute_is_valid_for_set(_In_ const sai_attr_metadata_
 static sai_status_t sai_attribute_is_empty_list_allowed(_In_ const sai_attr_metadata_t *attr_metadata,
                                                         _Out_ bool                     *is_allowed);
 static sai_status_t sai_attrlist_mandatory_attrs_check(
-    _In_reads_z_(attr_count_meta) const bool       *attr_present_meta,
+    _In_ uint32_t                                  *attr_present_meta,
     _In_ uint32_t                                   attr_count_meta,
     _In_reads_z_(attr_count) const sai_attribute_t *attr_list,
     _In_ uint32_t                                   attr_count,
@@ -1049,6 +1090,7 @@ static sai_status_t sai_attribute_value_list_type_validate(_In_ const sai_attr_m
 
 static sai_status_t sai_atribute_value_type_enum_validate(_In_ const sai_attr_metadata_t   *meta_data,
                                                           _In_ const sai_attribute_value_t *value,
+                                                          _In_opt_ const mlnx_sai_attr_plan_t *attr_plan,
                                                           _In_ uint32_t                     attr_index)
 {
     const sai_enum_metadata_t *enum_metadata;
@@ -1112,7 +1154,12 @@ static sai_status_t sai_atribute_value_type_enum_validate(_In_ const sai_attr_me
     enum_metadata = meta_data->enummetadata;
 
     for (ii = 0; ii < enum_values_count; ii++) {
-        is_enum_value_allowed = sai_metadata_is_allowed_enum_value(meta_data, enum_values[ii]);
+        if (attr_plan && attr_plan->is_enum_range) {
+            is_enum_value_allowed = (attr_plan->enum_min <= enum_values[ii]) &&
+                                    (enum_values[ii] <= attr_plan->enum_max);
+        } else {
+            is_enum_value_allowed = sai_metadata_is_allowed_enum_value(meta_data, enum_values[ii]);
+        }
         if (!is_enum_value_allowed) {
             SX_LOG_ERR("Failed to validate %s value - enum value %d is out of range [%s, %s]\n",
                        meta_data->attridname, enum_values[ii], enum_metadata->valuesnames[0],
@@ -1127,6 +1174,7 @@ static sai_status_t sai_atribute_value_type_enum_validate(_In_ const sai_attr_me
 static sai_status_t sai_attribute_value_validate(_In_ const sai_attr_metadata_t   *meta_data,
                                                  _In_ const sai_attribute_value_t *value,
                                                  _In_ sai_common_api_t             oper,
+                                                 _In_opt_ const mlnx_sai_attr_plan_t *attr_plan,
                                                  _In_ uint32_t                     attr_index)
 {
     sai_status_t status;
@@ -1140,7 +1188,7 @@ static sai_status_t sai_attribute_value_validate(_In_ const sai_attr_metadata_t
     }
 
     if ((SAI_COMMON_API_CREATE == oper) || (SAI_COMMON_API_SET == oper)) {
-        status = sai_atribute_value_type_enum_validate(meta_data, value, attr_index);
+        status = sai_atribute_value_type_enum_validate(meta_data, value, attr_plan, attr_index);
         if (SAI_ERR(status)) {
             return status;
         }
@@ -1239,7 +1287,7 @@ static sai_status_t sai_attribute_is_empty_list_allowed(_In_ const sai_attr_meta
 }
 
 static sai_status_t sai_attrlist_mandatory_attrs_check(
-    _In_reads_z_(attr_count_meta) const bool       *attr_present_meta,
+    _In_ uint32_t                                  *attr_present_meta,
     _In_ uint32_t                                   attr_count_meta,
     _In_reads_z_(attr_count) const sai_attribute_t *attr_list,
     _In_ uint32_t                                   attr_count,
@@ -1303,7 +1351,7 @@ static sai_status_t sai_attrlist_mandatory_attrs_check(
                     return status;
                 }
 
-                if (is_mandatory_condtitions_valid && (!attr_present_meta[ii])) {
+                if (is_mandatory_condtitions_valid && (!array_bit_test(attr_present_meta, ii))) {
                     status = sai_attr_metadata_conditions_print(md[ii]->conditiontype,
                                                                 md[ii]->conditions,
                                                                 md[ii]->conditionslength,
@@ -1320,7 +1368,7 @@ static sai_status_t sai_attrlist_mandatory_attrs_check(
                     return SAI_STATUS_MANDATORY_ATTRIBUTE_MISSING;
                 }
             } else {
-                if (!attr_present_meta[ii]) {
+                if (!array_bit_test(attr_present_meta, ii)) {
                     SX_LOG_ERR("Missing mandatory attribute %s on create\n", md[ii]->attridname);
                     return SAI_STATUS_MANDATORY_ATTRIBUTE_MISSING;
                 }
@@ -1684,17 +1732,232 @@ static sai_status_t mlnx_sai_udf_attr_short_name_fetch(_In_ sai_object_type_t ob
     return SAI_STATUS_SUCCESS;
 }
 
+static void mlnx_sai_validation_plan_compile(_In_ sai_object_type_t             object_type,
+                                             _Out_ mlnx_sai_validation_plan_t *plan)
+{
+    const sai_attr_metadata_t **md;
+    const sai_enum_metadata_t  *enum_md;
+    mlnx_sai_attr_plan_t       *attr_plan;
+    uint32_t                    count, ii, jj;
+    bool                        is_not_mandatory;
+
+    memset(plan, 0, sizeof(*plan));
+
+    if (!sai_metadata_is_object_type_valid(object_type) || sai_objet_type_is_acl_table_or_entry(object_type)) {
+        return;
+    }
+
+    md = sai_metadata_attr_by_object_type[object_type];
+    if (NULL == md) {
+        return;
+    }
+
+    for (count = 0; md[count] != NULL; count++) {
+    }
+
+    if (count > MLNX_SAI_VALIDATION_PLAN_ATTRS_MAX) {
+        SX_LOG_NTC("Object type %s has %u attributes, validation plan is not used\n", SAI_TYPE_STR(object_type),
+                   count);
+        return;
+    }
+
+    memset(plan->meta_index, 0xff, sizeof(plan->meta_index));
+    memset(plan->vendor_index, 0xff, sizeof(plan->vendor_index));
+
+    for (ii = 0; ii < count; ii++) {
+        if (md[ii]->attrid < MLNX_SAI_VALIDATION_PLAN_ATTRS_MAX) {
+            plan->meta_index[md[ii]->attrid] = (uint16_t)ii;
+        }
+
+        if (md[ii]->flags & SAI_ATTR_FLAGS_MANDATORY_ON_CREATE) {
+            if (SAI_ERR(sai_attribute_is_not_mandatory(md[ii], &is_not_mandatory))) {
+                return;
+            }
+
+            if (!is_not_mandatory) {
+                if (md[ii]->isconditional) {
+                    plan->cond_mandatory[plan->cond_mandatory_count++] = (uint16_t)ii;
+                } else {
+                    array_bit_set(plan->mandatory, ii);
+                }
+            }
+        }
+
+        enum_md = md[ii]->enummetadata;
+        if ((md[ii]->isenum || md[ii]->isenumlist) && enum_md && (enum_md->valuescount > 0)) {
+            attr_plan           = &plan->attrs[ii];
+            attr_plan->enum_min = enum_md->values[0];
+            attr_plan->enum_max = enum_md->values[0];
+
+            for (jj = 1; jj < enum_md->valuescount; jj++) {
+                attr_plan->enum_min = MIN(attr_plan->enum_min, enum_md->values[jj]);
+                attr_plan->enum_max = MAX(attr_plan->enum_max, enum_md->values[jj]);
+            }
+
+            /* enum values are unique so the range is contiguous if it has exactly valuescount values */
+            attr_plan->is_enum_range =
+                ((int64_t)attr_plan->enum_max - attr_plan->enum_min + 1 == (int64_t)enum_md->valuescount);
+        }
+    }
+
+    plan->attr_count_meta = count;
+    plan->is_valid        = true;
+}
+
+/* Called once per process, before the validation plans are used */
+void mlnx_sai_validation_plans_init(void)
+{
+    uint32_t object_type;
+
+    if (mlnx_sai_validation_plans_ready) {
+        return;
+    }
+
+    for (object_type = 0; object_type < SAI_OBJECT_TYPE_MAX; object_type++) {
+        mlnx_sai_validation_plan_compile(object_type, &mlnx_sai_validation_plans[object_type]);
+    }
+
+    __sync_synchronize();
+    mlnx_sai_validation_plans_ready = true;
+}
+
+static const mlnx_sai_validation_plan_t* mlnx_sai_validation_plan_get(_In_ sai_object_type_t object_type)
+{
+    if (!mlnx_sai_validation_plans_ready || !sai_metadata_is_object_type_valid(object_type)) {
+        return NULL;
+    }
+
+    if (!mlnx_sai_validation_plans[object_type].is_valid) {
+        return NULL;
+    }
+
+    return &mlnx_sai_validation_plans[object_type];
+}
+
+/* Returns the attr id -> vendor index map of the plan if it was built for vendor_attr.
+ * The map is built by the first caller, others use the generic lookup until it's published */
+static const uint16_t* mlnx_sai_validation_plan_vendor_index_get(
+    _In_ const mlnx_sai_validation_plan_t   *plan,
+    _In_ const sai_vendor_attribute_entry_t *vendor_attr)
+{
+    mlnx_sai_validation_plan_t *plan_rw = (mlnx_sai_validation_plan_t*)plan;
+    uint32_t                    ii;
+
+    if (plan->vendor_attr == vendor_attr) {
+        return plan->vendor_index;
+    }
+
+    if (NULL != plan->vendor_attr) {
+        return NULL;
+    }
+
+    if (!__sync_bool_compare_and_swap(&plan_rw->vendor_index_building, 0, 1)) {
+        return NULL;
+    }
+
+    for (ii = 0; END_FUNCTIONALITY_ATTRIBS_ID != vendor_attr[ii].id; ii++) {
+        if ((vendor_attr[ii].id < MLNX_SAI_VALIDATION_PLAN_ATTRS_MAX) &&
+            (MLNX_SAI_VALIDATION_PLAN_NO_INDEX == plan_rw->vendor_index[vendor_attr[ii].id])) {
+            plan_rw->vendor_index[vendor_attr[ii].id] = (uint16_t)ii;
+        }
+    }
+
+    __sync_synchronize();
+    plan_rw->vendor_attr = vendor_attr;
+
+    return plan->vendor_index;
+}
+
+static sai_status_t sai_attrlist_mandatory_attrs_plan_check(_In_ const mlnx_sai_validation_plan_t *plan,
+                                                            _In_ uint32_t                         *attr_present_meta,
+                                                            _In_ const sai_attribute_t            *attr_list,
+                                                            _In_ uint32_t                          attr_count,
+                                                            _In_ sai_object_type_t                 object_type)
+{
+    sai_status_t                status;
+    char                        conditions_str[MAX_LIST_VALUE_STR_LEN] = {0};
+    const sai_attr_metadata_t **md;
+    uint32_t                    ii, missing, index;
+    bool                        is_mandatory_condtitions_valid;
+
+    md = sai_metadata_attr_by_object_type[object_type];
+
+    for (ii = 0; ii < (plan->attr_count_meta + 31) / 32; ii++) {
+        missing = plan->mandatory[ii] & ~attr_present_meta[ii];
+        if (missing) {
+            for (index = ii * 32; !(missing & 1); missing >>= 1, index++) {
+            }
+
+            if (NULL == attr_list) {
+                SX_LOG_ERR("Missing mandatory attribute %s on create (attr_list is null)\n", md[index]->attridname);
+            } else {
+                SX_LOG_ERR("Missing mandatory attribute %s on create\n", md[index]->attridname);
+            }
+            return SAI_STATUS_MANDATORY_ATTRIBUTE_MISSING;
+        }
+    }
+
+    for (ii = 0; ii < plan->cond_mandatory_count; ii++) {
+        index = plan->cond_mandatory[ii];
+
+        /* Empty attr list is not allowed when API contains mandatory attr */
+        if (NULL == attr_list) {
+            SX_LOG_ERR("Missing mandatory attribute %s on create (attr_list is null)\n", md[index]->attridname);
+            return SAI_STATUS_MANDATORY_ATTRIBUTE_MISSING;
+        }
+
+        if (array_bit_test(attr_present_meta, index)) {
+            continue;
+        }
+
+        status = sai_attribute_conditions_check(md[index]->conditiontype,
+                                                md[index]->conditions,
+                                                md[index]->conditionslength,
+                                                md[index]->objecttype,
+                                                attr_list,
+                                                attr_count,
+                                                &is_mandatory_condtitions_valid);
+        if (SAI_ERR(status)) {
+            return status;
+        }
+
+        if (is_mandatory_condtitions_valid) {
+            status = sai_attr_metadata_conditions_print(md[index]->conditiontype,
+                                                        md[index]->conditions,
+                                                        md[index]->conditionslength,
+                                                        md[index]->objecttype,
+                                                        MAX_LIST_VALUE_STR_LEN,
+                                                        conditions_str);
+            if (SAI_ERR(status)) {
+                return status;
+            }
+
+            SX_LOG_ERR("Missing mandatory attribute %s on create. Attribute is mandatory when: {%s}\n",
+                       md[index]->attridname,
+                       conditions_str);
+            return SAI_STATUS_MANDATORY_ATTRIBUTE_MISSING;
+        }
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
 sai_status_t check_attribs_metadata(_In_ uint32_t                            attr_count,
                                     _In_ const sai_attribute_t              *attr_list,
                                     _In_ sai_object_type_t                   object_type,
                                     _In_ const sai_vendor_attribute_entry_t *functionality_vendor_attr,
                                     _In_ sai_common_api_t                    oper)
 {
-    sai_status_t               status;
-    const sai_attr_metadata_t *meta_data;
-    sai_attr_flags_t           attr_flags;
-    uint32_t                   attr_count_meta, meta_data_index, vendor_attr_index, ii;
-    bool                      *attr_present_meta = NULL, is_valid_for_set;
+    sai_status_t                      status;
+    const sai_attr_metadata_t        *meta_data;
+    const mlnx_sai_validation_plan_t *plan;
+    const mlnx_sai_attr_plan_t       *attr_plan;
+    const uint16_t                   *vendor_index = NULL;
+    sai_attr_flags_t                  attr_flags;
+    uint32_t                          attr_count_meta, meta_data_index, vendor_attr_index, ii;
+    uint32_t                          attr_present_local[MLNX_SAI_VALIDATION_PLAN_ATTRS_MAX / 32];
+    uint32_t                         *attr_present_meta = NULL;
+    bool                              is_valid_for_set;
 
     SX_LOG_ENTER();
 
@@ -1736,43 +1999,69 @@ sai_status_t check_attribs_metadata(_In_ uint32_t                            att
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    status = sai_object_type_attr_count_meta_get(object_type, &attr_count_meta);
-    if (SAI_ERR(status)) {
-        goto out;
+    plan = mlnx_sai_validation_plan_get(object_type);
+    if (plan) {
+        attr_count_meta = plan->attr_count_meta;
+        vendor_index    = mlnx_sai_validation_plan_vendor_index_get(plan, functionality_vendor_attr);
+        status          = SAI_STATUS_SUCCESS;
+    } else {
+        status = sai_object_type_attr_count_meta_get(object_type, &attr_count_meta);
+        if (SAI_ERR(status)) {
+            goto out;
+        }
     }
 
-    attr_present_meta = calloc(attr_count_meta, sizeof(bool));
-    if (NULL == attr_present_meta) {
-        SX_LOG_ERR("Can't allocate memory\n");
-        status = SAI_STATUS_NO_MEMORY;
-        goto out;
+    if (attr_count_meta <= MLNX_SAI_VALIDATION_PLAN_ATTRS_MAX) {
+        memset(attr_present_local, 0, sizeof(attr_present_local));
+        attr_present_meta = attr_present_local;
+    } else {
+        attr_present_meta = calloc((attr_count_meta + 31) / 32, sizeof(uint32_t));
+        if (NULL == attr_present_meta) {
+            SX_LOG_ERR("Can't allocate memory\n");
+            status = SAI_STATUS_NO_MEMORY;
+            goto out;
+        }
     }
 
     for (ii = 0; ii < attr_count; ii++) {
-        if (sai_attr_is_acl_udf(object_type, attr_list[ii].id)) {
-            meta_data = mlnx_sai_udf_attr_metadata_get(object_type, attr_list[ii].id);
+        attr_plan = NULL;
+
+        if (plan && (attr_list[ii].id < MLNX_SAI_VALIDATION_PLAN_ATTRS_MAX) &&
+            (MLNX_SAI_VALIDATION_PLAN_NO_INDEX != plan->meta_index[attr_list[ii].id])) {
+            meta_data_index = plan->meta_index[attr_list[ii].id];
+            meta_data       = sai_metadata_attr_by_object_type[object_type][meta_data_index];
+            attr_plan       = &plan->attrs[meta_data_index];
         } else {
-            meta_data = sai_metadata_get_attr_metadata(object_type, attr_list[ii].id);
-        }
+            if (sai_attr_is_acl_udf(object_type, attr_list[ii].id)) {
+                meta_data = mlnx_sai_udf_attr_metadata_get(object_type, attr_list[ii].id);
+            } else {
+                meta_data = sai_metadata_get_attr_metadata(object_type, attr_list[ii].id);
+            }
 
-        if (NULL == meta_data) {
-            SX_LOG_ERR("Invalid attribute %d (meta data not found)\n", attr_list[ii].id);
-            status = SAI_STATUS_UNKNOWN_ATTRIBUTE_0 + ii;
-            goto out;
-        }
+            if (NULL == meta_data) {
+                SX_LOG_ERR("Invalid attribute %d (meta data not found)\n", attr_list[ii].id);
+                status = SAI_STATUS_UNKNOWN_ATTRIBUTE_0 + ii;
+                goto out;
+            }
 
-        status = sai_object_type_attr_index_find(attr_list[ii].id, object_type, &meta_data_index);
-        if (SAI_ERR(status)) {
-            SX_LOG_ERR("Invalid attribute %d (meta data index not found)\n", attr_list[ii].id);
-            status = SAI_STATUS_UNKNOWN_ATTRIBUTE_0 + ii;
-            goto out;
+            status = sai_object_type_attr_index_find(attr_list[ii].id, object_type, &meta_data_index);
+            if (SAI_ERR(status)) {
+                SX_LOG_ERR("Invalid attribute %d (meta data index not found)\n", attr_list[ii].id);
+                status = SAI_STATUS_UNKNOWN_ATTRIBUTE_0 + ii;
+                goto out;
+            }
         }
 
-        status = sai_vendor_attr_index_find(attr_list[ii].id, functionality_vendor_attr, &vendor_attr_index);
-        if (SAI_ERR(status)) {
-            SX_LOG_ERR("Invalid attribute %d (vendor data not found)\n", attr_list[ii].id);
-            status = SAI_STATUS_UNKNOWN_ATTRIBUTE_0 + ii;
-            goto out;
+        if (vendor_index && (attr_list[ii].id < MLNX_SAI_VALIDATION_PLAN_ATTRS_MAX) &&
+            (MLNX_SAI_VALIDATION_PLAN_NO_INDEX != vendor_index[attr_list[ii].id])) {
+            vendor_attr_index = vendor_index[attr_list[ii].id];
+        } else {
+            status = sai_vendor_attr_index_find(attr_list[ii].id, functionality_vendor_attr, &vendor_attr_index);
+            if (SAI_ERR(status)) {
+                SX_LOG_ERR("Invalid attribute %d (vendor data not found)\n", attr_list[ii].id);
+                status = SAI_STATUS_UNKNOWN_ATTRIBUTE_0 + ii;
+                goto out;
+            }
         }
 
         attr_flags = meta_data->flags;
@@ -1814,7 +2103,7 @@ sai_status_t check_attribs_metadata(_In_ uint32_t                            att
             goto out;
         }
 
-        if (attr_present_meta[meta_data_index]) {
+        if (array_bit_test(attr_present_meta, meta_data_index)) {
             SX_LOG_ERR("Attribute %s appears twice in attribute list at index %d\n",
                        meta_data->attridname,
                        ii);
@@ -1822,7 +2111,7 @@ sai_status_t check_attribs_metadata(_In_ uint32_t                            att
             goto out;
         }
 
-        status = sai_attribute_value_validate(meta_data, &attr_list[ii].value, oper, ii);
+        status = sai_attribute_value_validate(meta_data, &attr_list[ii].value, oper, attr_plan, ii);
         if (SAI_ERR(status)) {
             goto out;
         }
@@ -1834,22 +2123,29 @@ sai_status_t check_attribs_metadata(_In_ uint32_t                            att
             }
         }
 
-        attr_present_meta[meta_data_index] = true;
+        array_bit_set(attr_present_meta, meta_data_index);
     }
 
     if (SAI_COMMON_API_CREATE == oper) {
-        status = sai_attrlist_mandatory_attrs_check(attr_present_meta,
-                                                    attr_count_meta,
-                                                    attr_list,
-                                                    attr_count,
-                                                    object_type);
+        if (plan) {
+            status = sai_attrlist_mandatory_attrs_plan_check(plan, attr_present_meta, attr_list, attr_count,
+                                                             object_type);
+        } else {
+            status = sai_attrlist_mandatory_attrs_check(attr_present_meta,
+                                                        attr_count_meta,
+                                                        attr_list,
+                                                        attr_count,
+                                                        object_type);
+        }
         if (SAI_ERR(status)) {
             goto out;
         }
     }
 
 out:
-    free(attr_present_meta);
+    if (attr_present_meta != attr_present_local) {
+        free(attr_present_meta);
+    }
 
     SX_LOG_EXIT();
     return status;
@@ -2069,23 +2365,25 @@ sai_status_t sai_set_attribute(_In_ const sai_object_key_t             *key,
 
     SX_LOG_ENTER();
 
+    mlnx_perf_op_begin(object_type, MLNX_PERF_OP_SET);
+
     if (SAI_STATUS_SUCCESS !=
         (status =
              check_attribs_metadata(1, attr, object_type, functionality_vendor_attr, SAI_COMMON_API_SET))) {
         SX_LOG_ERR("Failed attribs check, key:%s\n", key_str);
-        SX_LOG_EXIT();
-        return status;
+        goto out;
     }
 
     if (SAI_STATUS_SUCCESS !=
         (status = set_dispatch_attrib_handler(attr, object_type, functionality_vendor_attr, key, key_str))) {
         SX_LOG_ERR("Failed set attrib dispatch\n");
-        SX_LOG_EXIT();
-        return status;
+        goto out;
     }
 
+out:
+    mlnx_perf_op_end(status);
     SX_LOG_EXIT();
-    return SAI_STATUS_SUCCESS;
+    return status;
 }
 
 sai_status_t sai_get_attributes(_In_ const sai_object_key_t             *key,
@@ -2099,13 +2397,14 @@ sai_status_t sai_get_attributes(_In_ const sai_object_key_t             *key,
 
     SX_LOG_ENTER();
 
+    mlnx_perf_op_begin(object_type, MLNX_PERF_OP_GET);
+
     if (SAI_STATUS_SUCCESS !=
         (status =
              check_attribs_metadata(attr_count, attr_list, object_type, functionality_vendor_attr,
                                     SAI_COMMON_API_GET))) {
         SX_LOG_ERR("Failed attribs check, key:%s\n", key_str);
-        SX_LOG_EXIT();
-        return status;
+        goto out;
     }
 
     if (SAI_STATUS_SUCCESS !=
@@ -2117,12 +2416,13 @@ sai_status_t sai_get_attributes(_In_ const sai_object_key_t             *key,
         } else {
             SX_LOG_ERR("Failed attribs dispatch\n");
         }
-        SX_LOG_EXIT();
-        return status;
+        goto out;
     }
 
+out:
+    mlnx_perf_op_end(status);
     SX_LOG_EXIT();
-    return SAI_STATUS_SUCCESS;
+    return status;
 }
 
 static sai_status_t sai_ipv4_to_str(_In_ sai_ip4_t value,
@@ -3660,3 +3960,352 @@ void mlnx_fdb_route_action_fetch(_In_ sai_object_type_t type,
 
     sai_db_unlock();
 }
+
+/*
+ * Dirty pages of the shared DBs, process local.
+ * Writers record the entries they touch and the flush syncs only the pages covering them
+ * instead of the whole segment (sai_db_t alone is several MB).
+ * The pages are kept as a short sorted list of disjoint page ranges, when the list is full
+ * the two closest ranges are merged.
+ */
+#define MLNX_SHM_DIRTY_RANGES_MAX 16
+
+typedef struct _mlnx_shm_dirty_range_t {
+    size_t start;
+    size_t end;
+} mlnx_shm_dirty_range_t;
+
+typedef struct _mlnx_shm_dirty_t {
+    uint32_t               count;
+    mlnx_shm_dirty_range_t ranges[MLNX_SHM_DIRTY_RANGES_MAX];
+} mlnx_shm_dirty_t;
+
+static mlnx_shm_dirty_t mlnx_shm_dirty[MLNX_SHM_DB_MAX];
+
+static size_t mlnx_shm_page_size(void)
+{
+#ifndef _WIN32
+    return (size_t)sysconf(_SC_PAGESIZE);
+#else
+    return 4096;
+#endif
+}
+
+static void mlnx_shm_db_segment_get(_In_ mlnx_shm_db_t db, _Out_ uint8_t **base, _Out_ size_t *size)
+{
+    *base = NULL;
+    *size = 0;
+
+    switch (db) {
+    case MLNX_SHM_DB_SAI:
+        *base = (uint8_t*)g_sai_db_ptr;
+        *size = sizeof(*g_sai_db_ptr);
+        break;
+
+    case MLNX_SHM_DB_QOS:
+        if (g_sai_qos_db_ptr) {
+            *base = g_sai_qos_db_ptr->db_base_ptr;
+            *size = g_sai_qos_db_size;
+        }
+        break;
+
+    case MLNX_SHM_DB_BUFFER:
+        if (g_sai_buffer_db_ptr) {
+            *base = g_sai_buffer_db_ptr->db_base_ptr;
+            *size = g_sai_buffer_db_size;
+        }
+        break;
+
+    default:
+        assert(false);
+    }
+}
+
+/* Merges the two neighbour ranges with the smallest gap between them */
+static void mlnx_shm_dirty_ranges_shrink(_Inout_ mlnx_shm_dirty_t *dirty)
+{
+    uint32_t ii, closest = 0;
+    size_t   gap, min_gap = SIZE_MAX;
+
+    for (ii = 0; ii + 1 < dirty->count; ii++) {
+        gap = dirty->ranges[ii + 1].start - dirty->ranges[ii].end;
+        if (gap < min_gap) {
+            min_gap = gap;
+            closest = ii;
+        }
+    }
+
+    dirty->ranges[closest].end = dirty->ranges[closest + 1].end;
+    memmove(&dirty->ranges[closest + 1], &dirty->ranges[closest + 2],
+            (dirty->count - closest - 2) * sizeof(dirty->ranges[0]));
+    dirty->count--;
+}
+
+void mlnx_shm_db_dirty_mark(_In_ mlnx_shm_db_t db, _In_ const void *ptr, _In_ size_t size)
+{
+    mlnx_shm_dirty_t *dirty;
+    uint8_t          *base;
+    size_t            db_size, page_size, start, end;
+    uint32_t          ii, jj;
+
+    assert(db < MLNX_SHM_DB_MAX);
+
+    mlnx_shm_db_segment_get(db, &base, &db_size);
+    if ((NULL == base) || (0 == size)) {
+        return;
+    }
+
+    if (((const uint8_t*)ptr < base) || ((const uint8_t*)ptr >= base + db_size)) {
+        SX_LOG_ERR("Dirty range %p is out of shared DB %u\n", ptr, db);
+        return;
+    }
+
+    dirty     = &mlnx_shm_dirty[db];
+    page_size = mlnx_shm_page_size();
+    start     = (const uint8_t*)ptr - base;
+    end       = MIN(start + size, db_size);
+    start    -= start % page_size;
+    end       = MIN(((end + page_size - 1) / page_size) * page_size, db_size);
+
+    if (MLNX_SHM_DIRTY_RANGES_MAX == dirty->count) {
+        mlnx_shm_dirty_ranges_shrink(dirty);
+    }
+
+    /* Ranges before the new one, then the ones overlapping or touching it are folded into it */
+    ii = 0;
+    while ((ii < dirty->count) && (dirty->ranges[ii].end < start)) {
+        ii++;
+    }
+
+    for (jj = ii; (jj < dirty->count) && (dirty->ranges[jj].start <= end); jj++) {
+        start = MIN(start, dirty->ranges[jj].start);
+        end   = MAX(end, dirty->ranges[jj].end);
+    }
+
+    if (jj == ii) {
+        memmove(&dirty->ranges[ii + 1], &dirty->ranges[ii], (dirty->count - ii) * sizeof(dirty->ranges[0]));
+        dirty->count++;
+    } else {
+        memmove(&dirty->ranges[ii + 1], &dirty->ranges[jj], (dirty->count - jj) * sizeof(dirty->ranges[0]));
+        dirty->count -= jj - ii - 1;
+    }
+
+    dirty->ranges[ii].start = start;
+    dirty->ranges[ii].end   = end;
+}
+
+void mlnx_shm_db_flush(_In_ mlnx_shm_db_t db, _In_ int flags)
+{
+    mlnx_shm_dirty_t *dirty;
+    uint8_t          *base;
+    size_t            db_size;
+    uint32_t          ii;
+
+    assert(db < MLNX_SHM_DB_MAX);
+
+    dirty = &mlnx_shm_dirty[db];
+    if (0 == dirty->count) {
+        return;
+    }
+
+    mlnx_shm_db_segment_get(db, &base, &db_size);
+    if (NULL == base) {
+        dirty->count = 0;
+        return;
+    }
+
+    for (ii = 0; ii < dirty->count; ii++) {
+        if (0 != msync(base + dirty->ranges[ii].start, dirty->ranges[ii].end - dirty->ranges[ii].start, flags)) {
+            SX_LOG_ERR("Failed to sync shared DB %u [%zu, %zu) - %s\n", db, dirty->ranges[ii].start,
+                       dirty->ranges[ii].end, strerror(errno));
+        }
+    }
+
+    dirty->count = 0;
+}
+
+#ifndef _WIN32
+#define MLNX_PERF_THREAD_LOCAL                 __thread
+#define MLNX_PERF_ATOMIC_ADD(ptr, val)         __sync_fetch_and_add((ptr), (val))
+#define MLNX_PERF_ATOMIC_CAS(ptr, old_val, val) __sync_bool_compare_and_swap((ptr), (old_val), (val))
+#else
+#define MLNX_PERF_THREAD_LOCAL                 __declspec(thread)
+#define MLNX_PERF_ATOMIC_ADD(ptr, val)         InterlockedExchangeAdd64((LONG64*)(ptr), (LONG64)(val))
+#define MLNX_PERF_ATOMIC_CAS(ptr, old_val, val) \
+    (InterlockedCompareExchange64((LONG64*)(ptr), (LONG64)(val), (LONG64)(old_val)) == (LONG64)(old_val))
+#endif
+
+typedef struct _mlnx_perf_ctx_t {
+    uint32_t          depth;
+    bool              is_active;
+    sai_object_type_t object_type;
+    mlnx_perf_op_t    op;
+    uint64_t          start_ns;
+    uint64_t          sdk_start_ns;
+    uint64_t          sdk_ns;
+    bool              is_sdk_accounted;
+    uint64_t          lock_wait_ns;
+} mlnx_perf_ctx_t;
+
+static mlnx_perf_entry_t                      mlnx_perf_entries[SAI_OBJECT_TYPE_MAX][MLNX_PERF_OP_MAX];
+static volatile bool                          mlnx_perf_enabled = true;
+static MLNX_PERF_THREAD_LOCAL mlnx_perf_ctx_t mlnx_perf_ctx;
+
+static const char *mlnx_perf_op_names[MLNX_PERF_OP_MAX] = {
+    [MLNX_PERF_OP_CREATE] = "create",
+    [MLNX_PERF_OP_REMOVE] = "remove",
+    [MLNX_PERF_OP_SET]    = "set",
+    [MLNX_PERF_OP_GET]    = "get",
+    [MLNX_PERF_OP_STATS]  = "stats",
+    [MLNX_PERF_OP_BULK]   = "bulk",
+};
+
+static uint64_t mlnx_perf_now_ns(void)
+{
+#ifndef _WIN32
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#else
+    return cl_get_time_stamp() * 1000ULL;
+#endif
+}
+
+static uint32_t mlnx_perf_hist_bucket(_In_ uint64_t ns)
+{
+    uint64_t usec   = ns / 1000;
+    uint32_t bucket = 0;
+
+    while ((usec > 0) && (bucket < MLNX_PERF_HIST_BUCKETS - 1)) {
+        usec >>= 1;
+        bucket++;
+    }
+
+    return bucket;
+}
+
+void mlnx_perf_op_begin(_In_ sai_object_type_t object_type, _In_ mlnx_perf_op_t op)
+{
+    mlnx_perf_ctx_t *ctx = &mlnx_perf_ctx;
+
+    if (ctx->depth++ > 0) {
+        return;
+    }
+
+    ctx->is_active = mlnx_perf_enabled && (object_type < SAI_OBJECT_TYPE_MAX) && (op < MLNX_PERF_OP_MAX);
+    if (!ctx->is_active) {
+        return;
+    }
+
+    ctx->object_type  = object_type;
+    ctx->op           = op;
+    ctx->sdk_ns           = 0;
+    ctx->is_sdk_accounted = false;
+    ctx->lock_wait_ns     = 0;
+    ctx->start_ns     = mlnx_perf_now_ns();
+}
+
+void mlnx_perf_op_end(_In_ sai_status_t status)
+{
+    mlnx_perf_ctx_t   *ctx = &mlnx_perf_ctx;
+    mlnx_perf_entry_t *entry;
+    uint64_t           elapsed, max;
+
+    assert(ctx->depth > 0);
+
+    if ((--ctx->depth > 0) || (!ctx->is_active)) {
+        return;
+    }
+
+    ctx->is_active = false;
+
+    elapsed = mlnx_perf_now_ns() - ctx->start_ns;
+    entry   = &mlnx_perf_entries[ctx->object_type][ctx->op];
+
+    MLNX_PERF_ATOMIC_ADD(&entry->count, 1);
+    if (SAI_ERR(status)) {
+        MLNX_PERF_ATOMIC_ADD(&entry->failed, 1);
+    }
+    MLNX_PERF_ATOMIC_ADD(&entry->total_ns, elapsed);
+    MLNX_PERF_ATOMIC_ADD(&entry->sdk_ns, ctx->sdk_ns);
+    if (ctx->is_sdk_accounted) {
+        MLNX_PERF_ATOMIC_ADD(&entry->sdk_count, 1);
+    }
+    MLNX_PERF_ATOMIC_ADD(&entry->lock_wait_ns, ctx->lock_wait_ns);
+    MLNX_PERF_ATOMIC_ADD(&entry->hist[mlnx_perf_hist_bucket(elapsed)], 1);
+
+    do {
+        max = entry->max_ns;
+    } while ((elapsed > max) && !MLNX_PERF_ATOMIC_CAS(&entry->max_ns, max, elapsed));
+}
+
+void mlnx_perf_sdk_enter(void)
+{
+    if (mlnx_perf_ctx.is_active) {
+        mlnx_perf_ctx.sdk_start_ns = mlnx_perf_now_ns();
+    }
+}
+
+sx_status_t mlnx_perf_sdk_exit(_In_ sx_status_t status)
+{
+    if (mlnx_perf_ctx.is_active) {
+        mlnx_perf_ctx.sdk_ns          += mlnx_perf_now_ns() - mlnx_perf_ctx.sdk_start_ns;
+        mlnx_perf_ctx.is_sdk_accounted = true;
+    }
+
+    return status;
+}
+
+void mlnx_perf_plock_acquire(_In_ cl_plock_t *lock, _In_ bool is_exclusive)
+{
+    uint64_t start = 0;
+
+    if (mlnx_perf_ctx.is_active) {
+        start = mlnx_perf_now_ns();
+    }
+
+    if (is_exclusive) {
+        cl_plock_excl_acquire(lock);
+    } else {
+        cl_plock_acquire(lock);
+    }
+
+    if (mlnx_perf_ctx.is_active) {
+        mlnx_perf_ctx.lock_wait_ns += mlnx_perf_now_ns() - start;
+    }
+}
+
+void mlnx_perf_enable_set(_In_ bool enable)
+{
+    mlnx_perf_enabled = enable;
+}
+
+bool mlnx_perf_is_enabled(void)
+{
+    return mlnx_perf_enabled;
+}
+
+/* Racing updates may survive the clear, the counters are a best effort view */
+void mlnx_perf_clear(void)
+{
+    memset(mlnx_perf_entries, 0, sizeof(mlnx_perf_entries));
+}
+
+void mlnx_perf_entry_get(_In_ sai_object_type_t object_type, _In_ mlnx_perf_op_t op, _Out_ mlnx_perf_entry_t *entry)
+{
+    assert(entry);
+
+    if ((object_type >= SAI_OBJECT_TYPE_MAX) || (op >= MLNX_PERF_OP_MAX)) {
+        memset(entry, 0, sizeof(*entry));
+        return;
+    }
+
+    memcpy(entry, &mlnx_perf_entries[object_type][op], sizeof(*entry));
+}
+
+const char * mlnx_perf_op_str(_In_ mlnx_perf_op_t op)
+{
+    return (op < MLNX_PERF_OP_MAX) ? mlnx_perf_op_names[op] : "unknown";
+}
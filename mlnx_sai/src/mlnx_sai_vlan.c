@@ -97,6 +97,7 @@ typedef struct _mlnx_vlan_member_bulk_sequence_data_t {
 static mlnx_vlan_member_bulk_data_t mlnx_vlan_member_bulk_data;
 
 static void mlnx_vlan_db_remove_vlan(_In_ sai_vlan_id_t vlan_id);
+static sai_status_t mlnx_vlan_counter_unbind(_In_ sx_vlan_id_t vlan_id);
 static sai_status_t mlnx_vlan_id_get(_In_ const sai_object_key_t   *key,
                                      _Inout_ sai_attribute_value_t *value,
                                      _In_ uint32_t                  attr_index,
@@ -839,14 +840,173 @@ static sai_status_t mlnx_remove_vlan(_In_ sai_object_id_t sai_vlan_id)
         goto out;
     }
 
+    status = mlnx_vlan_counter_unbind(vlan_id);
+    if (SAI_ERR(status)) {
+        goto out;
+    }
+
     mlnx_vlan_db_remove_vlan(vlan_id);
 
 out:
+    sai_db_sync_async();
     sai_db_unlock();
     SX_LOG_EXIT();
     return status;
 }
 
+/*
+ * Creates flow counter and binds it to the VLAN FID (which is the VLAN id for .1Q bridge),
+ * called under sai db write lock.
+ */
+static sai_status_t mlnx_vlan_counter_bind(_In_ sx_vlan_id_t vlan_id)
+{
+    mlnx_vlan_db_t      *vlan_db    = &g_sai_db_ptr->vlans_db[vlan_id - SXD_VID_MIN];
+    sx_flow_counter_id_t counter_id = SX_FLOW_COUNTER_ID_INVALID;
+    sx_status_t          sx_status;
+
+    if (g_sai_db_ptr->vlan_counters_count >= MLNX_VLAN_COUNTERS_MAX) {
+        SX_LOG_ERR("Failed to create vlan %u flow counter - %u VLAN counters are in use\n", vlan_id,
+                   MLNX_VLAN_COUNTERS_MAX);
+        return SAI_STATUS_INSUFFICIENT_RESOURCES;
+    }
+
+    sx_status = sx_api_flow_counter_set(gh_sdk, SX_ACCESS_CMD_CREATE, SX_FLOW_COUNTER_TYPE_PACKETS_AND_BYTES,
+                                        &counter_id);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Failed to create vlan %u flow counter - %s.\n", vlan_id, SX_STATUS_MSG(sx_status));
+        return sdk_to_sai(sx_status);
+    }
+
+    sx_status = sx_api_bridge_counter_bind_set(gh_sdk, SX_ACCESS_CMD_BIND, (sx_bridge_id_t)vlan_id, counter_id);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Failed to bind flow counter %u to vlan %u - %s.\n", counter_id, vlan_id,
+                   SX_STATUS_MSG(sx_status));
+        sx_api_flow_counter_set(gh_sdk, SX_ACCESS_CMD_DESTROY, SX_FLOW_COUNTER_TYPE_PACKETS_AND_BYTES, &counter_id);
+        return sdk_to_sai(sx_status);
+    }
+
+    vlan_db->counter_id       = counter_id;
+    vlan_db->is_counter_bound = true;
+    sai_db_field_dirty_mark(vlans_db[vlan_id - SXD_VID_MIN]);
+
+    g_sai_db_ptr->vlan_counters_count++;
+    sai_db_field_dirty_mark(vlan_counters_count);
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/* Called under sai db write lock */
+static sai_status_t mlnx_vlan_counter_unbind(_In_ sx_vlan_id_t vlan_id)
+{
+    mlnx_vlan_db_t *vlan_db = &g_sai_db_ptr->vlans_db[vlan_id - SXD_VID_MIN];
+    sx_status_t     sx_status;
+
+    if (!vlan_db->is_counter_bound) {
+        return SAI_STATUS_SUCCESS;
+    }
+
+    sx_status = sx_api_bridge_counter_bind_set(gh_sdk, SX_ACCESS_CMD_UNBIND, (sx_bridge_id_t)vlan_id,
+                                               vlan_db->counter_id);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Failed to unbind flow counter %u from vlan %u - %s.\n", vlan_db->counter_id, vlan_id,
+                   SX_STATUS_MSG(sx_status));
+        return sdk_to_sai(sx_status);
+    }
+
+    sx_status = sx_api_flow_counter_set(gh_sdk, SX_ACCESS_CMD_DESTROY, SX_FLOW_COUNTER_TYPE_PACKETS_AND_BYTES,
+                                        &vlan_db->counter_id);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Failed to destroy vlan %u flow counter - %s.\n", vlan_id, SX_STATUS_MSG(sx_status));
+        return sdk_to_sai(sx_status);
+    }
+
+    vlan_db->is_counter_bound = false;
+    vlan_db->counter_id       = SX_FLOW_COUNTER_ID_INVALID;
+    sai_db_field_dirty_mark(vlans_db[vlan_id - SXD_VID_MIN]);
+
+    g_sai_db_ptr->vlan_counters_count--;
+    sai_db_field_dirty_mark(vlan_counters_count);
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/*
+ * Returns the VLAN flow counter, SAI_STATUS_ITEM_NOT_FOUND if it is not bound yet.
+ * DB read lock is needed, the counter stays bound while it is held.
+ */
+static sai_status_t mlnx_vlan_counter_id_get(_In_ sx_vlan_id_t vlan_id, _Out_ sx_flow_counter_id_t *counter_id)
+{
+    if (!mlnx_vlan_is_created(vlan_id)) {
+        SX_LOG_ERR("VLAN %d is not created\n", vlan_id);
+        return SAI_STATUS_INVALID_OBJECT_ID;
+    }
+
+    if (!g_sai_db_ptr->vlans_db[vlan_id - SXD_VID_MIN].is_counter_bound) {
+        return SAI_STATUS_ITEM_NOT_FOUND;
+    }
+
+    *counter_id = g_sai_db_ptr->vlans_db[vlan_id - SXD_VID_MIN].counter_id;
+
+    return SAI_STATUS_SUCCESS;
+}
+
+/* Binds a counter to the VLAN on the first stats request, takes the DB write lock */
+static sai_status_t mlnx_vlan_counter_bind_once(_In_ sx_vlan_id_t vlan_id)
+{
+    sai_status_t status = SAI_STATUS_SUCCESS;
+
+    sai_db_write_lock();
+
+    /* The VLAN could be removed or the counter bound by other caller while the lock was released */
+    if (!mlnx_vlan_is_created(vlan_id)) {
+        SX_LOG_ERR("VLAN %d is not created\n", vlan_id);
+        status = SAI_STATUS_INVALID_OBJECT_ID;
+    } else if (!g_sai_db_ptr->vlans_db[vlan_id - SXD_VID_MIN].is_counter_bound) {
+        status = mlnx_vlan_counter_bind(vlan_id);
+    }
+
+    sai_db_sync_async();
+    sai_db_unlock();
+
+    return status;
+}
+
+/*
+ * Reads the counters of all the VLANs with a bound counter for the counter collector in one pass,
+ * ordered by the VLAN id. Only the counter ids are taken under the DB lock.
+ * A counter that fails to read is marked invalid, the rest are still read.
+ */
+void mlnx_vlan_counters_read(_In_ sx_api_handle_t             handle,
+                             _Out_ mlnx_vlan_counter_value_t *values,
+                             _In_ uint32_t                    max_count,
+                             _Out_ uint32_t                  *count)
+{
+    sx_status_t sx_status;
+    uint32_t    ii, values_count = 0;
+
+    *count = 0;
+
+    sai_db_read_lock();
+    for (ii = 0; (ii < SXD_VID_MAX) && (values_count < max_count); ii++) {
+        if (g_sai_db_ptr->vlans_db[ii].is_created && g_sai_db_ptr->vlans_db[ii].is_counter_bound) {
+            values[values_count].vlan_id    = (sx_vlan_id_t)(ii + SXD_VID_MIN);
+            values[values_count].counter_id = g_sai_db_ptr->vlans_db[ii].counter_id;
+            values_count++;
+        }
+    }
+    sai_db_unlock();
+
+    for (ii = 0; ii < values_count; ii++) {
+        sx_status = sx_api_flow_counter_get(handle, SX_ACCESS_CMD_READ, values[ii].counter_id, &values[ii].value);
+        values[ii].is_valid = !SX_ERR(sx_status);
+        if (!values[ii].is_valid) {
+            SX_LOG_ERR("Failed to get vlan %u flow counter - %s.\n", values[ii].vlan_id, SX_STATUS_MSG(sx_status));
+        }
+    }
+
+    *count = values_count;
+}
+
 /**
  * @brief Get vlan statistics counters.
  *
@@ -862,8 +1022,13 @@ static sai_status_t mlnx_get_vlan_stats(_In_ sai_object_id_t        sai_vlan_id,
                                         _In_ const sai_vlan_stat_t *counter_ids,
                                         _Out_ uint64_t             *counters)
 {
-    UNREFERENCED_PARAMETER(sai_vlan_id);
-    UNREFERENCED_PARAMETER(number_of_counters);
+    sx_flow_counter_set_t counter_value;
+    sx_flow_counter_id_t  counter_id;
+    sx_status_t           sx_status;
+    sai_status_t          status;
+    uint16_t              vlan_id;
+    uint32_t              ii;
+    char                  key_str[MAX_KEY_STR_LEN];
 
     SX_LOG_ENTER();
 
@@ -877,10 +1042,85 @@ static sai_status_t mlnx_get_vlan_stats(_In_ sai_object_id_t        sai_vlan_id,
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    /* TODO : implement */
+    status = sai_object_to_vlan(sai_vlan_id, &vlan_id);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    vlan_key_to_str(vlan_id, key_str);
+    SX_LOG_DBG("Get stats %s\n", key_str);
+
+    /* Checked before the counter is bound, a bad request doesn't take a counter from the pool */
+    for (ii = 0; ii < number_of_counters; ii++) {
+        switch (counter_ids[ii]) {
+        case SAI_VLAN_STAT_IN_OCTETS:
+        case SAI_VLAN_STAT_IN_PACKETS:
+            break;
+
+        case SAI_VLAN_STAT_IN_UCAST_PKTS:
+        case SAI_VLAN_STAT_IN_NON_UCAST_PKTS:
+        case SAI_VLAN_STAT_IN_DISCARDS:
+        case SAI_VLAN_STAT_IN_ERRORS:
+        case SAI_VLAN_STAT_IN_UNKNOWN_PROTOS:
+        case SAI_VLAN_STAT_OUT_OCTETS:
+        case SAI_VLAN_STAT_OUT_PACKETS:
+        case SAI_VLAN_STAT_OUT_UCAST_PKTS:
+        case SAI_VLAN_STAT_OUT_NON_UCAST_PKTS:
+        case SAI_VLAN_STAT_OUT_DISCARDS:
+        case SAI_VLAN_STAT_OUT_ERRORS:
+        case SAI_VLAN_STAT_OUT_QLEN:
+            SX_LOG_ERR("VLAN counter %d set item %u not supported\n", counter_ids[ii], ii);
+            SX_LOG_EXIT();
+            return SAI_STATUS_ATTR_NOT_SUPPORTED_0 + ii;
+
+        default:
+            SX_LOG_ERR("Invalid VLAN counter %d\n", counter_ids[ii]);
+            SX_LOG_EXIT();
+            return SAI_STATUS_INVALID_PARAMETER;
+        }
+    }
+
+    sai_db_read_lock();
 
+    status = mlnx_vlan_counter_id_get(vlan_id, &counter_id);
+    if (SAI_STATUS_ITEM_NOT_FOUND == status) {
+        sai_db_unlock();
+
+        status = mlnx_vlan_counter_bind_once(vlan_id);
+        if (SAI_ERR(status)) {
+            SX_LOG_EXIT();
+            return status;
+        }
+
+        sai_db_read_lock();
+        status = mlnx_vlan_counter_id_get(vlan_id, &counter_id);
+    }
+    if (SAI_ERR(status)) {
+        goto out;
+    }
+
+    /* The read lock keeps the counter from being destroyed by a VLAN remove during the read */
+    if (!mlnx_counter_vlan_get(vlan_id, counter_id, &counter_value)) {
+        sx_status = sx_api_flow_counter_get(gh_sdk, SX_ACCESS_CMD_READ, counter_id, &counter_value);
+        if (SX_ERR(sx_status)) {
+            SX_LOG_ERR("Failed to get vlan %u flow counter - %s.\n", vlan_id, SX_STATUS_MSG(sx_status));
+            status = sdk_to_sai(sx_status);
+            goto out;
+        }
+    }
+
+    for (ii = 0; ii < number_of_counters; ii++) {
+        if (SAI_VLAN_STAT_IN_OCTETS == counter_ids[ii]) {
+            counters[ii] = counter_value.flow_counter_bytes;
+        } else {
+            counters[ii] = counter_value.flow_counter_packets;
+        }
+    }
+
+out:
+    sai_db_unlock();
     SX_LOG_EXIT();
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    return status;
 }
 
 /**
@@ -896,8 +1136,12 @@ static sai_status_t mlnx_clear_vlan_stats(_In_ sai_object_id_t        sai_vlan_i
                                           _In_ uint32_t               number_of_counters,
                                           _In_ const sai_vlan_stat_t *counter_ids)
 {
-    UNREFERENCED_PARAMETER(sai_vlan_id);
-    UNREFERENCED_PARAMETER(number_of_counters);
+    sx_flow_counter_id_t counter_id;
+    sx_status_t          sx_status;
+    sai_status_t         status;
+    uint16_t             vlan_id;
+    uint32_t             ii;
+    char                 key_str[MAX_KEY_STR_LEN];
 
     SX_LOG_ENTER();
 
@@ -906,10 +1150,46 @@ static sai_status_t mlnx_clear_vlan_stats(_In_ sai_object_id_t        sai_vlan_i
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    /* TODO : implement */
+    for (ii = 0; ii < number_of_counters; ii++) {
+        if (counter_ids[ii] > SAI_VLAN_STAT_OUT_QLEN) {
+            SX_LOG_ERR("Invalid VLAN counter %d\n", counter_ids[ii]);
+            return SAI_STATUS_INVALID_PARAMETER;
+        }
+    }
 
+    status = sai_object_to_vlan(sai_vlan_id, &vlan_id);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
+    vlan_key_to_str(vlan_id, key_str);
+    SX_LOG_NTC("Clear stats %s\n", key_str);
+
+    sai_db_read_lock();
+
+    /* Nothing was counted yet if the counter is not bound */
+    status = mlnx_vlan_counter_id_get(vlan_id, &counter_id);
+    if (SAI_STATUS_ITEM_NOT_FOUND == status) {
+        status = SAI_STATUS_SUCCESS;
+        goto out;
+    }
+    if (SAI_ERR(status)) {
+        goto out;
+    }
+
+    sx_status = sx_api_flow_counter_clear_set(gh_sdk, counter_id);
+    if (SX_ERR(sx_status)) {
+        SX_LOG_ERR("Failed to clear vlan %u flow counter - %s.\n", vlan_id, SX_STATUS_MSG(sx_status));
+        status = sdk_to_sai(sx_status);
+        goto out;
+    }
+
+    mlnx_counter_collector_invalidate();
+
+out:
+    sai_db_unlock();
     SX_LOG_EXIT();
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    return status;
 }
 
 static void vlan_member_key_to_str(_In_ sai_object_id_t vlan_member_id, _Out_ char *key_str)
@@ -929,16 +1209,53 @@ bool mlnx_vlan_port_is_set(uint16_t vid, mlnx_bridge_port_t *port)
     return array_bit_test(g_sai_db_ptr->vlans_db[vid - 1].ports_map, port->index);
 }
 
+/* Returns the index of the first bit set at or after 'bit', or 'bits_count' if there is none */
+uint32_t mlnx_bitmap_next_set(_In_ const uint32_t *bit_array, _In_ uint32_t bits_count, _In_ uint32_t bit)
+{
+    uint32_t word;
+
+    while (bit < bits_count) {
+        word = bit_array[bit / 32] >> (bit % 32);
+        if (!word) {
+            bit = (bit / 32 + 1) * 32;
+            continue;
+        }
+
+        while (!(word & 1)) {
+            word >>= 1;
+            bit++;
+        }
+
+        return (bit < bits_count) ? bit : bits_count;
+    }
+
+    return bits_count;
+}
+
+/* Next bridge port index in the VLAN, MAX_BRIDGE_PORTS when there are no more ports */
+uint32_t mlnx_vlan_port_next(_In_ uint16_t vid, _In_ uint32_t idx)
+{
+    return mlnx_bitmap_next_set(g_sai_db_ptr->vlans_db[vid - 1].ports_map, MAX_BRIDGE_PORTS, idx);
+}
+
+/* Next VLAN of the bridge port, SXD_VID_MAX + 1 when there are no more VLANs */
+uint16_t mlnx_bridge_port_vlan_next(_In_ const mlnx_bridge_port_t *port, _In_ uint32_t vid)
+{
+    return (uint16_t)mlnx_bitmap_next_set(port->vlans_map, SXD_VID_MAX + 1, vid);
+}
+
 void mlnx_vlan_port_set(uint16_t vid, mlnx_bridge_port_t *port, bool is_set)
 {
     assert(port->index < MAX_BRIDGE_PORTS * 2);
 
     if (is_set && !mlnx_vlan_port_is_set(vid, port)) {
         array_bit_set(g_sai_db_ptr->vlans_db[vid - 1].ports_map, port->index);
+        array_bit_set(port->vlans_map, vid);
         mlnx_fdb_port_event_handle(port, vid, SAI_PORT_EVENT_ADD);
         port->vlans++;
     } else if (!is_set && mlnx_vlan_port_is_set(vid, port)) {
         array_bit_clear(g_sai_db_ptr->vlans_db[vid - 1].ports_map, port->index);
+        array_bit_clear(port->vlans_map, vid);
         mlnx_fdb_port_event_handle(port, vid, SAI_PORT_EVENT_DELETE);
         port->vlans--;
     }
@@ -1437,9 +1754,11 @@ static void mlnx_vlan_member_bulk_db_port_vlan_set(_In_ uint16_t            vid,
 
     if (add && !mlnx_vlan_port_is_set(vid, port)) {
         array_bit_set(g_sai_db_ptr->vlans_db[vid - 1].ports_map, port->index);
+        array_bit_set(port->vlans_map, vid);
         port->vlans++;
     } else if (!add && mlnx_vlan_port_is_set(vid, port)) {
         array_bit_clear(g_sai_db_ptr->vlans_db[vid - 1].ports_map, port->index);
+        array_bit_clear(port->vlans_map, vid);
         port->vlans--;
     }
 }
@@ -1816,13 +2135,13 @@ static sai_status_t mlnx_vlan_member_bulk_remove_statuses_print(_In_ const sai_s
  * any of the objects fails to create. When there is failure, Caller is expected to go through the
  * list of returned statuses to find out which fails and which succeeds.
  */
-sai_status_t mlnx_create_vlan_members(_In_ sai_object_id_t         switch_id,
-                                      _In_ uint32_t                object_count,
-                                      _In_ const uint32_t         *attr_count,
-                                      _In_ const sai_attribute_t **attrs,
-                                      _In_ sai_bulk_op_type_t      type,
-                                      _Out_ sai_object_id_t       *object_id,
-                                      _Out_ sai_status_t          *object_statuses)
+static sai_status_t mlnx_create_vlan_members_impl(_In_ sai_object_id_t         switch_id,
+                                                  _In_ uint32_t                object_count,
+                                                  _In_ const uint32_t         *attr_count,
+                                                  _In_ const sai_attribute_t **attrs,
+                                                  _In_ sai_bulk_op_type_t      type,
+                                                  _Out_ sai_object_id_t       *object_id,
+                                                  _Out_ sai_status_t          *object_statuses)
 {
     sai_status_t            status;
     mlnx_vlan_member_data_t vlan_member_data;
@@ -1903,6 +2222,29 @@ out:
     return failure ? SAI_STATUS_FAILURE : SAI_STATUS_SUCCESS;
 }
 
+sai_status_t mlnx_create_vlan_members(_In_ sai_object_id_t         switch_id,
+                                      _In_ uint32_t                object_count,
+                                      _In_ const uint32_t         *attr_count,
+                                      _In_ const sai_attribute_t **attrs,
+                                      _In_ sai_bulk_op_type_t      type,
+                                      _Out_ sai_object_id_t       *object_id,
+                                      _Out_ sai_status_t          *object_statuses)
+{
+    sai_status_t status;
+
+    mlnx_perf_op_begin(SAI_OBJECT_TYPE_VLAN_MEMBER, MLNX_PERF_OP_BULK);
+    status = mlnx_create_vlan_members_impl(switch_id,
+                                           object_count,
+                                           attr_count,
+                                           attrs,
+                                           type,
+                                           object_id,
+                                           object_statuses);
+    mlnx_perf_op_end(status);
+
+    return status;
+}
+
 /**
  * @brief Bulk vlan members removal.
  *
@@ -1915,10 +2257,10 @@ out:
  * any of the objects fails to remove. When there is failure, Caller is expected to go through the
  * list of returned statuses to find out which fails and which succeeds.
  */
-sai_status_t mlnx_remove_vlan_members(_In_ uint32_t               object_count,
-                                      _In_ const sai_object_id_t *object_id,
-                                      _In_ sai_bulk_op_type_t     type,
-                                      _Out_ sai_status_t         *object_statuses)
+static sai_status_t mlnx_remove_vlan_members_impl(_In_ uint32_t               object_count,
+                                                  _In_ const sai_object_id_t *object_id,
+                                                  _In_ sai_bulk_op_type_t     type,
+                                                  _Out_ sai_status_t         *object_statuses)
 {
     sai_status_t            status;
     mlnx_vlan_member_data_t vlan_member_data;
@@ -1988,6 +2330,20 @@ out:
     return failure ? SAI_STATUS_FAILURE : SAI_STATUS_SUCCESS;
 }
 
+sai_status_t mlnx_remove_vlan_members(_In_ uint32_t               object_count,
+                                      _In_ const sai_object_id_t *object_id,
+                                      _In_ sai_bulk_op_type_t     type,
+                                      _Out_ sai_status_t         *object_statuses)
+{
+    sai_status_t status;
+
+    mlnx_perf_op_begin(SAI_OBJECT_TYPE_VLAN_MEMBER, MLNX_PERF_OP_BULK);
+    status = mlnx_remove_vlan_members_impl(object_count, object_id, type, object_statuses);
+    mlnx_perf_op_end(status);
+
+    return status;
+}
+
 /*
  *  \brief Set VLAN Member Attribute
  *  \param[in] vlan_member_id VLAN member ID
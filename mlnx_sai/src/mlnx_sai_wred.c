@@ -173,8 +173,10 @@ static sai_status_t mlnx_wred_db_create(sai_object_id_t *wred_id, mlnx_wred_prof
                 break;
             }
             memcpy(&g_sai_qos_db_ptr->wred_db[ii], new_wred, sizeof(mlnx_wred_profile_t));
+            memset(g_sai_qos_db_ptr->wred_db[ii].ports_map, 0, sizeof(g_sai_qos_db_ptr->wred_db[ii].ports_map));
             g_sai_qos_db_ptr->wred_db[ii].in_use = true;
-            sai_qos_db_sync();
+            sai_qos_db_dirty_mark(&g_sai_qos_db_ptr->wred_db[ii], sizeof(g_sai_qos_db_ptr->wred_db[ii]));
+            sai_qos_db_sync_async();
             break;
         }
     }
@@ -212,7 +214,8 @@ static sai_status_t mlnx_wred_db_remove(sai_object_id_t wred_id)
     } else {
         memset(&g_sai_qos_db_ptr->wred_db[wred_num], 0, sizeof(g_sai_qos_db_ptr->wred_db[wred_num]));
         g_sai_qos_db_ptr->wred_db[wred_num].in_use = false;
-        sai_qos_db_sync();
+        sai_qos_db_dirty_mark(&g_sai_qos_db_ptr->wred_db[wred_num], sizeof(g_sai_qos_db_ptr->wred_db[wred_num]));
+        sai_qos_db_sync_async();
     }
 
     return status;
@@ -240,6 +243,37 @@ sai_status_t __mlnx_wred_db_get(sai_object_id_t wred_oid, mlnx_wred_profile_t **
     return SAI_STATUS_SUCCESS;
 }
 
+#define mlnx_wred_bound_ports_foreach(wred, port, idx) \
+    for (idx = mlnx_bitmap_next_set((wred)->ports_map, MAX_PORTS * 2, 0); \
+         idx < (MAX_PORTS * 2) && (port = &mlnx_ports_db[idx]); \
+         idx = mlnx_bitmap_next_set((wred)->ports_map, MAX_PORTS * 2, idx + 1))
+
+/*
+ * Record that WRED profile is bound on the port or one of its queues. The bit is kept
+ * until the profile is removed, users re-check the actual port/queue wred_id.
+ * (DB write lock is needed)
+ */
+void mlnx_wred_port_ref_add(sai_object_id_t wred_oid, const mlnx_port_config_t *port)
+{
+    mlnx_wred_profile_t *wred;
+    uint32_t             idx = mlnx_port_idx_get(port);
+
+    if (wred_oid == SAI_NULL_OBJECT_ID) {
+        return;
+    }
+
+    if (SAI_ERR(__mlnx_wred_db_get(wred_oid, &wred))) {
+        return;
+    }
+
+    if (wred->ports_map[idx / 32] & (1u << (idx % 32))) {
+        return;
+    }
+
+    wred->ports_map[idx / 32] |= 1u << (idx % 32);
+    sai_qos_db_dirty_mark(wred->ports_map, sizeof(wred->ports_map));
+}
+
 /*
  * Routine Description:
  *   Get SAI WRED profile by specified wred obj ID.
@@ -293,9 +327,13 @@ static sai_status_t mlnx_wred_db_set(sai_object_id_t wred_id, mlnx_wred_profile_
         (!g_sai_qos_db_ptr->wred_db[wred_num].in_use)) {
         status = SAI_STATUS_ITEM_NOT_FOUND;
     } else {
+        /* Binding registry is owned by the DB entry, not by the caller's copy */
+        memcpy(wred_profile->ports_map, g_sai_qos_db_ptr->wred_db[wred_num].ports_map,
+               sizeof(wred_profile->ports_map));
         memcpy(&g_sai_qos_db_ptr->wred_db[wred_num], wred_profile, sizeof(mlnx_wred_profile_t));
         g_sai_qos_db_ptr->wred_db[wred_num].in_use = true;
-        sai_qos_db_sync();
+        sai_qos_db_dirty_mark(&g_sai_qos_db_ptr->wred_db[wred_num], sizeof(g_sai_qos_db_ptr->wred_db[wred_num]));
+        sai_qos_db_sync_async();
     }
 
     return status;
@@ -517,7 +555,8 @@ static sai_status_t mlnx_wred_bind_sxwred_to_port(sx_port_log_id_t          port
  * Arguments:
  *    [in] wred_id - id of WRED profile
  *    [in] profile_id - sx profile id
- *    [in] flow_type - specify sx flow type
+ *    [in] flows - sx flow types
+ *    [in] flow_count - number of flow types
  *    [in] cmd - SX_ACCESS_CMD_BIND / SX_ACCESS_CMD_UNBIND
  *
  * Return Values:
@@ -525,45 +564,54 @@ static sai_status_t mlnx_wred_bind_sxwred_to_port(sx_port_log_id_t          port
  *    SAI_STATUS_FAILURE
  *
  */
-static sai_status_t mlnx_wred_bind_sxwred_to_all_port(sai_object_id_t           wred_id,
-                                                      sx_cos_redecn_profile_t   profile_id,
-                                                      sx_cos_redecn_flow_type_e flow_type,
-                                                      sx_access_cmd_t           cmd)
+static sai_status_t mlnx_wred_bind_sxwred_to_all_port(sai_object_id_t                  wred_id,
+                                                      sx_cos_redecn_profile_t          profile_id,
+                                                      const sx_cos_redecn_flow_type_e *flows,
+                                                      uint32_t                         flow_count,
+                                                      sx_access_cmd_t                  cmd)
 {
-    uint32_t                ii = 0;
+    uint32_t                ii = 0, jj;
+    mlnx_wred_profile_t    *wred;
     sx_cos_traffic_class_t *tc_list;
-    uint32_t                tc_count  = g_resource_limits.cos_port_ets_traffic_class_max + 1;
-    sx_status_t             sx_status = SX_STATUS_SUCCESS;
+    uint32_t                tc_count = g_resource_limits.cos_port_ets_traffic_class_max + 1;
+    sai_status_t            status;
     mlnx_port_config_t     *port;
 
+    status = __mlnx_wred_db_get(wred_id, &wred);
+    if (SAI_ERR(status)) {
+        return status;
+    }
+
     tc_list = calloc(tc_count, sizeof(sx_cos_traffic_class_t));
     if (NULL == tc_list) {
         SX_LOG_ERR("Failed to alloc memory for tc list\n");
         return SAI_STATUS_NO_MEMORY;
     }
 
+    mlnx_wred_bound_ports_foreach(wred, port, ii) {
+        if (!port->is_present || port->lag_id) {
+            continue;
+        }
 
-    mlnx_port_not_in_lag_foreach(port, ii) {
         tc_count = g_resource_limits.cos_port_ets_traffic_class_max + 1;
-        if (SAI_STATUS_SUCCESS !=
-            mlnx_wred_get_tc_configured_list(port, wred_id, tc_list, &tc_count)) {
-            sx_status = SX_STATUS_ERROR;
+        status   = mlnx_wred_get_tc_configured_list(port, wred_id, tc_list, &tc_count);
+        if (SAI_ERR(status)) {
+            status = SAI_STATUS_FAILURE;
             break;
         }
-        if (tc_count > 0) {
-            sx_status = mlnx_wred_bind_sxwred_to_port(port->logical, profile_id,
-                                                      tc_list, tc_count, flow_type, cmd);
-            if (SX_STATUS_SUCCESS != sx_status) {
-                break;
+
+        for (jj = 0; (jj < flow_count) && (tc_count > 0); jj++) {
+            status = mlnx_wred_bind_sxwred_to_port(port->logical, profile_id,
+                                                   tc_list, tc_count, flows[jj], cmd);
+            if (SAI_ERR(status)) {
+                goto out;
             }
         }
     }
 
-
-    if (tc_list) {
-        free(tc_list);
-    }
-    return sdk_to_sai(sx_status);
+out:
+    free(tc_list);
+    return status;
 }
 
 /*
@@ -580,10 +628,19 @@ static bool mlnx_wred_check_in_use(sai_object_id_t wred_id)
 {
     mlnx_port_config_t      *port;
     mlnx_qos_queue_config_t *queue;
+    mlnx_wred_profile_t     *wred;
     bool                     in_use = false;
     uint32_t                 ii, jj;
 
-    mlnx_port_foreach(port, ii) {
+    if (SAI_ERR(__mlnx_wred_db_get(wred_id, &wred))) {
+        return false;
+    }
+
+    mlnx_wred_bound_ports_foreach(wred, port, ii) {
+        if (!port->is_present || !port->logical) {
+            continue;
+        }
+
         if (port->wred_id == wred_id) {
             in_use = true;
             break;
@@ -687,7 +744,11 @@ static sai_status_t mlnx_wred_bind_saiwred_to_all_port(sai_object_id_t wred_id,
         return SAI_STATUS_NO_MEMORY;
     }
 
-    mlnx_port_not_in_lag_foreach(port, ii) {
+    mlnx_wred_bound_ports_foreach(&wred_profile, port, ii) {
+        if (!port->is_present || port->lag_id) {
+            continue;
+        }
+
         tc_count = g_resource_limits.cos_port_ets_traffic_class_max + 1;
         if (SAI_STATUS_SUCCESS !=
             mlnx_wred_get_tc_configured_list(port, wred_id, tc_list, &tc_count)) {
@@ -899,13 +960,23 @@ sai_status_t mlnx_wred_apply(sai_object_id_t wred_id, sai_object_id_t to_obj_id)
         /* Update DB */
         if ((to_obj_type == SAI_OBJECT_TYPE_PORT) || (to_obj_type == SAI_OBJECT_TYPE_LAG)) {
             port_conf->wred_id = wred_id;
+            mlnx_wred_port_ref_add(wred_id, port_conf);
         } else {
             status = mlnx_queue_cfg_lookup(port_id, tc_list[0], &queue_cfg);
             if (status != SAI_STATUS_SUCCESS) {
+                free(tc_list);
                 return status;
             }
             queue_cfg->wred_id = wred_id;
         }
+
+        /* port_id is the LAG for LAG members, this is where the sx profiles are bound */
+        status = mlnx_port_by_log_id(port_id, &port_conf);
+        if (status != SAI_STATUS_SUCCESS) {
+            free(tc_list);
+            return status;
+        }
+        mlnx_wred_port_ref_add(wred_id, port_conf);
     }
 
     free(tc_list);
@@ -923,10 +994,15 @@ sai_status_t mlnx_wred_apply(sai_object_id_t wred_id, sai_object_id_t to_obj_id)
  */
 static void mlnx_wred_reset_from_port(_In_ sai_object_id_t wred_id)
 {
-    uint32_t            ii = 0;
-    mlnx_port_config_t *port;
+    uint32_t             ii = 0;
+    mlnx_port_config_t  *port;
+    mlnx_wred_profile_t *wred;
+
+    if (SAI_ERR(__mlnx_wred_db_get(wred_id, &wred))) {
+        return;
+    }
 
-    mlnx_port_foreach(port, ii) {
+    mlnx_wred_bound_ports_foreach(wred, port, ii) {
         if (port->wred_id == wred_id) {
             port->wred_id = SAI_NULL_OBJECT_ID;
         }
@@ -979,12 +1055,7 @@ static sai_status_t mlnx_wred_remove_profile(sai_object_id_t         wred_id,
 
     /* unbind this profile from all ports it's currently bind */
     if (SAI_STATUS_SUCCESS !=
-        (status = mlnx_wred_bind_sxwred_to_all_port(wred_id, profile_id, flows[0],
-                                                    SX_ACCESS_CMD_UNBIND))) {
-        return status;
-    }
-    if (SAI_STATUS_SUCCESS !=
-        (status = mlnx_wred_bind_sxwred_to_all_port(wred_id, profile_id, flows[1],
+        (status = mlnx_wred_bind_sxwred_to_all_port(wred_id, profile_id, flows, MLNX_SAI_ARRAY_LEN(flows),
                                                     SX_ACCESS_CMD_UNBIND))) {
         return status;
     }
@@ -1213,12 +1284,7 @@ static sai_status_t mlnx_wred_attr_setter(_In_ const sai_object_key_t      *key,
 
     /* unbind from all ports */
     if (SAI_STATUS_SUCCESS !=
-        (status = mlnx_wred_bind_sxwred_to_all_port(wred_id, *profile, flows[0],
-                                                    SX_ACCESS_CMD_UNBIND))) {
-        return status;
-    }
-    if (SAI_STATUS_SUCCESS !=
-        (status = mlnx_wred_bind_sxwred_to_all_port(wred_id, *profile, flows[1],
+        (status = mlnx_wred_bind_sxwred_to_all_port(wred_id, *profile, flows, MLNX_SAI_ARRAY_LEN(flows),
                                                     SX_ACCESS_CMD_UNBIND))) {
         return status;
     }
@@ -1233,12 +1299,7 @@ static sai_status_t mlnx_wred_attr_setter(_In_ const sai_object_key_t      *key,
 
     /* bind profile back to all ports */
     if (SAI_STATUS_SUCCESS !=
-        (status = mlnx_wred_bind_sxwred_to_all_port(wred_id, *profile, flows[0],
-                                                    SX_ACCESS_CMD_BIND))) {
-        return status;
-    }
-    if (SAI_STATUS_SUCCESS !=
-        (status = mlnx_wred_bind_sxwred_to_all_port(wred_id, *profile, flows[1],
+        (status = mlnx_wred_bind_sxwred_to_all_port(wred_id, *profile, flows, MLNX_SAI_ARRAY_LEN(flows),
                                                     SX_ACCESS_CMD_BIND))) {
         return status;
     }